@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "allocation_counter.h"
+
+namespace
+{
+
+std::atomic<std::size_t> live_bytes{0U};
+std::atomic<std::size_t> allocations{0U};
+
+// Keeps max_align_t alignment for the payload that follows the size header.
+constexpr std::size_t kHeaderSize{alignof(std::max_align_t)};
+
+void *CountedAllocate(std::size_t size)
+{
+    auto *block{static_cast<unsigned char *>(std::malloc(size + kHeaderSize))};
+
+    if (block == nullptr)
+    {
+        throw std::bad_alloc{};
+    }
+
+    *reinterpret_cast<std::size_t *>(block) = size;
+    live_bytes.fetch_add(size, std::memory_order_relaxed);
+    allocations.fetch_add(1U, std::memory_order_relaxed);
+
+    return block + kHeaderSize;
+}
+
+void CountedDeallocate(void *pointer) noexcept
+{
+    if (pointer == nullptr)
+    {
+        return;
+    }
+
+    auto *block{static_cast<unsigned char *>(pointer) - kHeaderSize};
+    live_bytes.fetch_sub(*reinterpret_cast<std::size_t *>(block), std::memory_order_relaxed);
+
+    std::free(block);
+}
+
+// Over-aligned blocks put the size header one alignment unit before the payload.
+void *CountedAllocate(std::size_t size, std::align_val_t alignment)
+{
+    auto const header{std::max(kHeaderSize, static_cast<std::size_t>(alignment))};
+    auto const total{(size + header + header - 1U) / header * header};
+    auto *block{static_cast<unsigned char *>(std::aligned_alloc(header, total))};
+
+    if (block == nullptr)
+    {
+        throw std::bad_alloc{};
+    }
+
+    *reinterpret_cast<std::size_t *>(block) = size;
+    live_bytes.fetch_add(size, std::memory_order_relaxed);
+    allocations.fetch_add(1U, std::memory_order_relaxed);
+
+    return block + header;
+}
+
+void CountedDeallocate(void *pointer, std::align_val_t alignment) noexcept
+{
+    if (pointer == nullptr)
+    {
+        return;
+    }
+
+    auto *block{static_cast<unsigned char *>(pointer) - std::max(kHeaderSize, static_cast<std::size_t>(alignment))};
+    live_bytes.fetch_sub(*reinterpret_cast<std::size_t *>(block), std::memory_order_relaxed);
+
+    std::free(block);
+}
+
+} // namespace
+
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+    return CountedAllocate(size, alignment);
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return CountedAllocate(size, alignment);
+}
+
+void operator delete(void *pointer, std::align_val_t alignment) noexcept
+{
+    CountedDeallocate(pointer, alignment);
+}
+
+void operator delete[](void *pointer, std::align_val_t alignment) noexcept
+{
+    CountedDeallocate(pointer, alignment);
+}
+
+void operator delete(void *pointer, std::size_t, std::align_val_t alignment) noexcept
+{
+    CountedDeallocate(pointer, alignment);
+}
+
+void operator delete[](void *pointer, std::size_t, std::align_val_t alignment) noexcept
+{
+    CountedDeallocate(pointer, alignment);
+}
+
+void *operator new(std::size_t size)
+{
+    return CountedAllocate(size);
+}
+
+void *operator new[](std::size_t size)
+{
+    return CountedAllocate(size);
+}
+
+void operator delete(void *pointer) noexcept
+{
+    CountedDeallocate(pointer);
+}
+
+void operator delete[](void *pointer) noexcept
+{
+    CountedDeallocate(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept
+{
+    CountedDeallocate(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept
+{
+    CountedDeallocate(pointer);
+}
+
+namespace flight_management
+{
+
+std::size_t AllocationCounter::LiveBytes() noexcept
+{
+    return live_bytes.load(std::memory_order_relaxed);
+}
+
+std::size_t AllocationCounter::Allocations() noexcept
+{
+    return allocations.load(std::memory_order_relaxed);
+}
+
+} // namespace flight_management
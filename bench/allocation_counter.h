@@ -0,0 +1,20 @@
+#ifndef FLIGHT_MANAGEMENT_BENCH_ALLOCATION_COUNTER_H
+#define FLIGHT_MANAGEMENT_BENCH_ALLOCATION_COUNTER_H
+
+#include <cstddef>
+
+namespace flight_management
+{
+
+/**
+ * Process-wide counters fed by the replaced global operator new/delete.
+ */
+struct AllocationCounter
+{
+    static std::size_t LiveBytes() noexcept;
+    static std::size_t Allocations() noexcept;
+};
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_BENCH_ALLOCATION_COUNTER_H
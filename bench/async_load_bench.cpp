@@ -0,0 +1,124 @@
+#include "benchmark/benchmark.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "async_flight_trip_database.h"
+#include "bench_data.h"
+#include "latency_histogram.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+constexpr std::size_t kHubTrips{1U << 16U};
+constexpr std::size_t kBurstRequests{512U};
+constexpr std::size_t kScanEvery{10U};
+
+/**
+ * A big hub next to an ordinary schedule: every tenth request scans the
+ * hub, the rest are number and route lookups on the schedule.
+ */
+ConcurrentFlightTripDatabase &LoadedDatabase()
+{
+    static ConcurrentFlightTripDatabase database{};
+    static std::once_flag loaded{};
+
+    std::call_once(loaded, [] {
+        std::vector<TripMutation> batch{};
+        for (std::size_t index = 0U; index < kHubTrips; ++index)
+        {
+            batch.push_back(TripMutation::AddTrip("HUB-" + std::to_string(index), "Hub", "Delhi", "Air India",
+                                                  1000U + static_cast<std::uint32_t>(index % 5000U)));
+        }
+        for (auto const &trip : MakeTrips(1U << 16U))
+        {
+            batch.push_back(TripMutation::AddTrip(trip.flight_number, trip.origin_city, trip.destination_city,
+                                                  trip.flight_operator, trip.fare));
+        }
+        database.Publish(batch);
+    });
+
+    return database;
+}
+
+/**
+ * Load generator: each iteration the benchmark thread, standing in for
+ * the event loop, spawns a burst of mixed requests and waits for all of
+ * them. Latency runs from spawn to completion callback. Arguments: scan
+ * chunk size (a chunk as large as the hub means no yielding) and workers.
+ */
+void BM_AsyncMixedLoad(benchmark::State &state)
+{
+    auto &database{LoadedDatabase()};
+    auto const trips{MakeTrips(1U << 16U)};
+    WorkStealingThreadPool pool{static_cast<std::size_t>(state.range(1))};
+    AsyncFlightTripDatabase async{database, pool, static_cast<std::size_t>(state.range(0))};
+
+    LatencyHistogram point_latency{};
+    LatencyHistogram scan_latency{};
+    std::size_t index{0U};
+
+    for (auto _ : state)
+    {
+        std::atomic<std::size_t> completed{0U};
+
+        for (std::size_t request = 0U; request < kBurstRequests; ++request, ++index)
+        {
+            auto const started{std::chrono::steady_clock::now()};
+            auto record = [started, &completed](LatencyHistogram &histogram) {
+                histogram.Record(static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - started)
+                        .count()));
+                completed.fetch_add(1U, std::memory_order_release);
+            };
+            auto const &trip{trips[(index * 7919U) % trips.size()]};
+
+            if (index % kScanEvery == 0U)
+            {
+                Spawn(async.FindFlightsByOriginCity("Hub"),
+                      [record, &scan_latency](auto const &) { record(scan_latency); });
+            }
+            else if (index % 2U == 0U)
+            {
+                Spawn(async.FindFlightsByNumber(trip.flight_number),
+                      [record, &point_latency](auto const &) { record(point_latency); });
+            }
+            else
+            {
+                Spawn(async.FindMinFareBetweenCities(trip.origin_city, trip.destination_city),
+                      [record, &point_latency](auto const &) { record(point_latency); });
+            }
+        }
+
+        while (completed.load(std::memory_order_acquire) != kBurstRequests)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    auto const microseconds = [](std::uint64_t nanoseconds) { return static_cast<double>(nanoseconds) / 1000.0; };
+    state.counters["point_p50_us"] = microseconds(point_latency.ValueAtQuantile(0.5));
+    state.counters["point_p99_us"] = microseconds(point_latency.ValueAtQuantile(0.99));
+    state.counters["scan_p50_us"] = microseconds(scan_latency.ValueAtQuantile(0.5));
+    state.counters["scan_p99_us"] = microseconds(scan_latency.ValueAtQuantile(0.99));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kBurstRequests));
+}
+
+} // namespace
+
+BENCHMARK(BM_AsyncMixedLoad)
+    ->Args({static_cast<std::int64_t>(kHubTrips), 2})
+    ->Args({4096, 2})
+    ->Args({4096, 4})
+    ->ArgNames({"chunk", "workers"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+} // namespace flight_management
@@ -0,0 +1,58 @@
+#ifndef FLIGHT_MANAGEMENT_BENCH_BENCH_DATA_H
+#define FLIGHT_MANAGEMENT_BENCH_BENCH_DATA_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace flight_management
+{
+
+struct TripRecord
+{
+    std::string flight_number;
+    std::string origin_city;
+    std::string destination_city;
+    std::string flight_operator;
+    std::uint32_t fare;
+};
+
+/**
+ * Deterministic schedule: real-world name lengths so the string
+ * costs of the layouts under comparison are representative.
+ */
+inline std::vector<TripRecord> MakeTrips(std::size_t count)
+{
+    static const std::array<const char *, 16> cities{
+        "Pune", "Delhi", "Mumbai", "Chennai", "Kolkata", "Bengaluru", "Hyderabad", "Ahmedabad",
+        "Thiruvananthapuram", "Visakhapatnam", "Bhubaneswar", "Chandigarh", "Guwahati", "Lucknow",
+        "Port Blair", "Srinagar"};
+    static const std::array<const char *, 8> operators{
+        "Air India", "IndiGo", "SpiceJet", "Vistara", "Go First", "AirAsia India", "Akasa Air", "Alliance Air"};
+
+    std::vector<TripRecord> trips{};
+    trips.reserve(count);
+
+    std::uint32_t state{2463534242U};
+
+    for (std::size_t index = 0U; index < count; ++index)
+    {
+        state ^= state << 13U;
+        state ^= state >> 17U;
+        state ^= state << 5U;
+
+        auto const origin{state % cities.size()};
+        auto const destination{(origin + 1U + (state >> 8U) % (cities.size() - 1U)) % cities.size()};
+        auto const flight_operator{(state >> 16U) % operators.size()};
+
+        trips.push_back(TripRecord{"FL-" + std::to_string(index), cities[origin], cities[destination],
+                                   operators[flight_operator], 1500U + (state >> 4U) % 15000U});
+    }
+
+    return trips;
+}
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_BENCH_BENCH_DATA_H
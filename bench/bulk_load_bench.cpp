@@ -0,0 +1,77 @@
+#include "benchmark/benchmark.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "bench_data.h"
+#include "schedule_loader.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+std::string WriteSchedule(std::size_t count)
+{
+    std::string const path{"/tmp/flight_management_bench_" + std::to_string(count) + ".csv"};
+    std::ofstream file{path};
+
+    file << "flight_number,origin_city,destination_city,operator,fare\n";
+    for (auto const &trip : MakeTrips(count))
+    {
+        file << trip.flight_number << ',' << trip.origin_city << ',' << trip.destination_city << ','
+             << trip.flight_operator << ',' << trip.fare << '\n';
+    }
+
+    return path;
+}
+
+void BM_AddTripLoop(benchmark::State &state)
+{
+    auto const trips{MakeTrips(static_cast<std::size_t>(state.range(0)))};
+
+    for (auto _ : state)
+    {
+        FlightTripDatabase database{};
+        for (auto const &trip : trips)
+        {
+            database.AddTrip(trip.flight_number, trip.origin_city, trip.destination_city, trip.flight_operator,
+                             trip.fare);
+        }
+        benchmark::DoNotOptimize(database);
+    }
+
+    state.counters["rows_per_second"] =
+        benchmark::Counter(static_cast<double>(state.range(0)), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+/**
+ * Whole file path: map, parse on range(1) threads, sort-then-build.
+ */
+void BM_LoadCsvFile(benchmark::State &state)
+{
+    std::string const path{WriteSchedule(static_cast<std::size_t>(state.range(0)))};
+    ScheduleLoader const loader{static_cast<std::size_t>(state.range(1))};
+
+    for (auto _ : state)
+    {
+        FlightTripDatabase database{};
+        benchmark::DoNotOptimize(loader.LoadCsvFile(path, database));
+    }
+
+    state.counters["rows_per_second"] =
+        benchmark::Counter(static_cast<double>(state.range(0)), benchmark::Counter::kIsIterationInvariantRate);
+    std::remove(path.c_str());
+}
+
+} // namespace
+
+BENCHMARK(BM_AddTripLoop)->RangeMultiplier(16)->Range(1 << 12, 1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LoadCsvFile)
+    ->ArgsProduct({{1 << 12, 1 << 16, 1 << 20}, {1, 4}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+} // namespace flight_management
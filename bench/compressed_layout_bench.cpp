@@ -0,0 +1,180 @@
+#include "benchmark/benchmark.h"
+
+#include <array>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "allocation_counter.h"
+#include "compressed_flight_trip_database.h"
+#include "schedule_generator.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+constexpr std::array<std::int64_t, 2> kLayoutSizes{1 << 16, 1 << 20};
+
+/**
+ * The compressed copy of CachedSchedule(trip_count), kept alongside it
+ * and rebuilt whenever the schedule size changes.
+ */
+const CompressedFlightTripDatabase &CachedCompressed(std::size_t trip_count)
+{
+    static std::unique_ptr<CompressedFlightTripDatabase> compressed{};
+    static std::size_t compressed_count{0U};
+
+    auto const &fixture{CachedSchedule(trip_count)};
+
+    if (!compressed || compressed_count != trip_count)
+    {
+        compressed.reset();
+        compressed = std::make_unique<CompressedFlightTripDatabase>(fixture.database);
+        compressed_count = trip_count;
+    }
+
+    return *compressed;
+}
+
+/**
+ * Heap bytes per trip of each layout holding the schedule, strings
+ * included. The compressed layout also reports its packed columns and
+ * postings on their own.
+ */
+void BM_UncompressedBytesPerTrip(benchmark::State &state)
+{
+    auto const &fixture{CachedSchedule(static_cast<std::size_t>(state.range(0)))};
+    auto const records{ToRecordViews(fixture.trips)};
+    std::size_t bytes{0U};
+
+    for (auto _ : state)
+    {
+        auto const before{AllocationCounter::LiveBytes()};
+        FlightTripDatabase database{};
+        database.BulkLoad(records);
+        bytes = AllocationCounter::LiveBytes() - before;
+        benchmark::DoNotOptimize(database);
+    }
+
+    state.counters["bytes_per_trip"] = static_cast<double>(bytes) / static_cast<double>(records.size());
+}
+
+void BM_CompressedBytesPerTrip(benchmark::State &state)
+{
+    auto const &fixture{CachedSchedule(static_cast<std::size_t>(state.range(0)))};
+    std::size_t bytes{0U};
+    std::size_t storage_bytes{0U};
+
+    for (auto _ : state)
+    {
+        auto const before{AllocationCounter::LiveBytes()};
+        CompressedFlightTripDatabase const compressed{fixture.database};
+        bytes = AllocationCounter::LiveBytes() - before;
+        storage_bytes = compressed.GetStorageBytes();
+        benchmark::DoNotOptimize(compressed);
+    }
+
+    auto const trips{static_cast<double>(fixture.trips.size())};
+    state.counters["bytes_per_trip"] = static_cast<double>(bytes) / trips;
+    state.counters["packed_bytes_per_trip"] = static_cast<double>(storage_bytes) / trips;
+}
+
+/**
+ * Query throughput on either layout: Query(database, trip) runs one
+ * query keyed by a probed trip of the schedule.
+ */
+template <typename Database, typename Query>
+void RunQueries(benchmark::State &state, const Database &database, Query query)
+{
+    auto const &fixture{CachedSchedule(static_cast<std::size_t>(state.range(0)))};
+    std::size_t index{0U};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(query(database, fixture.Probe(index++)));
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+template <typename Query>
+void RunOnBothLayouts(benchmark::State &state, bool compressed, Query query)
+{
+    auto const trip_count{static_cast<std::size_t>(state.range(0))};
+
+    if (compressed)
+    {
+        RunQueries(state, CachedCompressed(trip_count), query);
+    }
+    else
+    {
+        RunQueries(state, CachedSchedule(trip_count).database, query);
+    }
+}
+
+void BM_LayoutMinFareBetweenCities(benchmark::State &state)
+{
+    RunOnBothLayouts(state, state.range(1) != 0, [](auto const &database, const TripRecord &trip) {
+        return database.FindMinFareBetweenCities(trip.origin_city, trip.destination_city);
+    });
+}
+
+void BM_LayoutMaxFareByOperator(benchmark::State &state)
+{
+    RunOnBothLayouts(state, state.range(1) != 0, [](auto const &database, const TripRecord &trip) {
+        return database.FindMaxFareByOperator(trip.flight_operator);
+    });
+}
+
+void BM_LayoutFindFlightsByOriginCity(benchmark::State &state)
+{
+    RunOnBothLayouts(state, state.range(1) != 0, [](auto const &database, const TripRecord &trip) {
+        return database.FindFlightsByOriginCity(trip.origin_city).size();
+    });
+}
+
+// The live database keeps a running sum; the compressed one scans its fare column.
+void BM_LayoutAverageCostOfAllTrips(benchmark::State &state)
+{
+    RunOnBothLayouts(state, state.range(1) != 0, [](auto const &database, const TripRecord &) {
+        return database.FindAverageCostOfAllTrips();
+    });
+}
+
+const bool kRegistered{[] {
+    std::vector<std::pair<const char *, void (*)(benchmark::State &)>> const queries{
+        {"BM_Layout_FindMinFareBetweenCities", BM_LayoutMinFareBetweenCities},
+        {"BM_Layout_FindMaxFareByOperator", BM_LayoutMaxFareByOperator},
+        {"BM_Layout_FindFlightsByOriginCity", BM_LayoutFindFlightsByOriginCity},
+        {"BM_Layout_FindAverageCostOfAllTrips", BM_LayoutAverageCostOfAllTrips}};
+
+    // Size-major, so CachedSchedule and CachedCompressed build each size once.
+    for (std::int64_t size : kLayoutSizes)
+    {
+        benchmark::RegisterBenchmark("BM_Layout_UncompressedBytesPerTrip", BM_UncompressedBytesPerTrip)
+            ->Arg(size)
+            ->Iterations(1)
+            ->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark("BM_Layout_CompressedBytesPerTrip", BM_CompressedBytesPerTrip)
+            ->Arg(size)
+            ->Iterations(1)
+            ->Unit(benchmark::kMillisecond);
+
+        for (auto const &query : queries)
+        {
+            benchmark::RegisterBenchmark(query.first, query.second)
+                ->Args({size, 0})
+                ->Args({size, 1})
+                ->ArgNames({"trips", "compressed"});
+        }
+    }
+
+    return true;
+}()};
+
+} // namespace
+
+} // namespace flight_management
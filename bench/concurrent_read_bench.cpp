@@ -0,0 +1,134 @@
+#include "benchmark/benchmark.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "bench_data.h"
+#include "concurrent_flight_trip_database.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+constexpr std::size_t kTripCount{1U << 16U};
+
+const std::vector<TripRecord> &Trips()
+{
+    static const std::vector<TripRecord> trips{MakeTrips(kTripCount)};
+    return trips;
+}
+
+ConcurrentFlightTripDatabase &SharedDatabase()
+{
+    static ConcurrentFlightTripDatabase database{};
+    static std::once_flag loaded{};
+
+    std::call_once(loaded, []() {
+        std::vector<TripMutation> batch{};
+        for (auto const &trip : Trips())
+        {
+            batch.push_back(TripMutation::AddTrip(trip.flight_number, trip.origin_city, trip.destination_city,
+                                                  trip.flight_operator, trip.fare));
+        }
+        database.Publish(batch);
+    });
+
+    return database;
+}
+
+FlightTripDatabase &MutexDatabase()
+{
+    static FlightTripDatabase database{};
+    static std::once_flag loaded{};
+
+    std::call_once(loaded, []() {
+        for (auto const &trip : Trips())
+        {
+            database.AddTrip(trip.flight_number, trip.origin_city, trip.destination_city, trip.flight_operator,
+                             trip.fare);
+        }
+    });
+
+    return database;
+}
+
+std::mutex global_mutex{};
+
+template <typename Query>
+void RunReads(benchmark::State &state, Query query)
+{
+    auto const &trips{Trips()};
+    std::size_t index{static_cast<std::size_t>(state.thread_index()) * 7919U};
+
+    for (auto _ : state)
+    {
+        auto const &trip{trips[index++ % trips.size()]};
+        benchmark::DoNotOptimize(query(trip));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_SnapshotReads(benchmark::State &state)
+{
+    auto &database{SharedDatabase()};
+
+    RunReads(state, [&database](const TripRecord &trip) {
+        return database.FindMinFareBetweenCities(trip.origin_city, trip.destination_city);
+    });
+}
+
+void BM_SnapshotReadsWithFareFeed(benchmark::State &state)
+{
+    auto &database{SharedDatabase()};
+    std::atomic<bool> done{false};
+    std::thread feed{};
+
+    if (state.thread_index() == 0)
+    {
+        feed = std::thread{[&database, &done]() {
+            auto const &trips{Trips()};
+            for (std::size_t index = 0U; !done.load(std::memory_order_relaxed); ++index)
+            {
+                auto const &trip{trips[index % trips.size()]};
+                database.UpdateFareByTrip(trip.flight_number, trip.fare + static_cast<std::uint32_t>(index % 97U));
+            }
+        }};
+    }
+
+    RunReads(state, [&database](const TripRecord &trip) {
+        return database.FindMinFareBetweenCities(trip.origin_city, trip.destination_city);
+    });
+
+    if (feed.joinable())
+    {
+        done = true;
+        feed.join();
+    }
+}
+
+void BM_GlobalMutexReads(benchmark::State &state)
+{
+    auto &database{MutexDatabase()};
+
+    RunReads(state, [&database](const TripRecord &trip) {
+        std::lock_guard<std::mutex> lock{global_mutex};
+        return database.FindMinFareBetweenCities(trip.origin_city, trip.destination_city);
+    });
+}
+
+int MaxThreads()
+{
+    return static_cast<int>(std::max(2U, std::thread::hardware_concurrency()));
+}
+
+} // namespace
+
+BENCHMARK(BM_SnapshotReads)->ThreadRange(1, MaxThreads())->UseRealTime();
+BENCHMARK(BM_SnapshotReadsWithFareFeed)->ThreadRange(1, MaxThreads())->UseRealTime();
+BENCHMARK(BM_GlobalMutexReads)->ThreadRange(1, MaxThreads())->UseRealTime();
+
+} // namespace flight_management
@@ -0,0 +1,93 @@
+#include "benchmark/benchmark.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "bench_data.h"
+#include "flight_trip_database.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+FlightTripDatabase MakeDatabase(std::size_t count)
+{
+    FlightTripDatabase database{};
+
+    for (auto const &trip : MakeTrips(count))
+    {
+        database.AddTrip(trip.flight_number, trip.origin_city, trip.destination_city, trip.flight_operator,
+                         trip.fare);
+    }
+
+    return database;
+}
+
+/**
+ * Alternating -10% / +11% keeps fares in range across iterations.
+ */
+std::int32_t NextPercentage(std::size_t iteration)
+{
+    return (iteration % 2U == 0U) ? -10 : 11;
+}
+
+void BM_UpdateFareByTripLoop(benchmark::State &state)
+{
+    auto database{MakeDatabase(static_cast<std::size_t>(state.range(0)))};
+    std::vector<std::string> indigo_flights{};
+    std::size_t iteration{0U};
+
+    for (auto const &trip : MakeTrips(static_cast<std::size_t>(state.range(0))))
+    {
+        if (trip.flight_operator == "IndiGo")
+        {
+            indigo_flights.push_back(trip.flight_number);
+        }
+    }
+
+    for (auto _ : state)
+    {
+        FarePercentage const adjust{NextPercentage(iteration++)};
+        for (auto const &flight_number : indigo_flights)
+        {
+            auto const current{database.FindFlightsByNumber(flight_number)};
+            database.UpdateFareByTrip(flight_number, adjust(current->GetAirFare()));
+        }
+    }
+}
+
+void BM_UpdateFaresByOperator(benchmark::State &state)
+{
+    auto database{MakeDatabase(static_cast<std::size_t>(state.range(0)))};
+    std::size_t iteration{0U};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(database.UpdateFaresByOperator("IndiGo", NextPercentage(iteration++)));
+    }
+}
+
+void BM_UpdateFaresByOperators(benchmark::State &state)
+{
+    auto database{MakeDatabase(static_cast<std::size_t>(state.range(0)))};
+    std::size_t iteration{0U};
+
+    for (auto _ : state)
+    {
+        FarePercentage const adjust{NextPercentage(iteration++)};
+        std::vector<std::pair<std::string, FarePercentage>> const adjustments{
+            {"IndiGo", adjust}, {"SpiceJet", adjust}, {"Vistara", adjust}, {"Akasa Air", adjust}};
+        benchmark::DoNotOptimize(database.UpdateFaresByOperators(adjustments));
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_UpdateFareByTripLoop)->RangeMultiplier(8)->Range(1 << 12, 1 << 18)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_UpdateFaresByOperator)->RangeMultiplier(8)->Range(1 << 12, 1 << 18)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_UpdateFaresByOperators)->RangeMultiplier(8)->Range(1 << 12, 1 << 18)->Unit(benchmark::kMillisecond);
+
+} // namespace flight_management
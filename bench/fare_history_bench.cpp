@@ -0,0 +1,116 @@
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "allocation_counter.h"
+#include "bench_data.h"
+#include "flight_trip_database.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+constexpr std::size_t kHistoryTrips{10000U};
+constexpr std::size_t kHistoryUpdates{std::size_t{1U} << 18U};
+
+void LoadTrips(FlightTripDatabase &database, const std::vector<TripRecord> &trips)
+{
+    for (auto const &trip : trips)
+    {
+        database.AddTrip(trip.flight_number, trip.origin_city, trip.destination_city, trip.flight_operator, trip.fare);
+    }
+}
+
+void ApplyUpdates(FlightTripDatabase &database, const std::vector<TripRecord> &trips, std::size_t count)
+{
+    for (std::size_t index = 0U; index < count; ++index)
+    {
+        auto const &trip{trips[(index * 7919U) % trips.size()]};
+        database.UpdateFareByTrip(trip.flight_number, trip.fare + static_cast<std::uint32_t>(index % 97U));
+    }
+}
+
+/**
+ * Heap growth per fare update under a given retention window: bounded by
+ * the window, not by the number of updates applied.
+ */
+void BM_FareHistoryBytesPerUpdate(benchmark::State &state)
+{
+    auto const trips{MakeTrips(kHistoryTrips)};
+    std::size_t bytes{0U};
+
+    for (auto _ : state)
+    {
+        FlightTripDatabase database{};
+        database.SetFareHistoryRetention(static_cast<FareVersion>(state.range(0)));
+        LoadTrips(database, trips);
+
+        auto const before{AllocationCounter::LiveBytes()};
+        ApplyUpdates(database, trips, kHistoryUpdates);
+        bytes = AllocationCounter::LiveBytes() - before;
+        benchmark::DoNotOptimize(database);
+    }
+
+    state.counters["bytes_per_update"] = static_cast<double>(bytes) / static_cast<double>(kHistoryUpdates);
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kHistoryUpdates));
+}
+
+struct HistoryFixture
+{
+    HistoryFixture()
+        : trips{MakeTrips(kHistoryTrips)}
+    {
+        LoadTrips(database, trips);
+        ApplyUpdates(database, trips, kHistoryUpdates / 2U);
+        midpoint = database.GetFareVersion();
+        ApplyUpdates(database, trips, kHistoryUpdates / 2U);
+    }
+
+    std::vector<TripRecord> trips;
+    FlightTripDatabase database{};
+    FareVersion midpoint{0U};
+};
+
+const HistoryFixture &SharedHistory()
+{
+    static HistoryFixture const fixture{};
+    return fixture;
+}
+
+void BM_MinFareCurrentVersion(benchmark::State &state)
+{
+    auto const &fixture{SharedHistory()};
+    std::size_t index{0U};
+
+    for (auto _ : state)
+    {
+        auto const &trip{fixture.trips[index++ % fixture.trips.size()]};
+        benchmark::DoNotOptimize(fixture.database.FindMinFareBetweenCities(trip.origin_city, trip.destination_city));
+    }
+}
+
+// Reads half the updates back, through every trip's chain of later changes.
+void BM_MinFareAtVersion(benchmark::State &state)
+{
+    auto const &fixture{SharedHistory()};
+    std::size_t index{0U};
+
+    for (auto _ : state)
+    {
+        auto const &trip{fixture.trips[index++ % fixture.trips.size()]};
+        benchmark::DoNotOptimize(
+            fixture.database.FindMinFareBetweenCities(trip.origin_city, trip.destination_city, fixture.midpoint));
+    }
+}
+
+} // namespace
+
+// Argument: retention window in versions.
+BENCHMARK(BM_FareHistoryBytesPerUpdate)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20)->Iterations(1);
+BENCHMARK(BM_MinFareCurrentVersion);
+BENCHMARK(BM_MinFareAtVersion);
+
+} // namespace flight_management
@@ -0,0 +1,81 @@
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "bench_data.h"
+#include "flight_trip_database.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+constexpr std::size_t kTopK{10U};
+
+const FlightTripDatabase &Database()
+{
+    static const FlightTripDatabase database{[] {
+        FlightTripDatabase loaded{};
+        for (auto const &trip : MakeTrips(1U << 20U))
+        {
+            loaded.AddTrip(trip.flight_number, trip.origin_city, trip.destination_city, trip.flight_operator,
+                           trip.fare);
+        }
+        return loaded;
+    }()};
+
+    return database;
+}
+
+// The client-side baseline: every flight of the city, then filter and sort.
+void BM_TopKByFilteringOrigin(benchmark::State &state)
+{
+    auto const &database{Database()};
+
+    for (auto _ : state)
+    {
+        auto flights{database.FindFlightsByOriginCity("Pune")};
+        std::size_t const count{std::min(kTopK, flights.size())};
+        std::partial_sort(flights.begin(), flights.begin() + static_cast<std::ptrdiff_t>(count), flights.end(),
+                          [](const FlightData &lhs, const FlightData &rhs) { return lhs.GetAirFare() < rhs.GetAirFare(); });
+        flights.resize(count);
+        benchmark::DoNotOptimize(flights.data());
+    }
+}
+
+void BM_TopKFromFareIndex(benchmark::State &state)
+{
+    auto const &database{Database()};
+
+    for (auto _ : state)
+    {
+        auto const flights{database.FindTopKCheapest("Pune", kTopK)};
+        benchmark::DoNotOptimize(flights.data());
+    }
+}
+
+void BM_FareRangeFromFareIndex(benchmark::State &state)
+{
+    auto const &database{Database()};
+    std::size_t returned{0U};
+
+    for (auto _ : state)
+    {
+        auto const flights{database.FindFlightsByOriginInFareRange("Pune", 5000U,
+                                                                   5000U + static_cast<std::uint32_t>(state.range(0)))};
+        returned = flights.size();
+        benchmark::DoNotOptimize(flights.data());
+    }
+
+    state.counters["flights_returned"] = static_cast<double>(returned);
+}
+
+} // namespace
+
+BENCHMARK(BM_TopKByFilteringOrigin)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TopKFromFareIndex)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FareRangeFromFareIndex)->Arg(10)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+} // namespace flight_management
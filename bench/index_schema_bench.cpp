@@ -0,0 +1,95 @@
+#include "benchmark/benchmark.h"
+
+#include "allocation_counter.h"
+#include "bench_data.h"
+#include "flight_trip_database.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+template <typename Database>
+void BM_InsertTrips(benchmark::State &state)
+{
+    auto const trips{MakeTrips(static_cast<std::size_t>(state.range(0)))};
+    double heap_bytes{0.0};
+
+    for (auto _ : state)
+    {
+        auto const heap_before{AllocationCounter::LiveBytes()};
+
+        Database database{};
+        for (auto const &trip : trips)
+        {
+            database.AddTrip(trip.flight_number, trip.origin_city, trip.destination_city, trip.flight_operator,
+                             trip.fare);
+        }
+
+        heap_bytes = static_cast<double>(AllocationCounter::LiveBytes() - heap_before);
+        benchmark::DoNotOptimize(database.GetTripCount());
+    }
+
+    state.counters["heap_bytes_per_trip"] = heap_bytes / static_cast<double>(trips.size());
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+template <typename Database>
+void BM_UpdateFares(benchmark::State &state)
+{
+    auto const trips{MakeTrips(static_cast<std::size_t>(state.range(0)))};
+
+    Database database{};
+    for (auto const &trip : trips)
+    {
+        database.AddTrip(trip.flight_number, trip.origin_city, trip.destination_city, trip.flight_operator,
+                         trip.fare);
+    }
+
+    std::size_t next{0U};
+
+    for (auto _ : state)
+    {
+        auto const &trip{trips[next]};
+        benchmark::DoNotOptimize(database.UpdateFareByTrip(trip.flight_number, trip.fare + 1U));
+        next = (next + 1U) % trips.size();
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+template <typename Database>
+void BM_RouteQuery(benchmark::State &state)
+{
+    auto const trips{MakeTrips(static_cast<std::size_t>(state.range(0)))};
+
+    Database database{};
+    for (auto const &trip : trips)
+    {
+        database.AddTrip(trip.flight_number, trip.origin_city, trip.destination_city, trip.flight_operator,
+                         trip.fare);
+    }
+
+    std::size_t next{0U};
+
+    for (auto _ : state)
+    {
+        auto const &trip{trips[next]};
+        benchmark::DoNotOptimize(database.FindMinFareBetweenCities(trip.origin_city, trip.destination_city));
+        next = (next + 1U) % trips.size();
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_InsertTrips, MinimalFlightTripDatabase)->Arg(1 << 16)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_InsertTrips, FlightTripDatabase)->Arg(1 << 16)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_UpdateFares, MinimalFlightTripDatabase)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_UpdateFares, FlightTripDatabase)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_RouteQuery, MinimalFlightTripDatabase)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_RouteQuery, FlightTripDatabase)->Arg(1 << 16);
+
+} // namespace flight_management
@@ -0,0 +1,21 @@
+#include "benchmark/benchmark.h"
+
+#include "database_stats.h"
+#include "git_revision.h"
+
+int main(int argc, char *argv[])
+{
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+
+    // Recorded in the JSON context, so saved results say which commit and build produced them.
+    ::benchmark::AddCustomContext("git_revision", FLIGHT_MANAGEMENT_GIT_REVISION);
+    ::benchmark::AddCustomContext("stats_enabled", flight_management::kStatsEnabled ? "true" : "false");
+
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,82 @@
+#include "benchmark/benchmark.h"
+
+#include <map>
+#include <string>
+
+#include "allocation_counter.h"
+#include "bench_data.h"
+#include "flight_trip_database.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+/**
+ * The original storage layout: one map node and four strings per trip,
+ * plus one flight-number copy per secondary multimap.
+ */
+struct LegacyMapLayout
+{
+    void Add(const TripRecord &trip)
+    {
+        flights.emplace(std::piecewise_construct, std::forward_as_tuple(trip.flight_number),
+                        std::forward_as_tuple(trip.flight_number, trip.origin_city, trip.destination_city,
+                                              trip.flight_operator, trip.fare));
+        origin.emplace(trip.origin_city, trip.flight_number);
+        destination.emplace(trip.destination_city, trip.flight_number);
+        flight_operator.emplace(trip.flight_operator, trip.flight_number);
+    }
+
+    std::map<std::string, FlightData> flights;
+    std::multimap<std::string, std::string> origin;
+    std::multimap<std::string, std::string> destination;
+    std::multimap<std::string, std::string> flight_operator;
+};
+
+template <typename Layout, typename AddFunction>
+void MeasureBytesPerTrip(benchmark::State &state, AddFunction add)
+{
+    auto const trips{MakeTrips(static_cast<std::size_t>(state.range(0)))};
+    std::size_t bytes{0U};
+
+    for (auto _ : state)
+    {
+        auto const before{AllocationCounter::LiveBytes()};
+        {
+            Layout layout{};
+            for (auto const &trip : trips)
+            {
+                add(layout, trip);
+            }
+            bytes = AllocationCounter::LiveBytes() - before;
+            benchmark::DoNotOptimize(layout);
+        }
+    }
+
+    state.counters["bytes_per_trip"] = static_cast<double>(bytes) / static_cast<double>(trips.size());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_LegacyMapLayoutBytesPerTrip(benchmark::State &state)
+{
+    MeasureBytesPerTrip<LegacyMapLayout>(state, [](LegacyMapLayout &layout, const TripRecord &trip) {
+        layout.Add(trip);
+    });
+}
+
+void BM_ColumnarLayoutBytesPerTrip(benchmark::State &state)
+{
+    MeasureBytesPerTrip<FlightTripDatabase>(state, [](FlightTripDatabase &database, const TripRecord &trip) {
+        database.AddTrip(trip.flight_number, trip.origin_city, trip.destination_city, trip.flight_operator,
+                         trip.fare);
+    });
+}
+
+} // namespace
+
+BENCHMARK(BM_LegacyMapLayoutBytesPerTrip)->RangeMultiplier(16)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ColumnarLayoutBytesPerTrip)->RangeMultiplier(16)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMillisecond);
+
+} // namespace flight_management
@@ -0,0 +1,95 @@
+#include "benchmark/benchmark.h"
+
+#include <fstream>
+#include <memory_resource>
+
+#include "allocation_counter.h"
+#include "bench_data.h"
+#include "flight_trip_database.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+enum class MemoryMode : int
+{
+    kDefaultHeap = 0,
+    kPool = 1,
+    kMonotonicArena = 2
+};
+
+std::size_t ResidentBytes()
+{
+    std::size_t pages{0U};
+    std::size_t resident{0U};
+
+    std::ifstream statm{"/proc/self/statm"};
+    statm >> pages >> resident;
+
+    return resident * 4096U;
+}
+
+template <typename Fill>
+void MeasureInsert(benchmark::State &state, Fill fill)
+{
+    auto const trips{MakeTrips(static_cast<std::size_t>(state.range(1)))};
+    auto const mode{static_cast<MemoryMode>(state.range(0))};
+    double heap_bytes{0.0};
+    double resident_bytes{0.0};
+
+    for (auto _ : state)
+    {
+        auto const heap_before{AllocationCounter::LiveBytes()};
+        auto const resident_before{ResidentBytes()};
+
+        std::pmr::unsynchronized_pool_resource pool{};
+        auto database{(mode == MemoryMode::kMonotonicArena) ? FlightTripDatabase::WithMonotonicArena()
+                      : (mode == MemoryMode::kPool)         ? FlightTripDatabase{&pool}
+                                                            : FlightTripDatabase{}};
+        fill(database, trips);
+
+        heap_bytes = static_cast<double>(AllocationCounter::LiveBytes() - heap_before);
+        resident_bytes = static_cast<double>(ResidentBytes()) - static_cast<double>(resident_before);
+        benchmark::DoNotOptimize(database.GetTripCount());
+    }
+
+    state.counters["heap_bytes_per_trip"] = heap_bytes / static_cast<double>(trips.size());
+    state.counters["rss_delta_mb"] = resident_bytes / (1024.0 * 1024.0);
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(1));
+}
+
+void BM_InsertTrips(benchmark::State &state)
+{
+    MeasureInsert(state, [](FlightTripDatabase &database, const std::vector<TripRecord> &trips) {
+        for (auto const &trip : trips)
+        {
+            database.AddTrip(trip.flight_number, trip.origin_city, trip.destination_city, trip.flight_operator,
+                             trip.fare);
+        }
+    });
+}
+
+void BM_BulkLoadTrips(benchmark::State &state)
+{
+    MeasureInsert(state, [](FlightTripDatabase &database, const std::vector<TripRecord> &trips) {
+        std::vector<TripRecordView> records{};
+        records.reserve(trips.size());
+
+        for (auto const &trip : trips)
+        {
+            records.push_back(TripRecordView{trip.flight_number, trip.origin_city, trip.destination_city,
+                                             trip.flight_operator, trip.fare});
+        }
+
+        database.BulkLoad(records);
+    });
+}
+
+} // namespace
+
+BENCHMARK(BM_InsertTrips)->ArgsProduct({{0, 1, 2}, {1 << 16, 1 << 20}})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BulkLoadTrips)->ArgsProduct({{0, 1, 2}, {1 << 20}})->Unit(benchmark::kMillisecond);
+
+} // namespace flight_management
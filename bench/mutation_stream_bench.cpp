@@ -0,0 +1,85 @@
+#include "benchmark/benchmark.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "bench_data.h"
+#include "flight_trip_database.h"
+#include "mutation_stream.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+constexpr std::size_t kStreamTrips{1U << 16U};
+constexpr std::size_t kConsumerBatch{256U};
+
+/**
+ * Fare updates on a loaded database, with the argument's number of
+ * blocking consumers each mirroring fares into its own cache. -1 runs
+ * with no stream attached at all.
+ */
+void BM_MutationStreamThroughput(benchmark::State &state)
+{
+    auto const trips{MakeTrips(kStreamTrips)};
+    FlightTripDatabase database{};
+    for (auto const &trip : trips)
+    {
+        database.AddTrip(trip.flight_number, trip.origin_city, trip.destination_city, trip.flight_operator, trip.fare);
+    }
+
+    MutationStream stream{};
+    std::atomic<bool> stopping{false};
+    std::vector<std::thread> consumers{};
+
+    for (std::int64_t consumer = 0; consumer < state.range(0); ++consumer)
+    {
+        consumers.emplace_back([&stream, &stopping, subscription = *stream.Subscribe(OverflowPolicy::kBlock)]() mutable {
+            std::unordered_map<std::string, std::uint32_t> fares{};
+
+            while (!stopping.load(std::memory_order_relaxed) || subscription.GetLag() != 0U)
+            {
+                if (subscription.Consume(kConsumerBatch,
+                                         [&fares](const TripMutation &mutation) {
+                                             fares[mutation.flight_number] = mutation.fare;
+                                         }) == 0U)
+                {
+                    std::this_thread::yield();
+                }
+            }
+            benchmark::DoNotOptimize(fares);
+        });
+    }
+
+    if (state.range(0) >= 0)
+    {
+        database.SetMutationStream(&stream);
+    }
+
+    std::size_t index{0U};
+    for (auto _ : state)
+    {
+        auto const &trip{trips[index % trips.size()]};
+        benchmark::DoNotOptimize(
+            database.UpdateFareByTrip(trip.flight_number, trip.fare + static_cast<std::uint32_t>(index++ & 1U)));
+    }
+
+    stopping.store(true, std::memory_order_relaxed);
+    for (auto &consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+} // namespace
+
+BENCHMARK(BM_MutationStreamThroughput)->Arg(-1)->Arg(0)->Arg(1)->Arg(4)->ArgName("consumers")->UseRealTime();
+
+} // namespace flight_management
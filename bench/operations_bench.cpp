@@ -0,0 +1,224 @@
+#include "benchmark/benchmark.h"
+
+#include <array>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "schedule_generator.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+// 1k to 10M trips. Every operation runs at one size before the next is built.
+constexpr std::array<std::int64_t, 5> kScheduleSizes{1000, 10000, 100000, 1000000, 10000000};
+
+void BM_AddThenRemoveTrip(benchmark::State &state)
+{
+    auto &fixture{CachedSchedule(static_cast<std::size_t>(state.range(0)))};
+    std::size_t index{0U};
+
+    // Numbers outside the schedule, so the add never revives one of its tombstones. The pool
+    // is fixed, so the shared schedule gains at most kProbeCount rows however long this runs.
+    std::vector<std::string> flight_numbers(ScheduleFixture::kProbeCount);
+    for (std::size_t number = 0U; number < flight_numbers.size(); ++number)
+    {
+        flight_numbers[number] = "Bench-" + std::to_string(number);
+    }
+
+    for (auto _ : state)
+    {
+        auto const &trip{fixture.Probe(index)};
+        const std::string &flight_number{flight_numbers[index++ % flight_numbers.size()]};
+        benchmark::DoNotOptimize(fixture.database.AddTrip(flight_number, trip.origin_city, trip.destination_city,
+                                                          trip.flight_operator, trip.fare));
+        benchmark::DoNotOptimize(fixture.database.RemoveTrip(flight_number));
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * 2);
+}
+
+void BM_BulkLoad(benchmark::State &state)
+{
+    auto const &fixture{CachedSchedule(static_cast<std::size_t>(state.range(0)))};
+    auto const records{ToRecordViews(fixture.trips)};
+
+    for (auto _ : state)
+    {
+        FlightTripDatabase database{};
+        benchmark::DoNotOptimize(database.BulkLoad(records));
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_UpdateFareByTrip(benchmark::State &state)
+{
+    auto &fixture{CachedSchedule(static_cast<std::size_t>(state.range(0)))};
+    std::size_t index{0U};
+
+    // Alternates each trip between its fare and fare + 1, leaving the schedule as it was.
+    for (auto _ : state)
+    {
+        auto const &trip{fixture.Probe(index)};
+        std::uint32_t const bump{(index++ / ScheduleFixture::kProbeCount) % 2U == 0U ? 1U : 0U};
+        benchmark::DoNotOptimize(fixture.database.UpdateFareByTrip(trip.flight_number, trip.fare + bump));
+    }
+}
+
+void BM_UpdateFaresByOperator(benchmark::State &state)
+{
+    auto &fixture{CachedSchedule(static_cast<std::size_t>(state.range(0)))};
+    std::size_t index{0U};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(fixture.database.UpdateFaresByOperator(
+            fixture.Probe(index++).flight_operator, [](std::uint32_t fare) { return fare ^ 1U; }));
+    }
+}
+
+void BM_FindFlightsByNumber(benchmark::State &state)
+{
+    auto const &fixture{CachedSchedule(static_cast<std::size_t>(state.range(0)))};
+    std::size_t index{0U};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(fixture.database.FindFlightsByNumber(fixture.Probe(index++).flight_number));
+    }
+}
+
+void BM_IsTripInDatabase(benchmark::State &state)
+{
+    auto const &fixture{CachedSchedule(static_cast<std::size_t>(state.range(0)))};
+    std::size_t index{0U};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(fixture.database.IsTripInDatabase(fixture.Probe(index++).flight_number));
+    }
+}
+
+void BM_FindFlightsByOriginCity(benchmark::State &state)
+{
+    auto const &fixture{CachedSchedule(static_cast<std::size_t>(state.range(0)))};
+    std::size_t index{0U};
+    std::size_t rows{0U};
+
+    for (auto _ : state)
+    {
+        rows += fixture.database.FindFlightsByOriginCity(fixture.Probe(index++).origin_city).size();
+    }
+
+    state.counters["rows_per_call"] = benchmark::Counter(static_cast<double>(rows), benchmark::Counter::kAvgIterations);
+}
+
+void BM_FindMinFareBetweenCities(benchmark::State &state)
+{
+    auto const &fixture{CachedSchedule(static_cast<std::size_t>(state.range(0)))};
+    std::size_t index{0U};
+
+    for (auto _ : state)
+    {
+        auto const &trip{fixture.Probe(index++)};
+        benchmark::DoNotOptimize(fixture.database.FindMinFareBetweenCities(trip.origin_city, trip.destination_city));
+    }
+}
+
+void BM_FindMaxFareByOperator(benchmark::State &state)
+{
+    auto const &fixture{CachedSchedule(static_cast<std::size_t>(state.range(0)))};
+    std::size_t index{0U};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(fixture.database.FindMaxFareByOperator(fixture.Probe(index++).flight_operator));
+    }
+}
+
+void BM_FindAverageCostOfAllTrips(benchmark::State &state)
+{
+    auto const &fixture{CachedSchedule(static_cast<std::size_t>(state.range(0)))};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(fixture.database.FindAverageCostOfAllTrips());
+    }
+}
+
+void BM_FindTopKCheapest(benchmark::State &state)
+{
+    auto const &fixture{CachedSchedule(static_cast<std::size_t>(state.range(0)))};
+    std::size_t index{0U};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(fixture.database.FindTopKCheapest(fixture.Probe(index++).origin_city, 10U));
+    }
+}
+
+void BM_FindFlightsByOriginInFareRange(benchmark::State &state)
+{
+    auto const &fixture{CachedSchedule(static_cast<std::size_t>(state.range(0)))};
+    std::size_t index{0U};
+
+    for (auto _ : state)
+    {
+        auto const &trip{fixture.Probe(index++)};
+        benchmark::DoNotOptimize(
+            fixture.database.FindFlightsByOriginInFareRange(trip.origin_city, trip.fare, trip.fare + 100U));
+    }
+}
+
+void BM_FindCheapestItinerary(benchmark::State &state)
+{
+    auto const &fixture{CachedSchedule(static_cast<std::size_t>(state.range(0)))};
+    std::size_t index{0U};
+
+    for (auto _ : state)
+    {
+        auto const &trip{fixture.Probe(index)};
+        auto const &other{fixture.Probe(index++ + 1U)};
+        benchmark::DoNotOptimize(fixture.database.FindCheapestItinerary(trip.origin_city, other.destination_city, 1U));
+    }
+}
+
+const bool kRegistered{[] {
+    std::vector<std::pair<const char *, void (*)(benchmark::State &)>> const operations{
+        {"BM_Schedule_AddThenRemoveTrip", BM_AddThenRemoveTrip},
+        {"BM_Schedule_BulkLoad", BM_BulkLoad},
+        {"BM_Schedule_UpdateFareByTrip", BM_UpdateFareByTrip},
+        {"BM_Schedule_UpdateFaresByOperator", BM_UpdateFaresByOperator},
+        {"BM_Schedule_FindFlightsByNumber", BM_FindFlightsByNumber},
+        {"BM_Schedule_IsTripInDatabase", BM_IsTripInDatabase},
+        {"BM_Schedule_FindFlightsByOriginCity", BM_FindFlightsByOriginCity},
+        {"BM_Schedule_FindMinFareBetweenCities", BM_FindMinFareBetweenCities},
+        {"BM_Schedule_FindMaxFareByOperator", BM_FindMaxFareByOperator},
+        {"BM_Schedule_FindAverageCostOfAllTrips", BM_FindAverageCostOfAllTrips},
+        {"BM_Schedule_FindTopKCheapest", BM_FindTopKCheapest},
+        {"BM_Schedule_FindFlightsByOriginInFareRange", BM_FindFlightsByOriginInFareRange},
+        {"BM_Schedule_FindCheapestItinerary", BM_FindCheapestItinerary}};
+
+    // Size-major, so CachedSchedule builds each size once.
+    for (std::int64_t size : kScheduleSizes)
+    {
+        for (auto const &operation : operations)
+        {
+            auto *const benchmark{benchmark::RegisterBenchmark(operation.first, operation.second)->Arg(size)};
+            if (size >= 1000000)
+            {
+                benchmark->Unit(benchmark::kMicrosecond);
+            }
+        }
+    }
+
+    return true;
+}()};
+
+} // namespace
+
+} // namespace flight_management
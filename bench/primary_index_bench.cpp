@@ -0,0 +1,131 @@
+#include "benchmark/benchmark.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "schedule_generator.h"
+#include "string_interner.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+/**
+ * Flight numbers held in three primary indexes: the interner's flat
+ * table, the node-based hash map it replaced and the original ordered
+ * map. Probes visit the keys in a shuffled order, so lookups miss cache.
+ */
+struct PrimaryIndexFixture
+{
+    explicit PrimaryIndexFixture(std::size_t key_count)
+    {
+        keys.reserve(key_count);
+        for (std::size_t index = 0U; index < key_count; ++index)
+        {
+            keys.push_back("FL-" + std::to_string(index));
+        }
+
+        ScheduleRandom random{key_count};
+        probes.reserve(kProbeCount);
+        for (std::size_t index = 0U; index < kProbeCount; ++index)
+        {
+            probes.push_back(keys[random.Next() % key_count]);
+        }
+
+        node_hash.reserve(key_count);
+        for (std::size_t index = 0U; index < key_count; ++index)
+        {
+            flat.Intern(keys[index]);
+            node_hash.emplace(keys[index], static_cast<InternId>(index));
+            ordered.emplace(keys[index], static_cast<InternId>(index));
+        }
+    }
+
+    static constexpr std::size_t kProbeCount{std::size_t{1U} << 16U};
+
+    std::vector<std::string> keys{};
+    std::vector<std::string> probes{};
+    StringInterner flat{};
+    std::unordered_map<std::string_view, InternId> node_hash{};
+    std::map<std::string_view, InternId> ordered{};
+};
+
+const PrimaryIndexFixture &CachedPrimaryIndex(std::size_t key_count)
+{
+    static std::unique_ptr<PrimaryIndexFixture> fixture{};
+
+    if (!fixture || fixture->keys.size() != key_count)
+    {
+        fixture.reset();
+        fixture = std::make_unique<PrimaryIndexFixture>(key_count);
+    }
+
+    return *fixture;
+}
+
+template <typename Lookup>
+void RunLookups(benchmark::State &state, Lookup lookup)
+{
+    auto const &fixture{CachedPrimaryIndex(static_cast<std::size_t>(state.range(0)))};
+    std::size_t index{0U};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(lookup(fixture, fixture.probes[index++ % PrimaryIndexFixture::kProbeCount]));
+    }
+}
+
+void BM_PrimaryIndexFlatHit(benchmark::State &state)
+{
+    RunLookups(state, [](const PrimaryIndexFixture &fixture, const std::string &key) { return fixture.flat.Find(key); });
+}
+
+void BM_PrimaryIndexFlatMiss(benchmark::State &state)
+{
+    RunLookups(state, [](const PrimaryIndexFixture &fixture, const std::string &key) {
+        return fixture.flat.Find(std::string_view{key}.substr(1U));
+    });
+}
+
+void BM_PrimaryIndexNodeHashHit(benchmark::State &state)
+{
+    RunLookups(state, [](const PrimaryIndexFixture &fixture, const std::string &key) {
+        return fixture.node_hash.find(key)->second;
+    });
+}
+
+void BM_PrimaryIndexOrderedMapHit(benchmark::State &state)
+{
+    RunLookups(state, [](const PrimaryIndexFixture &fixture, const std::string &key) {
+        return fixture.ordered.find(key)->second;
+    });
+}
+
+const bool kRegistered{[] {
+    std::vector<std::pair<const char *, void (*)(benchmark::State &)>> const lookups{
+        {"BM_PrimaryIndexFlatHit", BM_PrimaryIndexFlatHit},
+        {"BM_PrimaryIndexFlatMiss", BM_PrimaryIndexFlatMiss},
+        {"BM_PrimaryIndexNodeHashHit", BM_PrimaryIndexNodeHashHit},
+        {"BM_PrimaryIndexOrderedMapHit", BM_PrimaryIndexOrderedMapHit}};
+
+    // Size-major, so CachedPrimaryIndex builds each size once.
+    for (std::int64_t size : {1000000, 10000000})
+    {
+        for (auto const &lookup : lookups)
+        {
+            benchmark::RegisterBenchmark(lookup.first, lookup.second)->Arg(size);
+        }
+    }
+
+    return true;
+}()};
+
+} // namespace
+
+} // namespace flight_management
@@ -0,0 +1,115 @@
+#include "benchmark/benchmark.h"
+
+#include <vector>
+
+#include "bench_data.h"
+#include "flight_trip_database.h"
+#include "query_batch.h"
+#include "work_stealing_thread_pool.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+const FlightTripDatabase &Database()
+{
+    static const FlightTripDatabase database{[] {
+        FlightTripDatabase loaded{};
+        for (auto const &trip : MakeTrips(1U << 18U))
+        {
+            loaded.AddTrip(trip.flight_number, trip.origin_city, trip.destination_city, trip.flight_operator,
+                           trip.fare);
+        }
+        return loaded;
+    }()};
+
+    return database;
+}
+
+// A page render's worth of lookups: mostly route fares, some operators, many repeats.
+QueryBatch MakePageBatch(std::size_t size)
+{
+    auto const trips{MakeTrips(size)};
+    QueryBatch batch{};
+
+    for (std::size_t index = 0U; index < trips.size(); ++index)
+    {
+        if (index % 4U == 3U)
+        {
+            batch.AddMaxFareByOperator(trips[index].flight_operator);
+        }
+        else
+        {
+            batch.AddMinFareBetweenCities(trips[index].origin_city, trips[index].destination_city);
+        }
+    }
+
+    return batch;
+}
+
+void BM_OneCallPerQuery(benchmark::State &state)
+{
+    auto const &database{Database()};
+    QueryBatch const batch{MakePageBatch(static_cast<std::size_t>(state.range(0)))};
+
+    for (auto _ : state)
+    {
+        std::vector<std::uint32_t> results{};
+        results.reserve(batch.Size());
+
+        for (std::size_t position = 0U; position < batch.Size(); ++position)
+        {
+            auto const &query{batch[position]};
+            results.push_back(query.kind == QueryKind::kMinFareBetweenCities
+                                  ? database.FindMinFareBetweenCities(query.first, query.second)
+                                  : database.FindMaxFareByOperator(query.first));
+        }
+        benchmark::DoNotOptimize(results.data());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_ExecuteBatch(benchmark::State &state)
+{
+    auto const &database{Database()};
+    QueryBatch const batch{MakePageBatch(static_cast<std::size_t>(state.range(0)))};
+    WorkStealingThreadPool pool{static_cast<std::size_t>(state.range(1))};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(database.ExecuteBatch(batch, pool).data());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+// Building the batch each time, for a page whose queries change on every render.
+void BM_BuildAndExecuteBatch(benchmark::State &state)
+{
+    auto const &database{Database()};
+    auto const trips{MakeTrips(static_cast<std::size_t>(state.range(0)))};
+    WorkStealingThreadPool pool{2U};
+
+    for (auto _ : state)
+    {
+        QueryBatch batch{};
+        for (auto const &trip : trips)
+        {
+            batch.AddMinFareBetweenCities(trip.origin_city, trip.destination_city);
+        }
+        benchmark::DoNotOptimize(database.ExecuteBatch(batch, pool).data());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_OneCallPerQuery)->Arg(256)->Arg(4096)->Arg(65536)->UseRealTime();
+BENCHMARK(BM_ExecuteBatch)->ArgsProduct({{256, 4096, 65536}, {0, 2, 4}})->UseRealTime();
+BENCHMARK(BM_BuildAndExecuteBatch)->Arg(256)->Arg(4096)->UseRealTime();
+
+} // namespace flight_management
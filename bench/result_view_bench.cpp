@@ -0,0 +1,101 @@
+#include "benchmark/benchmark.h"
+
+#include "allocation_counter.h"
+#include "bench_data.h"
+#include "flight_trip_database.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+FlightTripDatabase MakeDatabase(std::size_t count)
+{
+    FlightTripDatabase database{};
+    auto const trips{MakeTrips(count)};
+
+    for (auto const &trip : trips)
+    {
+        database.AddTrip(trip.flight_number, trip.origin_city, trip.destination_city, trip.flight_operator, trip.fare);
+    }
+
+    return database;
+}
+
+void BM_FindFlightsByOriginCity(benchmark::State &state)
+{
+    auto const database{MakeDatabase(static_cast<std::size_t>(state.range(0)))};
+    auto const before{AllocationCounter::Allocations()};
+
+    for (auto _ : state)
+    {
+        std::uint64_t fare_sum{0U};
+        for (auto const &flight : database.FindFlightsByOriginCity("Delhi"))
+        {
+            fare_sum += flight.GetAirFare();
+        }
+        benchmark::DoNotOptimize(fare_sum);
+    }
+
+    state.counters["allocations_per_query"] = static_cast<double>(AllocationCounter::Allocations() - before) /
+                                              static_cast<double>(state.iterations());
+}
+
+void BM_ViewFlightsByOriginCity(benchmark::State &state)
+{
+    auto const database{MakeDatabase(static_cast<std::size_t>(state.range(0)))};
+    auto const before{AllocationCounter::Allocations()};
+
+    for (auto _ : state)
+    {
+        std::uint64_t fare_sum{0U};
+        for (TripView const trip : database.ViewFlightsByOriginCity("Delhi"))
+        {
+            fare_sum += trip.GetAirFare();
+        }
+        benchmark::DoNotOptimize(fare_sum);
+    }
+
+    state.counters["allocations_per_query"] = static_cast<double>(AllocationCounter::Allocations() - before) /
+                                              static_cast<double>(state.iterations());
+}
+
+void BM_FindFlightsByNumber(benchmark::State &state)
+{
+    auto const database{MakeDatabase(static_cast<std::size_t>(state.range(0)))};
+    std::string const flight_number{"FL-42"};
+    auto const before{AllocationCounter::Allocations()};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(database.FindFlightsByNumber(flight_number));
+    }
+
+    state.counters["allocations_per_query"] = static_cast<double>(AllocationCounter::Allocations() - before) /
+                                              static_cast<double>(state.iterations());
+}
+
+void BM_ViewFlightByNumber(benchmark::State &state)
+{
+    auto const database{MakeDatabase(static_cast<std::size_t>(state.range(0)))};
+    std::string const flight_number{"FL-42"};
+    auto const before{AllocationCounter::Allocations()};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(database.ViewFlightByNumber(flight_number)->GetAirFare());
+    }
+
+    state.counters["allocations_per_query"] = static_cast<double>(AllocationCounter::Allocations() - before) /
+                                              static_cast<double>(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(BM_FindFlightsByOriginCity)->Arg(1 << 12)->Arg(1 << 16);
+BENCHMARK(BM_ViewFlightsByOriginCity)->Arg(1 << 12)->Arg(1 << 16);
+BENCHMARK(BM_FindFlightsByNumber)->Arg(1 << 16);
+BENCHMARK(BM_ViewFlightByNumber)->Arg(1 << 16);
+
+} // namespace flight_management
@@ -0,0 +1,113 @@
+#include "benchmark/benchmark.h"
+
+#include <utility>
+#include <vector>
+
+#include "route_graph.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+constexpr InternId kCities{5000U};
+constexpr std::size_t kRoutes{100000U};
+
+std::uint32_t NextRandom(std::uint32_t &state)
+{
+    state ^= state << 13U;
+    state ^= state >> 17U;
+    state ^= state << 5U;
+    return state;
+}
+
+// 100k routes over 5k cities, with a fare that grows with the hop distance.
+const RouteGraph &Graph()
+{
+    static const RouteGraph graph{[] {
+        RouteGraph built{};
+        std::uint32_t state{2463534242U};
+
+        for (std::size_t route = 0U; route < kRoutes; ++route)
+        {
+            auto const origin{NextRandom(state) % kCities};
+            auto const destination{(origin + 1U + NextRandom(state) % (kCities - 1U)) % kCities};
+            built.SetEdge(origin, destination, FareEntry{1500U + NextRandom(state) % 15000U, static_cast<TripId>(route)});
+        }
+        built.Rebuild();
+
+        return built;
+    }()};
+
+    return graph;
+}
+
+std::vector<std::pair<InternId, InternId>> MakeQueries(std::size_t count)
+{
+    std::vector<std::pair<InternId, InternId>> queries{};
+    std::uint32_t state{88172645U};
+
+    for (std::size_t query = 0U; query < count; ++query)
+    {
+        queries.emplace_back(NextRandom(state) % kCities, NextRandom(state) % kCities);
+    }
+
+    return queries;
+}
+
+void BM_CheapestPath(benchmark::State &state)
+{
+    auto const &graph{Graph()};
+    auto const queries{MakeQueries(256U)};
+    std::size_t next{0U};
+
+    for (auto _ : state)
+    {
+        auto const &query{queries[next]};
+        benchmark::DoNotOptimize(graph.FindCheapestPath(query.first, query.second, static_cast<std::size_t>(state.range(0))));
+        next = (next + 1U) % queries.size();
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+void BM_CheapestPathsBatch(benchmark::State &state)
+{
+    auto const &graph{Graph()};
+    auto const queries{MakeQueries(1024U)};
+    // The calling thread searches too, so range(0) threads take range(0) - 1 workers.
+    WorkStealingThreadPool pool{static_cast<std::size_t>(state.range(0)) - 1U};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(graph.FindCheapestPaths(queries, 3U, pool));
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * queries.size()));
+}
+
+void BM_EdgeUpdate(benchmark::State &state)
+{
+    RouteGraph graph{Graph()};
+    auto const queries{MakeQueries(4096U)};
+    std::size_t next{0U};
+
+    for (auto _ : state)
+    {
+        auto const &route{queries[next]};
+        graph.SetEdge(route.first, route.second,
+                      (next % 4U != 0U) ? std::make_optional(FareEntry{2000U, static_cast<TripId>(next)}) : std::nullopt);
+        next = (next + 1U) % queries.size();
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+} // namespace
+
+BENCHMARK(BM_CheapestPath)->DenseRange(1, 3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CheapestPathsBatch)->RangeMultiplier(2)->Range(1, 8)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_EdgeUpdate);
+
+} // namespace flight_management
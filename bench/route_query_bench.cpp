@@ -0,0 +1,78 @@
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "bench_data.h"
+#include "flight_trip_database.h"
+#include "postings_intersection.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+std::vector<TripId> MakePostings(std::size_t count, TripId stride)
+{
+    std::vector<TripId> postings(count);
+
+    for (std::size_t index = 0U; index < count; ++index)
+    {
+        postings[index] = static_cast<TripId>(index) * stride;
+    }
+
+    return postings;
+}
+
+void BM_IntersectPostingsSkewed(benchmark::State &state)
+{
+    auto const longer{MakePostings(static_cast<std::size_t>(state.range(0)), 1U)};
+    auto const shorter{MakePostings(64U, static_cast<TripId>(state.range(0) / 64))};
+
+    for (auto _ : state)
+    {
+        std::size_t matches{0U};
+        IntersectPostings(shorter, longer, [&matches](TripId) { ++matches; });
+        benchmark::DoNotOptimize(matches);
+    }
+}
+
+void BM_SetIntersectionSkewed(benchmark::State &state)
+{
+    auto const longer{MakePostings(static_cast<std::size_t>(state.range(0)), 1U)};
+    auto const shorter{MakePostings(64U, static_cast<TripId>(state.range(0) / 64))};
+
+    for (auto _ : state)
+    {
+        std::vector<TripId> common{};
+        std::set_intersection(shorter.begin(), shorter.end(), longer.begin(), longer.end(),
+                              std::back_inserter(common));
+        benchmark::DoNotOptimize(common);
+    }
+}
+
+void BM_FindMinFareBetweenCities(benchmark::State &state)
+{
+    FlightTripDatabase database{};
+
+    for (auto const &trip : MakeTrips(static_cast<std::size_t>(state.range(0))))
+    {
+        database.AddTrip(trip.flight_number, trip.origin_city, trip.destination_city, trip.flight_operator,
+                         trip.fare);
+    }
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(database.FindMinFareBetweenCities("Pune", "Delhi"));
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_IntersectPostingsSkewed)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_SetIntersectionSkewed)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_FindMinFareBetweenCities)->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+
+} // namespace flight_management
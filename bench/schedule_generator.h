@@ -0,0 +1,209 @@
+#ifndef FLIGHT_MANAGEMENT_BENCH_SCHEDULE_GENERATOR_H
+#define FLIGHT_MANAGEMENT_BENCH_SCHEDULE_GENERATOR_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "bench_data.h"
+#include "flight_trip_database.h"
+
+namespace flight_management
+{
+
+/**
+ * Shape of a synthetic schedule. Cities and operators are drawn with
+ * Zipf(skew) popularity, so a handful of hubs and carriers own most of
+ * the trips as in a real network; a skew of 0 is uniform.
+ */
+struct ScheduleOptions
+{
+    std::size_t trip_count{1U << 16U};
+    std::size_t city_count{256U};
+    std::size_t operator_count{24U};
+    double city_skew{1.1};
+    double operator_skew{0.9};
+    std::uint64_t seed{0x5eedU};
+};
+
+/**
+ * splitmix64: small, fast and identical on every platform, so a seed
+ * always yields the same schedule.
+ */
+class ScheduleRandom
+{
+public:
+    explicit ScheduleRandom(std::uint64_t seed) noexcept : state_{seed}
+    {
+    }
+
+    std::uint64_t Next() noexcept
+    {
+        std::uint64_t value{state_ += 0x9e3779b97f4a7c15ULL};
+        value = (value ^ (value >> 30U)) * 0xbf58476d1ce4e5b9ULL;
+        value = (value ^ (value >> 27U)) * 0x94d049bb133111ebULL;
+        return value ^ (value >> 31U);
+    }
+
+    double NextUnit() noexcept
+    {
+        return static_cast<double>(Next() >> 11U) * 0x1.0p-53;
+    }
+
+private:
+    std::uint64_t state_;
+};
+
+/**
+ * Ranks 0..count-1 drawn with probability proportional to 1/(rank+1)^skew,
+ * by binary search over the precomputed cumulative weights.
+ */
+class ZipfDistribution
+{
+public:
+    ZipfDistribution(std::size_t count, double skew) : cumulative_(count)
+    {
+        double total{0.0};
+        for (std::size_t rank = 0U; rank < count; ++rank)
+        {
+            total += 1.0 / std::pow(static_cast<double>(rank + 1U), skew);
+            cumulative_[rank] = total;
+        }
+
+        for (double &weight : cumulative_)
+        {
+            weight /= total;
+        }
+    }
+
+    std::size_t operator()(ScheduleRandom &random) const noexcept
+    {
+        auto const rank{std::upper_bound(cumulative_.cbegin(), cumulative_.cend(), random.NextUnit())};
+        return std::min(static_cast<std::size_t>(rank - cumulative_.cbegin()), cumulative_.size() - 1U);
+    }
+
+private:
+    std::vector<double> cumulative_;
+};
+
+inline std::string ScheduleCity(std::size_t rank)
+{
+    return "City-" + std::to_string(rank);
+}
+
+inline std::string ScheduleOperator(std::size_t rank)
+{
+    return "Carrier-" + std::to_string(rank);
+}
+
+/**
+ * A deterministic schedule of options.trip_count trips with unique flight
+ * numbers. Both ends of a route follow the city skew, so hub-to-hub routes
+ * carry the most trips; a route's fare follows a fixed pseudo-distance
+ * between its cities, scaled per operator, plus up to 25% noise.
+ */
+inline std::vector<TripRecord> MakeSchedule(const ScheduleOptions &options)
+{
+    ZipfDistribution const cities{options.city_count, options.city_skew};
+    ZipfDistribution const operators{options.operator_count, options.operator_skew};
+    ScheduleRandom random{options.seed};
+
+    std::vector<TripRecord> trips{};
+    trips.reserve(options.trip_count);
+
+    for (std::size_t index = 0U; index < options.trip_count; ++index)
+    {
+        std::size_t const origin{cities(random)};
+        std::size_t destination{cities(random)};
+        while (destination == origin)
+        {
+            destination = cities(random);
+        }
+        std::size_t const flight_operator{operators(random)};
+
+        // Same pair, same distance: 250 to 3000 km from a hash of the unordered pair.
+        ScheduleRandom route{(std::min(origin, destination) << 32U) ^ std::max(origin, destination)};
+        std::uint64_t const distance{250U + route.Next() % 2750U};
+        std::uint64_t const rate{4U + flight_operator % 4U};
+        std::uint64_t const fare{distance * rate + (distance * rate * (random.Next() % 25U)) / 100U};
+
+        trips.push_back(TripRecord{ScheduleOperator(flight_operator) + "-" + std::to_string(index),
+                                   ScheduleCity(origin), ScheduleCity(destination), ScheduleOperator(flight_operator),
+                                   static_cast<std::uint32_t>(fare)});
+    }
+
+    return trips;
+}
+
+inline std::vector<TripRecordView> ToRecordViews(const std::vector<TripRecord> &trips)
+{
+    std::vector<TripRecordView> records{};
+    records.reserve(trips.size());
+
+    for (auto const &trip : trips)
+    {
+        records.push_back(TripRecordView{trip.flight_number, trip.origin_city, trip.destination_city,
+                                         trip.flight_operator, trip.fare});
+    }
+
+    return records;
+}
+
+/**
+ * A generated schedule and a database holding it, plus a fixed stream of
+ * trip indexes for benchmarks to draw query keys from. Picking a trip
+ * uniformly picks its cities and operator with the schedule's skew.
+ */
+struct ScheduleFixture
+{
+    explicit ScheduleFixture(const ScheduleOptions &options)
+        : trips{MakeSchedule(options)}
+    {
+        database.BulkLoad(ToRecordViews(trips));
+
+        ScheduleRandom random{options.seed ^ 0xfeedU};
+        probes.resize(kProbeCount);
+        for (std::size_t &probe : probes)
+        {
+            probe = static_cast<std::size_t>(random.Next() % trips.size());
+        }
+    }
+
+    static constexpr std::size_t kProbeCount{1U << 14U};
+
+    const TripRecord &Probe(std::size_t index) const noexcept
+    {
+        return trips[probes[index % kProbeCount]];
+    }
+
+    std::vector<TripRecord> trips;
+    FlightTripDatabase database{};
+    std::vector<std::size_t> probes{};
+};
+
+/**
+ * The fixture for trip_count trips with the default options. Only the
+ * last size asked for is kept, so at 10M trips one copy is resident;
+ * register benchmarks size-major to build each size once.
+ */
+inline ScheduleFixture &CachedSchedule(std::size_t trip_count)
+{
+    static std::unique_ptr<ScheduleFixture> fixture{};
+
+    if (!fixture || fixture->trips.size() != trip_count)
+    {
+        fixture.reset();
+        ScheduleOptions options{};
+        options.trip_count = trip_count;
+        fixture = std::make_unique<ScheduleFixture>(options);
+    }
+
+    return *fixture;
+}
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_BENCH_SCHEDULE_GENERATOR_H
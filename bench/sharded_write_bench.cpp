@@ -0,0 +1,60 @@
+#include "benchmark/benchmark.h"
+
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "bench_data.h"
+#include "sharded_flight_trip_database.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+constexpr std::size_t kTripsPerThread{1U << 14U};
+
+std::unique_ptr<ShardedFlightTripDatabase> database{};
+
+/**
+ * Every thread inserts its own slice of trips; the argument is the shard
+ * count, so shard count 1 is a single database behind a single lock.
+ */
+void BM_ShardedAddTrip(benchmark::State &state)
+{
+    if (state.thread_index() == 0)
+    {
+        database = std::make_unique<ShardedFlightTripDatabase>(static_cast<std::size_t>(state.range(0)));
+    }
+
+    auto const trips{MakeTrips(kTripsPerThread)};
+    std::string const prefix{"T" + std::to_string(state.thread_index()) + "-"};
+    std::size_t index{0U};
+
+    for (auto _ : state)
+    {
+        auto const &trip{trips[index % trips.size()]};
+        database->AddTrip(prefix + std::to_string(index), trip.origin_city, trip.destination_city,
+                          trip.flight_operator, trip.fare);
+        ++index;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0)
+    {
+        database.reset();
+    }
+}
+
+int MaxThreads()
+{
+    return static_cast<int>(std::max(2U, std::thread::hardware_concurrency()));
+}
+
+} // namespace
+
+BENCHMARK(BM_ShardedAddTrip)->Arg(1)->Arg(16)->ThreadRange(1, MaxThreads())->UseRealTime();
+
+} // namespace flight_management
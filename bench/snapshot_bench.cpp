@@ -0,0 +1,88 @@
+#include "benchmark/benchmark.h"
+
+#include <cstdio>
+#include <string>
+
+#include "bench_data.h"
+#include "mapped_flight_trip_database.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+std::string SaveSchedule(std::size_t count)
+{
+    FlightTripDatabase database{};
+    std::vector<TripRecordView> records{};
+    auto const trips{MakeTrips(count)};
+
+    for (auto const &trip : trips)
+    {
+        records.push_back(TripRecordView{trip.flight_number, trip.origin_city, trip.destination_city,
+                                         trip.flight_operator, trip.fare});
+    }
+    database.BulkLoad(records);
+
+    std::string const path{"/tmp/flight_management_bench_" + std::to_string(count) + ".snapshot"};
+    database.SaveSnapshot(path);
+
+    return path;
+}
+
+void BM_OpenSnapshot(benchmark::State &state)
+{
+    std::string const path{SaveSchedule(static_cast<std::size_t>(state.range(0)))};
+    bool const verify_checksum{state.range(1) != 0};
+
+    for (auto _ : state)
+    {
+        auto const snapshot{MappedFlightTripDatabase::Open(path, verify_checksum)};
+        benchmark::DoNotOptimize(snapshot->FindMinFareBetweenCities("Pune", "Delhi"));
+    }
+
+    std::remove(path.c_str());
+}
+
+void BM_RebuildFromRecords(benchmark::State &state)
+{
+    auto const trips{MakeTrips(static_cast<std::size_t>(state.range(0)))};
+    std::vector<TripRecordView> records{};
+
+    for (auto const &trip : trips)
+    {
+        records.push_back(TripRecordView{trip.flight_number, trip.origin_city, trip.destination_city,
+                                         trip.flight_operator, trip.fare});
+    }
+
+    for (auto _ : state)
+    {
+        FlightTripDatabase database{};
+        database.BulkLoad(records);
+        benchmark::DoNotOptimize(database.FindMinFareBetweenCities("Pune", "Delhi"));
+    }
+}
+
+void BM_MappedFindFlightsByNumber(benchmark::State &state)
+{
+    std::string const path{SaveSchedule(static_cast<std::size_t>(state.range(0)))};
+    auto const snapshot{MappedFlightTripDatabase::Open(path)};
+    std::size_t index{0U};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            snapshot->FindFlightsByNumber("FL-" + std::to_string(index++ % static_cast<std::size_t>(state.range(0)))));
+    }
+
+    std::remove(path.c_str());
+}
+
+} // namespace
+
+BENCHMARK(BM_OpenSnapshot)->ArgsProduct({{1 << 16, 1 << 20}, {0, 1}})->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_RebuildFromRecords)->Arg(1 << 16)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MappedFindFlightsByNumber)->Arg(1 << 16)->Arg(1 << 20);
+
+} // namespace flight_management
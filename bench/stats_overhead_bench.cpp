@@ -0,0 +1,157 @@
+#include "benchmark/benchmark.h"
+
+#include <climits>
+#include <vector>
+
+#include "bench_data.h"
+#include "database_stats.h"
+#include "fare_ordered_index.h"
+#include "flight_trip_database.h"
+#include "string_interner.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+constexpr std::size_t kTripCount{1U << 16U};
+
+/**
+ * The lookups FindMinFareBetweenCities makes, written out by hand with
+ * no instrumentation: the floor the database call is measured against.
+ */
+struct BareRouteFares
+{
+    StringInterner cities{};
+    FareOrderedIndex<RouteKey> route_fares{};
+
+    std::uint32_t FindMinFare(std::string_view origin_city, std::string_view destination_city) const noexcept
+    {
+        InternId const origin_id{cities.Find(origin_city)};
+        InternId const destination_id{cities.Find(destination_city)};
+        if (origin_id == kInvalidInternId || destination_id == kInvalidInternId)
+        {
+            return UINT_MAX;
+        }
+
+        auto const cheapest{route_fares.FindMin(MakeRouteKey(origin_id, destination_id))};
+
+        return cheapest ? cheapest->first : UINT_MAX;
+    }
+};
+
+const std::vector<TripRecord> &Trips()
+{
+    static const std::vector<TripRecord> trips{MakeTrips(kTripCount)};
+    return trips;
+}
+
+const FlightTripDatabase &Database()
+{
+    static const FlightTripDatabase database{[] {
+        FlightTripDatabase loaded{};
+        for (auto const &trip : Trips())
+        {
+            loaded.AddTrip(trip.flight_number, trip.origin_city, trip.destination_city, trip.flight_operator,
+                           trip.fare);
+        }
+        return loaded;
+    }()};
+
+    return database;
+}
+
+const BareRouteFares &Bare()
+{
+    static const BareRouteFares bare{[] {
+        BareRouteFares loaded{};
+        TripId trip{0U};
+        for (auto const &record : Trips())
+        {
+            loaded.route_fares.Add(
+                MakeRouteKey(loaded.cities.Intern(record.origin_city), loaded.cities.Intern(record.destination_city)),
+                record.fare, trip++);
+        }
+        return loaded;
+    }()};
+
+    return bare;
+}
+
+void SetStatsLabel(benchmark::State &state)
+{
+    state.SetLabel(kStatsEnabled ? "stats on" : "stats off");
+}
+
+void BM_MinFareBare(benchmark::State &state)
+{
+    auto const &bare{Bare()};
+    auto const &trips{Trips()};
+    std::size_t index{0U};
+
+    for (auto _ : state)
+    {
+        auto const &trip{trips[index++ % trips.size()]};
+        benchmark::DoNotOptimize(bare.FindMinFare(trip.origin_city, trip.destination_city));
+    }
+
+    SetStatsLabel(state);
+}
+
+void BM_MinFareDatabase(benchmark::State &state)
+{
+    auto const &database{Database()};
+    auto const &trips{Trips()};
+    std::size_t index{0U};
+
+    for (auto _ : state)
+    {
+        auto const &trip{trips[index++ % trips.size()]};
+        benchmark::DoNotOptimize(database.FindMinFareBetweenCities(trip.origin_city, trip.destination_city));
+    }
+
+    SetStatsLabel(state);
+}
+
+void BM_FindByNumber(benchmark::State &state)
+{
+    auto const &database{Database()};
+    auto const &trips{Trips()};
+    std::size_t index{0U};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(database.ViewFlightByNumber(trips[index++ % trips.size()].flight_number));
+    }
+
+    SetStatsLabel(state);
+}
+
+void BM_AddTrip(benchmark::State &state)
+{
+    auto const &trips{Trips()};
+
+    for (auto _ : state)
+    {
+        FlightTripDatabase database{};
+        for (auto const &trip : trips)
+        {
+            database.AddTrip(trip.flight_number, trip.origin_city, trip.destination_city, trip.flight_operator,
+                             trip.fare);
+        }
+        benchmark::DoNotOptimize(database.GetTripCount());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * trips.size()));
+    SetStatsLabel(state);
+}
+
+} // namespace
+
+BENCHMARK(BM_MinFareBare);
+BENCHMARK(BM_MinFareDatabase);
+BENCHMARK(BM_FindByNumber);
+BENCHMARK(BM_AddTrip)->Unit(benchmark::kMillisecond);
+
+} // namespace flight_management
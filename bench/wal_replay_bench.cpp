@@ -0,0 +1,78 @@
+#include "benchmark/benchmark.h"
+
+#include <cstdio>
+#include <string>
+
+#include "bench_data.h"
+#include "flight_trip_database.h"
+#include "write_ahead_log.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+std::string WriteLog(std::size_t count)
+{
+    std::string const path{"/tmp/flight_management_bench_" + std::to_string(count) + ".wal"};
+    std::remove(path.c_str());
+
+    auto const log{WriteAheadLog::Open(path, WalOptions{Durability::kNone})};
+    for (auto const &trip : MakeTrips(count))
+    {
+        log->Append(MutationKind::kAddTrip, TripRecordView{trip.flight_number, trip.origin_city,
+                                                           trip.destination_city, trip.flight_operator, trip.fare});
+    }
+
+    return path;
+}
+
+void BM_ReplayLog(benchmark::State &state)
+{
+    std::string const path{WriteLog(static_cast<std::size_t>(state.range(0)))};
+
+    for (auto _ : state)
+    {
+        FlightTripDatabase database{};
+        auto const result{WriteAheadLog::Replay(
+            path, [&database](const TripMutation &mutation) { database.ApplyMutation(mutation); })};
+        benchmark::DoNotOptimize(result.records);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+    std::remove(path.c_str());
+}
+
+void BM_AppendLog(benchmark::State &state)
+{
+    std::string const path{"/tmp/flight_management_bench_append.wal"};
+    std::remove(path.c_str());
+
+    auto const durability{static_cast<Durability>(state.range(0))};
+    auto const log{WriteAheadLog::Open(path, WalOptions{durability, static_cast<std::size_t>(state.range(1))})};
+    auto const trips{MakeTrips(1024U)};
+    std::size_t index{0U};
+
+    for (auto _ : state)
+    {
+        auto const &trip{trips[index++ % trips.size()]};
+        log->Append(MutationKind::kAddTrip, TripRecordView{trip.flight_number, trip.origin_city,
+                                                           trip.destination_city, trip.flight_operator, trip.fare});
+    }
+
+    log->Commit();
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+    std::remove(path.c_str());
+}
+
+} // namespace
+
+BENCHMARK(BM_ReplayLog)->Arg(1 << 16)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_AppendLog)
+    ->Args({static_cast<int>(Durability::kNone), 64})
+    ->Args({static_cast<int>(Durability::kGroupCommit), 64})
+    ->Args({static_cast<int>(Durability::kGroupCommit), 1024})
+    ->Args({static_cast<int>(Durability::kEveryWrite), 1});
+
+} // namespace flight_management
@@ -0,0 +1,144 @@
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "schedule_generator.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+enum class WorkloadStep : std::uint8_t
+{
+    kFindByNumber,
+    kMinFareBetweenCities,
+    kTopKCheapest,
+    kMaxFareByOperator,
+    kUpdateFare,
+    kAddTrip,
+    kRemoveTrip
+};
+
+/**
+ * A mixed workload: write_percent of the steps mutate, the rest read.
+ * Reads are 40% number lookups, 30% route fares, 20% origin top-k and
+ * 10% operator fares; writes are 80% fare updates and 20% add/remove
+ * churn.
+ */
+struct WorkloadProfile
+{
+    const char *name;
+    std::uint32_t write_percent;
+};
+
+constexpr WorkloadProfile kProfiles[]{{"read_mostly", 5U}, {"balanced", 50U}, {"write_heavy", 90U}};
+
+std::vector<WorkloadStep> MakeSteps(const WorkloadProfile &profile, std::size_t count)
+{
+    ScheduleRandom random{0xacedU + profile.write_percent};
+    std::vector<WorkloadStep> steps{};
+    steps.reserve(count);
+
+    for (std::size_t index = 0U; index < count; ++index)
+    {
+        std::uint64_t const roll{random.Next() % 100U};
+        std::uint64_t const kind{random.Next() % 10U};
+
+        if (roll < profile.write_percent)
+        {
+            steps.push_back(kind < 8U ? WorkloadStep::kUpdateFare
+                                      : (kind == 8U ? WorkloadStep::kAddTrip : WorkloadStep::kRemoveTrip));
+        }
+        else
+        {
+            steps.push_back(kind < 4U   ? WorkloadStep::kFindByNumber
+                            : kind < 7U ? WorkloadStep::kMinFareBetweenCities
+                            : kind < 9U ? WorkloadStep::kTopKCheapest
+                                        : WorkloadStep::kMaxFareByOperator);
+        }
+    }
+
+    return steps;
+}
+
+void BM_Workload(benchmark::State &state)
+{
+    auto &fixture{CachedSchedule(static_cast<std::size_t>(state.range(0)))};
+    auto &database{fixture.database};
+    WorkloadProfile const &profile{kProfiles[state.range(1)]};
+    auto const steps{MakeSteps(profile, 1U << 16U)};
+
+    std::size_t index{0U};
+    std::size_t added{0U};
+    std::size_t removed{0U};
+    std::int64_t reads{0};
+    std::int64_t writes{0};
+
+    for (auto _ : state)
+    {
+        auto const &trip{fixture.Probe(index)};
+
+        switch (steps[index++ % steps.size()])
+        {
+        case WorkloadStep::kFindByNumber:
+            benchmark::DoNotOptimize(database.FindFlightsByNumber(trip.flight_number));
+            ++reads;
+            break;
+        case WorkloadStep::kMinFareBetweenCities:
+            benchmark::DoNotOptimize(database.FindMinFareBetweenCities(trip.origin_city, trip.destination_city));
+            ++reads;
+            break;
+        case WorkloadStep::kTopKCheapest:
+            benchmark::DoNotOptimize(database.FindTopKCheapest(trip.origin_city, 10U));
+            ++reads;
+            break;
+        case WorkloadStep::kMaxFareByOperator:
+            benchmark::DoNotOptimize(database.FindMaxFareByOperator(trip.flight_operator));
+            ++reads;
+            break;
+        case WorkloadStep::kUpdateFare:
+            benchmark::DoNotOptimize(database.UpdateFareByTrip(trip.flight_number, trip.fare + (index & 1U)));
+            ++writes;
+            break;
+        case WorkloadStep::kAddTrip:
+            benchmark::DoNotOptimize(database.AddTrip("Churn-" + std::to_string(added++), trip.origin_city,
+                                                      trip.destination_city, trip.flight_operator, trip.fare));
+            ++writes;
+            break;
+        case WorkloadStep::kRemoveTrip:
+            // Removes the oldest churned trip, so the database stays near its schedule size.
+            benchmark::DoNotOptimize(
+                removed < added && database.RemoveTrip("Churn-" + std::to_string(removed++)));
+            ++writes;
+            break;
+        }
+    }
+
+    // Leave the shared schedule as the next benchmark expects it.
+    while (removed < added)
+    {
+        database.RemoveTrip("Churn-" + std::to_string(removed++));
+    }
+
+    state.SetLabel(profile.name);
+    state.counters["reads"] = benchmark::Counter(static_cast<double>(reads), benchmark::Counter::kIsRate);
+    state.counters["writes"] = benchmark::Counter(static_cast<double>(writes), benchmark::Counter::kIsRate);
+}
+
+} // namespace
+
+// Arguments: trip count, profile (0 read_mostly, 1 balanced, 2 write_heavy); size-major for CachedSchedule.
+BENCHMARK(BM_Workload)
+    ->Args({100000, 0})
+    ->Args({100000, 1})
+    ->Args({100000, 2})
+    ->Args({1000000, 0})
+    ->Args({1000000, 1})
+    ->Args({1000000, 2})
+    ->ArgNames({"trips", "profile"});
+
+} // namespace flight_management
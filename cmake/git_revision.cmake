@@ -0,0 +1,25 @@
+#
+# @file
+#
+# Writes OUTPUT with the source tree's current commit as
+# FLIGHT_MANAGEMENT_GIT_REVISION. Run at build time by the
+# flight_management_git_revision target; the file is only rewritten when
+# the revision changes, so an unchanged commit rebuilds nothing.
+#
+execute_process(COMMAND git rev-parse --short HEAD
+                WORKING_DIRECTORY ${SOURCE_DIR}
+                OUTPUT_VARIABLE FLIGHT_MANAGEMENT_GIT_REVISION
+                OUTPUT_STRIP_TRAILING_WHITESPACE
+                ERROR_QUIET)
+if(NOT FLIGHT_MANAGEMENT_GIT_REVISION)
+    set(FLIGHT_MANAGEMENT_GIT_REVISION unknown)
+endif()
+
+set(CONTENT "#define FLIGHT_MANAGEMENT_GIT_REVISION \"${FLIGHT_MANAGEMENT_GIT_REVISION}\"\n")
+
+if(EXISTS ${OUTPUT})
+    file(READ ${OUTPUT} EXISTING)
+endif()
+if(NOT "${EXISTING}" STREQUAL "${CONTENT}")
+    file(WRITE ${OUTPUT} "${CONTENT}")
+endif()
@@ -0,0 +1,84 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_ASYNC_FLIGHT_TRIP_DATABASE_H
+#define FLIGHT_MANAGEMENT_INCLUDE_ASYNC_FLIGHT_TRIP_DATABASE_H
+
+#include <climits>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "async_task.h"
+#include "concurrent_flight_trip_database.h"
+#include "flight_data.h"
+#include "work_stealing_thread_pool.h"
+
+namespace flight_management
+{
+
+/**
+ * Coroutine front-end for an event loop. Every query is a lazy Task that
+ * hops to a pool worker before touching the database, so the loop thread
+ * only starts requests (Spawn) and receives results.
+ *
+ * Queries read one snapshot of database from start to finish. Scans over
+ * an origin's postings stop every chunk_size trips to requeue themselves
+ * behind other requests and to check their QueryContext. The database,
+ * pool and this facade must outlive every task they hand out.
+ */
+class AsyncFlightTripDatabase final
+{
+public:
+    static constexpr std::size_t kDefaultChunkSize{1024U};
+
+    AsyncFlightTripDatabase(const ConcurrentFlightTripDatabase &database, WorkStealingThreadPool &pool,
+                            std::size_t chunk_size = kDefaultChunkSize) noexcept;
+
+    Task<AsyncResult<std::optional<FlightData>>> FindFlightsByNumber(std::string flight_number,
+                                                                     QueryContext context = {}) const noexcept;
+    Task<AsyncResult<std::uint32_t>> FindMinFareBetweenCities(std::string origin_city, std::string destination_city,
+                                                              QueryContext context = {}) const noexcept;
+    Task<AsyncResult<std::uint32_t>> FindMaxFareByOperator(std::string flight_operator,
+                                                           QueryContext context = {}) const noexcept;
+    Task<AsyncResult<std::uint32_t>> FindAverageCostOfAllTrips(QueryContext context = {}) const noexcept;
+
+    /**
+     * Every flight from origin_city, gathered from StreamFlightsByOriginCity.
+     * A stopped scan returns no flights.
+     */
+    Task<AsyncResult<std::vector<FlightData>>> FindFlightsByOriginCity(std::string origin_city,
+                                                                       QueryContext context = {}) const noexcept;
+
+    /**
+     * The flights from origin_city in chunks of up to chunk_size, so a
+     * consumer can start sending results before a big hub is scanned.
+     */
+    ChunkStream<FlightData> StreamFlightsByOriginCity(std::string origin_city,
+                                                      QueryContext context = {}) const noexcept;
+
+private:
+    /**
+     * A point query: checks context once on the worker, then runs
+     * query(snapshot) or returns not_run.
+     */
+    template <typename Result, typename Query>
+    Task<AsyncResult<Result>> RunPointQuery(QueryContext context, Result not_run, Query query) const noexcept
+    {
+        co_await ResumeOn{pool_};
+
+        QueryStatus const status{context.GetStatus()};
+        if (status != QueryStatus::kOk)
+        {
+            co_return AsyncResult<Result>{status, std::move(not_run)};
+        }
+
+        co_return AsyncResult<Result>{QueryStatus::kOk, query(*database_.GetSnapshot())};
+    }
+
+    const ConcurrentFlightTripDatabase &database_;
+    WorkStealingThreadPool &pool_;
+    std::size_t chunk_size_;
+};
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_ASYNC_FLIGHT_TRIP_DATABASE_H
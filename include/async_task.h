@@ -0,0 +1,410 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_ASYNC_TASK_H
+#define FLIGHT_MANAGEMENT_INCLUDE_ASYNC_TASK_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "work_stealing_thread_pool.h"
+
+namespace flight_management
+{
+
+enum class QueryStatus : std::uint8_t
+{
+    kOk = 0U,
+    kCancelled = 1U,
+    kDeadlineExceeded = 2U
+};
+
+/**
+ * Cancellation flag and optional deadline of one request. Copies share
+ * the flag, so the caller keeps a copy to Cancel what it handed out.
+ * Queries check it between chunks of work, not within one.
+ */
+class QueryContext
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    QueryContext() noexcept
+        : cancelled_{std::make_shared<std::atomic<bool>>(false)}
+    {
+    }
+
+    static QueryContext WithTimeout(Clock::duration timeout) noexcept
+    {
+        QueryContext context{};
+        context.deadline_ = Clock::now() + timeout;
+
+        return context;
+    }
+
+    void Cancel() const noexcept
+    {
+        cancelled_->store(true, std::memory_order_relaxed);
+    }
+
+    QueryStatus GetStatus() const noexcept
+    {
+        if (cancelled_->load(std::memory_order_relaxed))
+        {
+            return QueryStatus::kCancelled;
+        }
+
+        return (deadline_ && Clock::now() >= *deadline_) ? QueryStatus::kDeadlineExceeded : QueryStatus::kOk;
+    }
+
+private:
+    std::shared_ptr<std::atomic<bool>> cancelled_;
+    std::optional<Clock::time_point> deadline_{};
+};
+
+/**
+ * A query's answer, or the default value with the reason it stopped.
+ */
+template <typename T>
+struct AsyncResult
+{
+    QueryStatus status{QueryStatus::kOk};
+    T value{};
+};
+
+/**
+ * Resumes the awaiting coroutine on one of pool's workers, behind the
+ * work already queued there. Awaited again mid-scan it is a cooperative
+ * yield: other requests run before the scan continues.
+ */
+struct ResumeOn
+{
+    WorkStealingThreadPool &pool;
+
+    bool await_ready() const noexcept
+    {
+        return pool.GetThreadCount() == 0U;
+    }
+
+    void await_suspend(std::coroutine_handle<> awaiting) const noexcept
+    {
+        pool.Post([awaiting] { awaiting.resume(); });
+    }
+
+    void await_resume() const noexcept
+    {
+    }
+};
+
+/**
+ * Lazily started coroutine producing one T. It runs when first awaited
+ * and resumes its awaiter, on whichever thread it finished, through
+ * symmetric transfer.
+ */
+template <typename T>
+class Task final
+{
+public:
+    struct promise_type
+    {
+        Task get_return_object() noexcept
+        {
+            return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        std::suspend_always initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        auto final_suspend() const noexcept
+        {
+            struct ResumeContinuation
+            {
+                bool await_ready() const noexcept
+                {
+                    return false;
+                }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> task) const noexcept
+                {
+                    return task.promise().continuation;
+                }
+
+                void await_resume() const noexcept
+                {
+                }
+            };
+
+            return ResumeContinuation{};
+        }
+
+        void return_value(T result) noexcept
+        {
+            value.emplace(std::move(result));
+        }
+
+        void unhandled_exception() const noexcept
+        {
+            std::terminate();
+        }
+
+        std::optional<T> value{};
+        std::coroutine_handle<> continuation{std::noop_coroutine()};
+    };
+
+    Task(Task &&other) noexcept
+        : handle_{std::exchange(other.handle_, nullptr)}
+    {
+    }
+
+    ~Task() noexcept
+    {
+        if (handle_)
+        {
+            handle_.destroy();
+        }
+    }
+
+    Task(const Task &) = delete;
+    Task &operator=(const Task &) = delete;
+    Task &operator=(Task &&) = delete;
+
+    auto operator co_await() && noexcept
+    {
+        struct Awaiter
+        {
+            std::coroutine_handle<promise_type> task;
+
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) const noexcept
+            {
+                task.promise().continuation = awaiting;
+                return task;
+            }
+
+            T await_resume() const noexcept
+            {
+                return std::move(*task.promise().value);
+            }
+        };
+
+        return Awaiter{handle_};
+    }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept
+        : handle_{handle}
+    {
+    }
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+/**
+ * Async generator of result chunks. Each co_await Next() runs the
+ * producer until its next co_yield and returns that chunk, or nullopt
+ * once it has co_returned its QueryStatus. The stream may be dropped
+ * between chunks; that abandons the rest of the scan.
+ */
+template <typename T>
+class ChunkStream final
+{
+public:
+    struct promise_type;
+    using Handle = std::coroutine_handle<promise_type>;
+
+    struct ResumeConsumer
+    {
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        std::coroutine_handle<> await_suspend(Handle producer) const noexcept
+        {
+            return producer.promise().consumer;
+        }
+
+        void await_resume() const noexcept
+        {
+        }
+    };
+
+    struct promise_type
+    {
+        ChunkStream get_return_object() noexcept
+        {
+            return ChunkStream{Handle::from_promise(*this)};
+        }
+
+        std::suspend_always initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        ResumeConsumer final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        ResumeConsumer yield_value(std::vector<T> value) noexcept
+        {
+            chunk = std::move(value);
+            return {};
+        }
+
+        void return_value(QueryStatus value) noexcept
+        {
+            status = value;
+        }
+
+        void unhandled_exception() const noexcept
+        {
+            std::terminate();
+        }
+
+        std::vector<T> chunk{};
+        QueryStatus status{QueryStatus::kOk};
+        std::coroutine_handle<> consumer{std::noop_coroutine()};
+    };
+
+    ChunkStream(ChunkStream &&other) noexcept
+        : handle_{std::exchange(other.handle_, nullptr)}
+    {
+    }
+
+    ~ChunkStream() noexcept
+    {
+        if (handle_)
+        {
+            handle_.destroy();
+        }
+    }
+
+    ChunkStream(const ChunkStream &) = delete;
+    ChunkStream &operator=(const ChunkStream &) = delete;
+    ChunkStream &operator=(ChunkStream &&) = delete;
+
+    auto Next() noexcept
+    {
+        struct Awaiter
+        {
+            Handle producer;
+
+            bool await_ready() const noexcept
+            {
+                return producer.done();
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) const noexcept
+            {
+                producer.promise().consumer = awaiting;
+                return producer;
+            }
+
+            std::optional<std::vector<T>> await_resume() const noexcept
+            {
+                return producer.done() ? std::nullopt : std::make_optional(std::move(producer.promise().chunk));
+            }
+        };
+
+        return Awaiter{handle_};
+    }
+
+    /**
+     * Why the stream ended; kOk until then.
+     */
+    QueryStatus GetStatus() const noexcept
+    {
+        return handle_.promise().status;
+    }
+
+private:
+    explicit ChunkStream(Handle handle) noexcept
+        : handle_{handle}
+    {
+    }
+
+    Handle handle_;
+};
+
+/**
+ * Coroutine that starts at once and frees itself when it finishes.
+ */
+struct DetachedTask
+{
+    struct promise_type
+    {
+        DetachedTask get_return_object() const noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        void return_void() const noexcept
+        {
+        }
+
+        void unhandled_exception() const noexcept
+        {
+            std::terminate();
+        }
+    };
+};
+
+/**
+ * Runs task without waiting for it and calls done(result) on the thread
+ * it finishes on, typically a pool worker. This is how an event loop
+ * starts a request; done should hand the result back to the loop.
+ */
+template <typename T, typename Done>
+DetachedTask Spawn(Task<T> task, Done done) noexcept
+{
+    done(co_await std::move(task));
+}
+
+/**
+ * Runs task and blocks the calling thread until it finishes.
+ */
+template <typename T>
+T SyncWait(Task<T> task) noexcept
+{
+    std::mutex mutex{};
+    std::condition_variable finished{};
+    std::optional<T> result{};
+
+    Spawn(std::move(task), [&mutex, &finished, &result](T value) {
+        std::lock_guard<std::mutex> lock{mutex};
+        result.emplace(std::move(value));
+        finished.notify_one();
+    });
+
+    std::unique_lock<std::mutex> lock{mutex};
+    finished.wait(lock, [&result] { return result.has_value(); });
+
+    return std::move(*result);
+}
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_ASYNC_TASK_H
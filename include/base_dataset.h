@@ -1,45 +1,185 @@
 #ifndef FLIGHT_MANAGEMENT_INCLUDE_BASE_DATA_SET_H
 #define FLIGHT_MANAGEMENT_INCLUDE_BASE_DATA_SET_H
 
-#include <map>
+#include <algorithm>
+#include <memory_resource>
+#include <utility>
 #include <vector>
 
-#include "flight_data.h"
 #include "common_data.h"
 
 namespace flight_management
 {
 
-template <Filters filter, typename data_type = std::string>
+/**
+ * Postings-list index: for every interned key a list of trip ids kept
+ * sorted ascending, so lists can be intersected without copying them.
+ *
+ * Removing a trip leaves its entries in place as tombstones; the owner
+ * counts them with MarkDead and filters them at query time until Compact
+ * drops them. Adding a value that is still present revives its tombstone.
+ */
+template <Filters filter, typename data_type = TripId>
 class BaseDataset
 {
 public:
     using Type = data_type;
-    using Container = std::multimap<std::string, Type>;
+    using Postings = std::pmr::vector<Type>;
+    using Container = std::pmr::vector<Postings>;
 
-    bool Add(const std::string &key, const std::string &value) noexcept
+    explicit BaseDataset(std::pmr::memory_resource *resource = std::pmr::get_default_resource()) noexcept
+        : container_{resource}
     {
-        auto const &result{container_.emplace(std::make_pair(key, value))};
+    }
+
+    bool Add(InternId key, Type value) noexcept
+    {
+        if (key >= container_.size())
+        {
+            container_.resize(key + 1U);
+        }
+
+        Postings &postings{container_[key]};
+
+        if (postings.empty() || postings.back() < value)
+        {
+            postings.push_back(value);
+            ++entry_count_;
+            return true;
+        }
+
+        auto const position{std::lower_bound(postings.begin(), postings.end(), value)};
+
+        if (*position == value)
+        {
+            Revive(1U);
+            return false;
+        }
+
+        postings.insert(position, value);
+        ++entry_count_;
+        return true;
+    }
+
+    bool Remove(InternId key, Type value) noexcept
+    {
+        if (key >= container_.size())
+        {
+            return false;
+        }
+
+        Postings &postings{container_[key]};
+        auto const position{std::lower_bound(postings.begin(), postings.end(), value)};
+
+        if (position == postings.end() || *position != value)
+        {
+            return false;
+        }
+
+        postings.erase(position);
+        --entry_count_;
+        return true;
+    }
+
+    /**
+     * Sort-then-build insertion of many (key, value) pairs: each key's new
+     * values are appended in one go and merged only if they interleave with
+     * values already present.
+     */
+    void BulkAdd(std::vector<std::pair<InternId, Type>> entries) noexcept
+    {
+        std::sort(entries.begin(), entries.end());
 
-        return result != container_.cend();
+        if (!entries.empty() && entries.back().first >= container_.size())
+        {
+            container_.resize(entries.back().first + 1U);
+        }
+
+        for (auto group = entries.cbegin(); group != entries.cend();)
+        {
+            Postings &postings{container_[group->first]};
+            auto const appended_from{static_cast<std::ptrdiff_t>(postings.size())};
+
+            for (auto const key{group->first}; group != entries.cend() && group->first == key; ++group)
+            {
+                postings.push_back(group->second);
+            }
+
+            entry_count_ += postings.size() - static_cast<std::size_t>(appended_from);
+
+            if (appended_from != 0 && postings[appended_from] <= postings[appended_from - 1])
+            {
+                std::inplace_merge(postings.begin(), postings.begin() + appended_from, postings.end());
+
+                auto const duplicates{postings.end() - std::unique(postings.begin(), postings.end())};
+                postings.erase(postings.end() - duplicates, postings.end());
+                entry_count_ -= static_cast<std::size_t>(duplicates);
+                Revive(static_cast<std::size_t>(duplicates));
+            }
+        }
     }
 
-    std::vector<Type> EqualRange(const std::string &key) const noexcept
+    void MarkDead(std::size_t count = 1U) noexcept
     {
-        auto range{container_.equal_range(key)};
+        dead_entry_count_ += count;
+    }
 
-        std::vector<Type> values{};
+    /**
+     * Drops every entry for which is_live(key, value) is false and returns
+     * the number dropped. Lists left mostly empty give their memory back.
+     */
+    template <typename IsLive>
+    std::size_t Compact(IsLive &&is_live) noexcept
+    {
+        std::size_t removed{0U};
 
-        for (auto element = range.first; element != range.second; ++element)
+        for (InternId key = 0U; key < container_.size(); ++key)
         {
-            values.push_back(element->second);
+            Postings &postings{container_[key]};
+            auto const kept{std::remove_if(postings.begin(), postings.end(),
+                                           [&is_live, key](Type value) { return !is_live(key, value); })};
+
+            removed += static_cast<std::size_t>(postings.end() - kept);
+            postings.erase(kept, postings.end());
+
+            if (postings.capacity() > 2U * postings.size())
+            {
+                postings.shrink_to_fit();
+            }
         }
 
-        return values;
+        entry_count_ -= removed;
+        dead_entry_count_ = 0U;
+
+        return removed;
+    }
+
+    std::size_t GetEntryCount() const noexcept
+    {
+        return entry_count_;
+    }
+
+    std::size_t GetDeadEntryCount() const noexcept
+    {
+        return dead_entry_count_;
+    }
+
+    const Postings &EqualRange(InternId key) const noexcept
+    {
+        static const Postings empty{};
+
+        return (key < container_.size()) ? container_[key] : empty;
     }
 
 private:
+    void Revive(std::size_t count) noexcept
+    {
+        dead_entry_count_ -= std::min(dead_entry_count_, count);
+    }
+
     Container container_;
+    std::size_t entry_count_{0U};
+    std::size_t dead_entry_count_{0U};
 };
 
 } // namespace flight_management
@@ -0,0 +1,163 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_BIT_PACKING_H
+#define FLIGHT_MANAGEMENT_INCLUDE_BIT_PACKING_H
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace flight_management
+{
+
+/**
+ * Values per packed block. A block of bit width w takes kPackedLanes * w
+ * words, interleaved four ways: value i lives in lane i % 4 of the 128-bit
+ * word groups, at bit (i / 4) * w of that lane. Four neighbouring values
+ * therefore sit at the same shift, and unpack with one SSE2 shift and mask.
+ */
+constexpr std::size_t kPackedBlockSize{128U};
+constexpr std::size_t kPackedLanes{4U};
+
+constexpr std::size_t PackedBlockWords(std::uint32_t width) noexcept
+{
+    return kPackedLanes * width;
+}
+
+constexpr std::uint32_t PackedMask(std::uint32_t width) noexcept
+{
+    return (width >= 32U) ? UINT32_MAX : (1U << width) - 1U;
+}
+
+inline std::uint32_t PackedBitWidth(std::uint32_t value) noexcept
+{
+    return static_cast<std::uint32_t>(std::bit_width(value));
+}
+
+/**
+ * Packs kPackedBlockSize values, each below 2^width, into
+ * PackedBlockWords(width) words.
+ */
+inline void PackBlock(const std::uint32_t *values, std::uint32_t width, std::uint32_t *words) noexcept
+{
+    std::fill(words, words + PackedBlockWords(width), 0U);
+
+    if (width == 0U)
+    {
+        return;
+    }
+
+    for (std::size_t index = 0U; index < kPackedBlockSize; ++index)
+    {
+        std::size_t const bit{(index / kPackedLanes) * width};
+        std::size_t const word{(bit / 32U) * kPackedLanes + index % kPackedLanes};
+        auto const shift{static_cast<std::uint32_t>(bit % 32U)};
+
+        words[word] |= values[index] << shift;
+        if (shift + width > 32U)
+        {
+            words[word + kPackedLanes] |= values[index] >> (32U - shift);
+        }
+    }
+}
+
+/**
+ * The index-th value of a packed block, without unpacking the rest.
+ */
+inline std::uint32_t UnpackValue(const std::uint32_t *words, std::uint32_t width, std::size_t index) noexcept
+{
+    if (width == 0U)
+    {
+        return 0U;
+    }
+
+    std::size_t const bit{(index / kPackedLanes) * width};
+    std::size_t const word{(bit / 32U) * kPackedLanes + index % kPackedLanes};
+    auto const shift{static_cast<std::uint32_t>(bit % 32U)};
+
+    std::uint32_t value{words[word] >> shift};
+    if (shift + width > 32U)
+    {
+        value |= words[word + kPackedLanes] << (32U - shift);
+    }
+
+    return value & PackedMask(width);
+}
+
+/**
+ * Unpacks a whole block into values, adding base to each: the decoding
+ * half of frame-of-reference coding.
+ */
+inline void UnpackBlock(const std::uint32_t *words, std::uint32_t width, std::uint32_t base,
+                        std::uint32_t *values) noexcept
+{
+    if (width == 0U)
+    {
+        std::fill(values, values + kPackedBlockSize, base);
+        return;
+    }
+
+#if defined(__SSE2__)
+    auto const *const groups{reinterpret_cast<const __m128i *>(words)};
+    __m128i const mask{_mm_set1_epi32(static_cast<int>(PackedMask(width)))};
+    __m128i const offset{_mm_set1_epi32(static_cast<int>(base))};
+
+    for (std::size_t group = 0U; group < kPackedBlockSize / kPackedLanes; ++group)
+    {
+        std::size_t const bit{group * width};
+        auto const shift{static_cast<std::uint32_t>(bit % 32U)};
+
+        __m128i value{_mm_srl_epi32(_mm_loadu_si128(groups + bit / 32U), _mm_cvtsi32_si128(static_cast<int>(shift)))};
+        if (shift + width > 32U)
+        {
+            value = _mm_or_si128(value, _mm_sll_epi32(_mm_loadu_si128(groups + bit / 32U + 1U),
+                                                      _mm_cvtsi32_si128(static_cast<int>(32U - shift))));
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(values + group * kPackedLanes),
+                         _mm_add_epi32(_mm_and_si128(value, mask), offset));
+    }
+#else
+    for (std::size_t index = 0U; index < kPackedBlockSize; ++index)
+    {
+        values[index] = base + UnpackValue(words, width, index);
+    }
+#endif
+}
+
+/**
+ * Turns a block of gaps into the ascending values they separate, the
+ * value before the first gap being first.
+ */
+inline void PrefixSumBlock(std::uint32_t *values, std::uint32_t first) noexcept
+{
+#if defined(__SSE2__)
+    __m128i carry{_mm_set1_epi32(static_cast<int>(first))};
+
+    for (std::size_t group = 0U; group < kPackedBlockSize; group += kPackedLanes)
+    {
+        auto *const lane{reinterpret_cast<__m128i *>(values + group)};
+
+        __m128i sum{_mm_loadu_si128(lane)};
+        sum = _mm_add_epi32(sum, _mm_slli_si128(sum, 4));
+        sum = _mm_add_epi32(sum, _mm_slli_si128(sum, 8));
+        sum = _mm_add_epi32(sum, carry);
+
+        _mm_storeu_si128(lane, sum);
+        carry = _mm_shuffle_epi32(sum, _MM_SHUFFLE(3, 3, 3, 3));
+    }
+#else
+    for (std::size_t index = 0U; index < kPackedBlockSize; ++index)
+    {
+        first += values[index];
+        values[index] = first;
+    }
+#endif
+}
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_BIT_PACKING_H
@@ -1,7 +1,9 @@
 #ifndef FLIGHT_MANAGEMENT_INCLUDE_COMMON_DATA_H
 #define FLIGHT_MANAGEMENT_INCLUDE_COMMON_DATA_H
 
+#include <cstddef>
 #include <cstdint>
+#include <limits>
 
 namespace flight_management
 {
@@ -13,6 +15,22 @@ enum class Filters : unsigned int
     kFlightOperator = 2U
 };
 
+using InternId = std::uint32_t;
+using TripId = InternId;
+
+constexpr InternId kInvalidInternId{std::numeric_limits<InternId>::max()};
+
+/**
+ * Secondary-index entries summed over the origin, destination and
+ * operator postings. Dead entries are tombstones awaiting compaction.
+ */
+struct IndexStatistics
+{
+    std::size_t live_entries{0U};
+    std::size_t dead_entries{0U};
+    std::size_t compactions{0U};
+};
+
 } // namespace flight_management
 
 #endif //FLIGHT_MANAGEMENT_INCLUDE_COMMON_DATA_H
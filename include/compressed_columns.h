@@ -0,0 +1,229 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_COMPRESSED_COLUMNS_H
+#define FLIGHT_MANAGEMENT_INCLUDE_COMPRESSED_COLUMNS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "bit_packing.h"
+#include "common_data.h"
+
+namespace flight_management
+{
+
+/**
+ * Read-only uint32 column in frame-of-reference blocks: every block of
+ * kPackedBlockSize rows keeps its minimum and packs each value's distance
+ * from it in just enough bits for the block. Sum and Gather unpack a
+ * block at a time.
+ */
+class CompressedColumn
+{
+public:
+    CompressedColumn() noexcept = default;
+    CompressedColumn(const std::uint32_t *values, std::size_t count) noexcept;
+
+    std::uint32_t Get(std::size_t row) const noexcept
+    {
+        Block const &block{blocks_[row / kPackedBlockSize]};
+
+        return block.min + UnpackValue(words_.data() + block.offset, block.width, row % kPackedBlockSize);
+    }
+
+    std::size_t Size() const noexcept
+    {
+        return size_;
+    }
+
+    std::uint64_t Sum() const noexcept;
+
+    /**
+     * Sets values[i] to Get(rows[i]) for count ascending rows. A block
+     * holding several of the rows is unpacked once; a row alone in its
+     * block is read on its own.
+     */
+    void Gather(const std::uint32_t *rows, std::size_t count, std::uint32_t *values) const noexcept;
+
+    std::size_t GetByteSize() const noexcept;
+
+private:
+    struct Block
+    {
+        std::uint32_t min{0U};
+        std::uint32_t offset{0U};
+        std::uint32_t width{0U};
+    };
+
+    std::vector<Block> blocks_{};
+    std::vector<std::uint32_t> words_{};
+    std::size_t size_{0U};
+};
+
+/**
+ * Read-only postings lists, one per key, in delta-coded packed blocks:
+ * every block of up to kPackedBlockSize ascending ids keeps its first and
+ * last id and packs the gaps between neighbours. Lists decode a block at
+ * a time, and intersections skip blocks whose id range cannot overlap.
+ */
+class CompressedPostings
+{
+public:
+    struct Block
+    {
+        TripId first{0U};
+        TripId last{0U};
+        std::uint32_t offset{0U};
+        std::uint16_t width{0U};
+        std::uint16_t count{0U};
+    };
+
+    /**
+     * Adds the list of the next key, GetKeyCount(), from count ascending ids.
+     */
+    void Append(const TripId *ids, std::size_t count) noexcept;
+
+    /**
+     * Gives back the slack left by growing, once the last list is in.
+     */
+    void ShrinkToFit() noexcept;
+
+    std::span<const Block> GetBlocks(InternId key) const noexcept
+    {
+        return (key < GetKeyCount())
+                   ? std::span<const Block>{blocks_.data() + key_blocks_[key], key_blocks_[key + 1U] - key_blocks_[key]}
+                   : std::span<const Block>{};
+    }
+
+    /**
+     * Decodes block into ids, which must have room for kPackedBlockSize.
+     */
+    void Decode(const Block &block, TripId *ids) const noexcept
+    {
+        UnpackBlock(words_.data() + block.offset, block.width, 0U, ids);
+        PrefixSumBlock(ids, block.first);
+    }
+
+    template <typename Visitor>
+    void ForEach(InternId key, Visitor &&visit) const noexcept
+    {
+        alignas(16) TripId ids[kPackedBlockSize];
+
+        for (Block const &block : GetBlocks(key))
+        {
+            Decode(block, ids);
+            for (std::size_t index = 0U; index < block.count; ++index)
+            {
+                visit(ids[index]);
+            }
+        }
+    }
+
+    std::size_t GetEntryCount(InternId key) const noexcept;
+
+    std::size_t GetKeyCount() const noexcept
+    {
+        return key_blocks_.size() - 1U;
+    }
+
+    std::size_t GetByteSize() const noexcept;
+
+private:
+    std::vector<std::uint32_t> key_blocks_{0U};
+    std::vector<Block> blocks_{};
+    std::vector<std::uint32_t> words_{};
+};
+
+/**
+ * Calls visit for every id in both lists, in ascending order. Blocks
+ * whose id ranges do not overlap are passed over by binary search on
+ * the block headers; only overlapping pairs are decoded and merged.
+ */
+template <typename Visitor>
+void IntersectPostings(const CompressedPostings &lhs, InternId lhs_key, const CompressedPostings &rhs,
+                       InternId rhs_key, Visitor &&visit) noexcept
+{
+    using Block = CompressedPostings::Block;
+
+    auto const left{lhs.GetBlocks(lhs_key)};
+    auto const right{rhs.GetBlocks(rhs_key)};
+    auto left_block{left.begin()};
+    auto right_block{right.begin()};
+
+    alignas(16) TripId left_ids[kPackedBlockSize];
+    alignas(16) TripId right_ids[kPackedBlockSize];
+    std::size_t left_index{0U};
+    std::size_t right_index{0U};
+    bool left_decoded{false};
+    bool right_decoded{false};
+
+    while (left_block != left.end() && right_block != right.end())
+    {
+        if (left_block->last < right_block->first)
+        {
+            left_block = std::partition_point(left_block + 1, left.end(),
+                                              [first = right_block->first](const Block &block) { return block.last < first; });
+            left_index = 0U;
+            left_decoded = false;
+            continue;
+        }
+
+        if (right_block->last < left_block->first)
+        {
+            right_block = std::partition_point(right_block + 1, right.end(),
+                                               [first = left_block->first](const Block &block) { return block.last < first; });
+            right_index = 0U;
+            right_decoded = false;
+            continue;
+        }
+
+        if (!left_decoded)
+        {
+            lhs.Decode(*left_block, left_ids);
+            left_decoded = true;
+        }
+
+        if (!right_decoded)
+        {
+            rhs.Decode(*right_block, right_ids);
+            right_decoded = true;
+        }
+
+        while (left_index < left_block->count && right_index < right_block->count)
+        {
+            if (left_ids[left_index] < right_ids[right_index])
+            {
+                ++left_index;
+            }
+            else if (right_ids[right_index] < left_ids[left_index])
+            {
+                ++right_index;
+            }
+            else
+            {
+                visit(left_ids[left_index]);
+                ++left_index;
+                ++right_index;
+            }
+        }
+
+        if (left_index == left_block->count)
+        {
+            ++left_block;
+            left_index = 0U;
+            left_decoded = false;
+        }
+
+        if (right_index == right_block->count)
+        {
+            ++right_block;
+            right_index = 0U;
+            right_decoded = false;
+        }
+    }
+}
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_COMPRESSED_COLUMNS_H
@@ -0,0 +1,100 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_COMPRESSED_FLIGHT_TRIP_DATABASE_H
+#define FLIGHT_MANAGEMENT_INCLUDE_COMPRESSED_FLIGHT_TRIP_DATABASE_H
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "compressed_columns.h"
+#include "flight_data.h"
+#include "flight_trip_database.h"
+#include "string_interner.h"
+
+namespace flight_management
+{
+
+/**
+ * A read-only, compressed copy of a FlightTripDatabase for memory-bound,
+ * read-mostly deployments.
+ *
+ * The fare column and the origin, destination and operator id columns
+ * are frame-of-reference packed, and the origin, destination and operator
+ * postings are delta-coded packed blocks with their tombstones dropped.
+ * The fare-ordered indexes are not kept: a route's minimum fare walks the
+ * intersection of its origin and destination postings, and an operator's
+ * maximum its postings. Both decode up to a block of trip ids, gather
+ * their fares from the fare column a block at a time and reduce them in
+ * one pass. To pick up changes, build a new copy from the live database.
+ */
+class CompressedFlightTripDatabase final
+{
+public:
+    explicit CompressedFlightTripDatabase(const FlightTripDatabase &database) noexcept;
+
+    template <typename Origin>
+    std::vector<FlightData> FindFlightsByOriginCity(Origin &&origin_city) const noexcept
+    {
+        return FindFlights(origin_postings_, cities_.Find(std::string_view{origin_city}));
+    }
+
+    template <typename Destination>
+    std::vector<FlightData> FindFlightsByDestinationCity(Destination &&destination_city) const noexcept
+    {
+        return FindFlights(destination_postings_, cities_.Find(std::string_view{destination_city}));
+    }
+
+    template <typename Operator>
+    std::vector<FlightData> FindFlightsByOperator(Operator &&flight_operator) const noexcept
+    {
+        return FindFlights(operator_postings_, operators_.Find(std::string_view{flight_operator}));
+    }
+
+    template <typename Operator>
+    std::uint32_t FindMaxFareByOperator(Operator &&flight_operator) const noexcept
+    {
+        return FindMaxFare(std::string_view{flight_operator});
+    }
+
+    template <typename Origin, typename Destination>
+    std::uint32_t FindMinFareBetweenCities(Origin &&origin_city, Destination &&destination_city) const noexcept
+    {
+        return FindMinFare(std::string_view{origin_city}, std::string_view{destination_city});
+    }
+
+    bool IsTripInDatabase(std::string_view flight_number) const noexcept;
+    std::uint32_t FindAverageCostOfAllTrips() const noexcept;
+    std::optional<FlightData> FindFlightsByNumber(std::string_view flight_number) const noexcept;
+    std::size_t GetTripCount() const noexcept;
+
+    /**
+     * Bytes held by the packed columns and postings, interned strings
+     * not included.
+     */
+    std::size_t GetStorageBytes() const noexcept;
+
+private:
+    TripId FindLiveTrip(std::string_view flight_number) const noexcept;
+    FlightData MakeFlightData(TripId trip) const noexcept;
+
+    std::vector<FlightData> FindFlights(const CompressedPostings &postings, InternId key) const noexcept;
+    std::uint32_t FindMaxFare(std::string_view flight_operator) const noexcept;
+    std::uint32_t FindMinFare(std::string_view origin_city, std::string_view destination_city) const noexcept;
+
+    StringInterner flight_numbers_;
+    StringInterner cities_;
+    StringInterner operators_;
+    CompressedColumn origin_ids_;
+    CompressedColumn destination_ids_;
+    CompressedColumn operator_ids_;
+    CompressedColumn fares_;
+    CompressedColumn live_;
+    CompressedPostings origin_postings_;
+    CompressedPostings destination_postings_;
+    CompressedPostings operator_postings_;
+    std::size_t trip_count_{0U};
+};
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_COMPRESSED_FLIGHT_TRIP_DATABASE_H
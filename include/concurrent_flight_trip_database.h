@@ -0,0 +1,107 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_CONCURRENT_FLIGHT_TRIP_DATABASE_H
+#define FLIGHT_MANAGEMENT_INCLUDE_CONCURRENT_FLIGHT_TRIP_DATABASE_H
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "flight_data.h"
+#include "flight_trip_database.h"
+#include "trip_mutation.h"
+
+namespace flight_management
+{
+
+/**
+ * FlightTripDatabase shared by many readers and serialized writers.
+ *
+ * Readers load the published immutable snapshot and never wait for a
+ * writer. Writers apply a batch to a private standby copy and publish it
+ * with one atomic pointer swap, so a batch becomes visible all at once.
+ *
+ * Retired snapshots are kept, with the batches they have not seen, until
+ * their last reader lets go. The next standby is the most recent retired
+ * snapshot no reader holds, brought up to date by replaying the batches it
+ * missed. Only when every retired snapshot is still held, e.g. by a long
+ * scan, is the database copied, so each pinned snapshot costs at most one
+ * copy however many batches are published meanwhile.
+ */
+class ConcurrentFlightTripDatabase final
+{
+public:
+    using Snapshot = std::shared_ptr<const FlightTripDatabase>;
+
+    ConcurrentFlightTripDatabase() noexcept;
+
+    Snapshot GetSnapshot() const noexcept;
+    std::size_t Publish(const std::vector<TripMutation> &batch) noexcept;
+
+    template <typename FlightNumber, typename Origin, typename Destination, typename Operator, typename Fare>
+    bool AddTrip(FlightNumber &&flight_number, Origin &&origin_city, Destination &&destination_city,
+                 Operator &&flight_operator, Fare &&fare) noexcept
+    {
+        return Publish({TripMutation::AddTrip(std::string{std::forward<FlightNumber>(flight_number)},
+                                              std::string{std::forward<Origin>(origin_city)},
+                                              std::string{std::forward<Destination>(destination_city)},
+                                              std::string{std::forward<Operator>(flight_operator)},
+                                              static_cast<std::uint32_t>(fare))}) == 1U;
+    }
+
+    bool RemoveTrip(std::string_view flight_number) noexcept;
+    bool UpdateFareByTrip(std::string_view flight_number, std::uint32_t fare) noexcept;
+
+    template <typename Origin>
+    std::vector<FlightData> FindFlightsByOriginCity(Origin &&origin_city) const noexcept
+    {
+        return GetSnapshot()->FindFlightsByOriginCity(std::forward<Origin>(origin_city));
+    }
+
+    template <typename Operator>
+    std::uint32_t FindMaxFareByOperator(Operator &&flight_operator) const noexcept
+    {
+        return GetSnapshot()->FindMaxFareByOperator(std::forward<Operator>(flight_operator));
+    }
+
+    template <typename Origin, typename Destination>
+    std::uint32_t FindMinFareBetweenCities(Origin &&origin_city, Destination &&destination_city) const noexcept
+    {
+        return GetSnapshot()->FindMinFareBetweenCities(std::forward<Origin>(origin_city),
+                                                       std::forward<Destination>(destination_city));
+    }
+
+    bool IsTripInDatabase(std::string_view flight_number) const noexcept;
+    std::uint32_t FindAverageCostOfAllTrips() const noexcept;
+    std::optional<FlightData> FindFlightsByNumber(std::string_view flight_number) const noexcept;
+
+    /**
+     * Database copies held: the published snapshot, the standby and the
+     * retired snapshots readers still hold.
+     */
+    std::size_t GetVersionCount() const noexcept;
+
+private:
+    struct RetiredVersion
+    {
+        Snapshot database;
+        std::uint64_t batches_applied;
+    };
+
+    std::shared_ptr<FlightTripDatabase> TakeStandby() noexcept;
+
+    mutable std::mutex writer_mutex_{};
+    std::shared_ptr<FlightTripDatabase> standby_{};
+    std::atomic<Snapshot> current_{};
+    std::vector<RetiredVersion> retired_{};
+    std::deque<std::vector<TripMutation>> pending_batches_{};
+    std::uint64_t first_pending_batch_{0U};
+    std::uint64_t batches_published_{0U};
+};
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_CONCURRENT_FLIGHT_TRIP_DATABASE_H
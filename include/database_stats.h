@@ -0,0 +1,307 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_DATABASE_STATS_H
+#define FLIGHT_MANAGEMENT_INCLUDE_DATABASE_STATS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+
+#include "common_data.h"
+#include "latency_histogram.h"
+
+#ifndef FLIGHT_MANAGEMENT_ENABLE_STATS
+#define FLIGHT_MANAGEMENT_ENABLE_STATS 0
+#endif
+
+namespace flight_management
+{
+
+constexpr bool kStatsEnabled{FLIGHT_MANAGEMENT_ENABLE_STATS != 0};
+
+enum class StatsOperation : std::uint8_t
+{
+    kAddTrip = 0U,
+    kBulkLoad,
+    kRemoveTrip,
+    kUpdateFare,
+    kUpdateFaresByOperator,
+    kFindByNumber,
+    kFindByOriginCity,
+    kFindByFare,
+    kMinFareBetweenCities,
+    kMaxFareByOperator,
+    kCheapestItinerary,
+    kExecuteBatch,
+    kCount
+};
+
+constexpr std::size_t kStatsOperationCount{static_cast<std::size_t>(StatsOperation::kCount)};
+
+std::string_view StatsOperationName(StatsOperation operation) noexcept;
+
+struct OperationStats
+{
+    std::uint64_t count{0U};
+    std::uint64_t total_nanoseconds{0U};
+    std::uint64_t p50_nanoseconds{0U};
+    std::uint64_t p90_nanoseconds{0U};
+    std::uint64_t p99_nanoseconds{0U};
+    std::uint64_t max_nanoseconds{0U};
+    std::uint64_t index_probes{0U};
+    std::uint64_t result_rows{0U};
+};
+
+/**
+ * Point-in-time view of a database's counters. Index entries are always
+ * filled in; the rest stays zero unless built with
+ * FLIGHT_MANAGEMENT_ENABLE_STATS.
+ */
+struct DatabaseStats
+{
+    bool enabled{kStatsEnabled};
+    std::array<OperationStats, kStatsOperationCount> operations{};
+    std::uint64_t allocations{0U};
+    std::size_t storage_bytes{0U};
+    std::size_t index_bytes{0U};
+    IndexStatistics index_entries{};
+};
+
+/**
+ * stats in the Prometheus text exposition format, one family per metric
+ * and every name under prefix.
+ */
+std::string FormatPrometheus(const DatabaseStats &stats, std::string_view prefix = "flight_management");
+
+/**
+ * pmr resource that forwards to upstream and counts what passes through.
+ */
+class CountingMemoryResource final : public std::pmr::memory_resource
+{
+public:
+    explicit CountingMemoryResource(std::pmr::memory_resource *upstream) noexcept : upstream_{upstream}
+    {
+    }
+
+    std::pmr::memory_resource *GetUpstream() const noexcept
+    {
+        return upstream_;
+    }
+
+    std::uint64_t GetAllocations() const noexcept
+    {
+        return allocations_.load(std::memory_order_relaxed);
+    }
+
+    std::size_t GetOutstandingBytes() const noexcept
+    {
+        return outstanding_bytes_.load(std::memory_order_relaxed);
+    }
+
+private:
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        allocations_.fetch_add(1U, std::memory_order_relaxed);
+        outstanding_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+        return upstream_->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void *memory, std::size_t bytes, std::size_t alignment) override
+    {
+        outstanding_bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+        upstream_->deallocate(memory, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    std::pmr::memory_resource *upstream_;
+    std::atomic<std::uint64_t> allocations_{0U};
+    std::atomic<std::size_t> outstanding_bytes_{0U};
+};
+
+#if FLIGHT_MANAGEMENT_ENABLE_STATS
+
+/**
+ * A database's counters: a latency histogram, probe and row counts per
+ * operation, and counting resources in front of its storage and indexes.
+ * Heap-allocated so that moving the database leaves the resources its
+ * containers point at in place.
+ */
+class StatsRecorder
+{
+public:
+    explicit StatsRecorder(std::pmr::memory_resource *upstream) noexcept
+        : storage_{upstream},
+          indexes_{upstream}
+    {
+    }
+
+    void Record(StatsOperation operation, std::uint64_t nanoseconds, std::uint64_t probes,
+                std::uint64_t rows) noexcept
+    {
+        auto const index{static_cast<std::size_t>(operation)};
+        latencies_[index].Record(nanoseconds);
+        probes_[index].fetch_add(probes, std::memory_order_relaxed);
+        rows_[index].fetch_add(rows, std::memory_order_relaxed);
+    }
+
+    void Collect(DatabaseStats &stats) const noexcept;
+
+    CountingMemoryResource *GetStorageResource() noexcept
+    {
+        return &storage_;
+    }
+
+    CountingMemoryResource *GetIndexResource() noexcept
+    {
+        return &indexes_;
+    }
+
+private:
+    CountingMemoryResource storage_;
+    CountingMemoryResource indexes_;
+    std::array<LatencyHistogram, kStatsOperationCount> latencies_{};
+    std::array<std::atomic<std::uint64_t>, kStatsOperationCount> probes_{};
+    std::array<std::atomic<std::uint64_t>, kStatsOperationCount> rows_{};
+};
+
+class StatsHandle
+{
+public:
+    explicit StatsHandle(std::pmr::memory_resource *upstream) noexcept
+        : recorder_{std::make_unique<StatsRecorder>(upstream)}
+    {
+    }
+
+    std::pmr::memory_resource *StorageResource(std::pmr::memory_resource *) const noexcept
+    {
+        return recorder_->GetStorageResource();
+    }
+
+    std::pmr::memory_resource *IndexResource(std::pmr::memory_resource *) const noexcept
+    {
+        return recorder_->GetIndexResource();
+    }
+
+    static std::pmr::memory_resource *Unwrap(std::pmr::memory_resource *resource) noexcept
+    {
+        return static_cast<CountingMemoryResource *>(resource)->GetUpstream();
+    }
+
+    StatsRecorder *Get() const noexcept
+    {
+        return recorder_.get();
+    }
+
+    void Collect(DatabaseStats &stats) const noexcept
+    {
+        recorder_->Collect(stats);
+    }
+
+private:
+    std::unique_ptr<StatsRecorder> recorder_;
+};
+
+/**
+ * Times one public operation from construction to destruction and
+ * records it with the probes and result rows it was told about.
+ */
+class OperationScope
+{
+public:
+    OperationScope(const StatsHandle &stats, StatsOperation operation) noexcept
+        : recorder_{stats.Get()},
+          operation_{operation},
+          start_{std::chrono::steady_clock::now()}
+    {
+    }
+
+    ~OperationScope() noexcept
+    {
+        auto const elapsed{std::chrono::steady_clock::now() - start_};
+        recorder_->Record(operation_,
+                          static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()),
+                          probes_, rows_);
+    }
+
+    OperationScope(const OperationScope &) = delete;
+    OperationScope &operator=(const OperationScope &) = delete;
+
+    void AddProbes(std::uint64_t probes) noexcept
+    {
+        probes_ += probes;
+    }
+
+    void AddRows(std::uint64_t rows) noexcept
+    {
+        rows_ += rows;
+    }
+
+private:
+    StatsRecorder *recorder_;
+    StatsOperation operation_;
+    std::chrono::steady_clock::time_point start_;
+    std::uint64_t probes_{0U};
+    std::uint64_t rows_{0U};
+};
+
+#else
+
+// Without FLIGHT_MANAGEMENT_ENABLE_STATS every hook is an empty inline call.
+class StatsHandle
+{
+public:
+    explicit StatsHandle(std::pmr::memory_resource *) noexcept
+    {
+    }
+
+    std::pmr::memory_resource *StorageResource(std::pmr::memory_resource *upstream) const noexcept
+    {
+        return upstream;
+    }
+
+    std::pmr::memory_resource *IndexResource(std::pmr::memory_resource *upstream) const noexcept
+    {
+        return upstream;
+    }
+
+    static std::pmr::memory_resource *Unwrap(std::pmr::memory_resource *resource) noexcept
+    {
+        return resource;
+    }
+
+    void Collect(DatabaseStats &) const noexcept
+    {
+    }
+};
+
+class OperationScope
+{
+public:
+    OperationScope(const StatsHandle &, StatsOperation) noexcept
+    {
+    }
+
+    OperationScope(const OperationScope &) = delete;
+    OperationScope &operator=(const OperationScope &) = delete;
+
+    void AddProbes(std::uint64_t) noexcept
+    {
+    }
+
+    void AddRows(std::uint64_t) noexcept
+    {
+    }
+};
+
+#endif
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_DATABASE_STATS_H
@@ -0,0 +1,69 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_DURABLE_FLIGHT_TRIP_DATABASE_H
+#define FLIGHT_MANAGEMENT_INCLUDE_DURABLE_FLIGHT_TRIP_DATABASE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "flight_trip_database.h"
+#include "write_ahead_log.h"
+
+namespace flight_management
+{
+
+/**
+ * A FlightTripDatabase whose mutations are recorded in a write-ahead log.
+ *
+ * Open recovers the last snapshot and replays the log tail on top of it.
+ * Only mutations that changed the database are logged, and every record
+ * sets absolute state, so replaying a log whose effects the snapshot
+ * already holds converges to the same trips. That makes a crash between
+ * writing the checkpoint snapshot and resetting the log harmless.
+ *
+ * Each mutation is logged before it is applied and applied only once the
+ * log has taken it, so a mutation that fails to log leaves the database
+ * untouched and returns false. It is durable once Append has synced it
+ * under the configured Durability level, or after Commit returns.
+ */
+class DurableFlightTripDatabase final
+{
+public:
+    static std::unique_ptr<DurableFlightTripDatabase> Open(const std::string &snapshot_path,
+                                                           const std::string &log_path,
+                                                           WalOptions options = {}) noexcept;
+
+    template <typename FlightNumber, typename Origin, typename Destination, typename Operator, typename Fare>
+    bool AddTrip(FlightNumber &&flight_number, Origin &&origin_city, Destination &&destination_city,
+                 Operator &&flight_operator, Fare &&fare) noexcept
+    {
+        TripRecordView const record{std::string_view{flight_number}, std::string_view{origin_city},
+                                    std::string_view{destination_city}, std::string_view{flight_operator},
+                                    static_cast<std::uint32_t>(fare)};
+
+        return !database_->IsTripInDatabase(record.flight_number) && log_->Append(MutationKind::kAddTrip, record) &&
+               database_->AddTrip(record.flight_number, record.origin_city, record.destination_city,
+                                  record.flight_operator, record.fare);
+    }
+
+    bool RemoveTrip(std::string_view flight_number) noexcept;
+    bool UpdateFareByTrip(std::string_view flight_number, std::uint32_t fare) noexcept;
+    bool Commit() noexcept;
+    bool Checkpoint() noexcept;
+
+    const FlightTripDatabase &GetDatabase() const noexcept;
+    std::size_t GetRecoveredMutations() const noexcept;
+
+private:
+    DurableFlightTripDatabase(std::string snapshot_path, std::unique_ptr<FlightTripDatabase> database,
+                              std::unique_ptr<WriteAheadLog> log, std::size_t recovered_mutations) noexcept;
+
+    std::string snapshot_path_;
+    std::unique_ptr<FlightTripDatabase> database_;
+    std::unique_ptr<WriteAheadLog> log_;
+    std::size_t recovered_mutations_;
+};
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_DURABLE_FLIGHT_TRIP_DATABASE_H
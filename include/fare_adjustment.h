@@ -0,0 +1,47 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_FARE_ADJUSTMENT_H
+#define FLIGHT_MANAGEMENT_INCLUDE_FARE_ADJUSTMENT_H
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace flight_management
+{
+
+/**
+ * Relative fare change in whole percent, -10 lowers every fare by 10%.
+ * Results are truncated and saturate at zero and at the fare range.
+ */
+struct FarePercentage
+{
+    std::uint32_t operator()(std::uint32_t fare) const noexcept
+    {
+        // fare * (100 + percentage) / 100, taken as fare + floor(fare * percentage / 100):
+        // equal wherever the result is not clamped to 0, and the product cannot overflow.
+        std::int64_t const change{static_cast<std::int64_t>(fare) * static_cast<std::int64_t>(percentage)};
+        std::int64_t const adjusted{static_cast<std::int64_t>(fare) + change / 100 - (change % 100 < 0 ? 1 : 0)};
+
+        return static_cast<std::uint32_t>(
+            std::clamp<std::int64_t>(adjusted, 0, std::numeric_limits<std::uint32_t>::max()));
+    }
+
+    std::int32_t percentage{0};
+};
+
+/**
+ * Applies adjust element-wise from one contiguous fare block to another.
+ * The loop is branch-free so simple adjustments vectorize.
+ */
+template <typename Adjustment>
+void AdjustFares(const std::uint32_t *fares, std::uint32_t *adjusted_fares, std::size_t count,
+                 Adjustment &&adjust) noexcept
+{
+    for (std::size_t index = 0U; index < count; ++index)
+    {
+        adjusted_fares[index] = adjust(fares[index]);
+    }
+}
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_FARE_ADJUSTMENT_H
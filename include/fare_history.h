@@ -0,0 +1,146 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_FARE_HISTORY_H
+#define FLIGHT_MANAGEMENT_INCLUDE_FARE_HISTORY_H
+
+#include <cstdint>
+#include <memory_resource>
+#include <unordered_set>
+#include <vector>
+
+#include "common_data.h"
+#include "trip_columns.h"
+
+namespace flight_management
+{
+
+/**
+ * Position in a database's change sequence: every recorded trip change
+ * takes the next version, so version v is the state after v changes.
+ */
+using FareVersion = std::uint64_t;
+
+/**
+ * MVCC-style undo log of trip changes. The columns hold the newest state;
+ * for every change the log keeps what it replaced, so any retained
+ * version is recovered by walking a trip's chain back from the present.
+ *
+ * Chains share one byte log. An event is a handful of varints: the
+ * distance back to the trip's previous event, its version relative to
+ * the retention horizon and, for a fare change, the zigzagged fare delta.
+ * Only a removal stores a full row. A trip whose one change is its
+ * insertion keeps that version in its head slot and no log bytes at all.
+ *
+ * Once the log has doubled since the last pass, versions older than the
+ * retention window are dropped and the survivors are rewritten
+ * trip by trip, which also packs each chain contiguously again.
+ */
+class FareHistory
+{
+public:
+    static constexpr FareVersion kDefaultRetention{FareVersion{1U} << 20U};
+
+    explicit FareHistory(std::pmr::memory_resource *resource = std::pmr::get_default_resource()) noexcept
+        : log_{resource},
+          heads_{resource},
+          displaced_{resource}
+    {
+    }
+
+    void RecordInsert(TripId trip) noexcept;
+
+    /**
+     * All of trips become visible together, at a single version.
+     */
+    void RecordBulkInsert(const std::vector<TripId> &trips) noexcept;
+
+    void RecordFareChange(TripId trip, std::uint32_t old_fare, std::uint32_t new_fare) noexcept;
+
+    /**
+     * removed is the row as it stood before the removal.
+     */
+    void RecordRemoval(TripId trip, const TripState &removed) noexcept;
+
+    /**
+     * The trip as it stood at version, given its current state. Versions
+     * older than GetOldestVersion() read as that oldest version.
+     */
+    TripState StateAt(TripId trip, const TripState &current, FareVersion version) const noexcept;
+
+    /**
+     * Visits every trip removed within the retention window: such a trip
+     * may have been live at a retained version without being in any index
+     * now.
+     */
+    template <typename Visit>
+    void ForEachDisplaced(Visit &&visit) const noexcept
+    {
+        for (TripId trip : displaced_)
+        {
+            visit(trip);
+        }
+    }
+
+    /**
+     * Drops every version older than the retention window and compacts
+     * the log. Returns the number of log bytes released.
+     */
+    std::size_t Collect() noexcept;
+
+    void SetRetention(FareVersion versions) noexcept
+    {
+        retention_ = versions;
+    }
+
+    FareVersion GetRetention() const noexcept
+    {
+        return retention_;
+    }
+
+    FareVersion GetVersion() const noexcept
+    {
+        return version_;
+    }
+
+    FareVersion GetOldestVersion() const noexcept
+    {
+        return horizon_;
+    }
+
+    std::size_t GetLogBytes() const noexcept
+    {
+        return log_.size();
+    }
+
+private:
+    enum class EventKind : std::uint8_t
+    {
+        kFareChange = 0U, // payload: zigzag(new fare - old fare)
+        kInsert = 1U,     // trip absent before
+        kRemoval = 2U     // payload: fare; origin, destination and operator follow
+    };
+
+    struct Event
+    {
+        FareVersion version;
+        EventKind kind;
+        std::uint64_t payload;
+        TripState removed;
+        std::size_t previous; // offset + 1 of the trip's previous event, 0 for none
+    };
+
+    std::uint64_t &HeadOf(TripId trip) noexcept;
+    void Append(TripId trip, const Event &event) noexcept;
+    Event Decode(std::size_t offset) const noexcept;
+    void MaybeCollect() noexcept;
+
+    std::pmr::vector<std::uint8_t> log_;
+    std::pmr::vector<std::uint64_t> heads_; // offset + 1 of the newest event, or an inline insert version
+    std::pmr::unordered_set<TripId> displaced_;
+    FareVersion version_{0U};
+    FareVersion horizon_{0U};
+    FareVersion retention_{kDefaultRetention};
+    std::size_t collected_bytes_{0U};
+};
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_FARE_HISTORY_H
@@ -0,0 +1,146 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_FARE_ORDERED_INDEX_H
+#define FLIGHT_MANAGEMENT_INCLUDE_FARE_ORDERED_INDEX_H
+
+#include <algorithm>
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common_data.h"
+
+namespace flight_management
+{
+
+using FareEntry = std::pair<std::uint32_t, TripId>;
+
+/**
+ * For every key the trips ordered by fare, so the cheapest and dearest
+ * trip are read off the ends and removing either costs O(log n).
+ */
+template <typename KeyType>
+class FareOrderedIndex
+{
+public:
+    using Key = KeyType;
+    using Entries = std::pmr::set<FareEntry>;
+    using Container = std::pmr::unordered_map<Key, Entries>;
+
+    explicit FareOrderedIndex(std::pmr::memory_resource *resource = std::pmr::get_default_resource()) noexcept
+        : container_{resource}
+    {
+    }
+
+    bool Add(Key key, std::uint32_t fare, TripId trip) noexcept
+    {
+        return container_[key].emplace(fare, trip).second;
+    }
+
+    /**
+     * Sort-then-build insertion: entries arrive grouped by key and in fare
+     * order, so each lands at the hinted end of its set.
+     */
+    void BulkAdd(std::vector<std::pair<Key, FareEntry>> entries) noexcept
+    {
+        std::sort(entries.begin(), entries.end());
+
+        for (auto group = entries.cbegin(); group != entries.cend();)
+        {
+            Entries &fares{container_[group->first]};
+
+            for (auto const key{group->first}; group != entries.cend() && group->first == key; ++group)
+            {
+                fares.emplace_hint(fares.cend(), group->second);
+            }
+        }
+    }
+
+    bool Remove(Key key, std::uint32_t fare, TripId trip) noexcept
+    {
+        auto const entries{container_.find(key)};
+
+        if (entries == container_.end() || entries->second.erase(FareEntry{fare, trip}) == 0U)
+        {
+            return false;
+        }
+
+        if (entries->second.empty())
+        {
+            container_.erase(entries);
+        }
+
+        return true;
+    }
+
+    bool UpdateFare(Key key, std::uint32_t old_fare, std::uint32_t new_fare, TripId trip) noexcept
+    {
+        return Remove(key, old_fare, trip) && Add(key, new_fare, trip);
+    }
+
+    std::optional<FareEntry> FindMin(Key key) const noexcept
+    {
+        auto const entries{container_.find(key)};
+
+        return (entries != container_.cend()) ? std::make_optional(*entries->second.cbegin()) : std::nullopt;
+    }
+
+    std::optional<FareEntry> FindMax(Key key) const noexcept
+    {
+        auto const entries{container_.find(key)};
+
+        return (entries != container_.cend()) ? std::make_optional(*entries->second.crbegin()) : std::nullopt;
+    }
+
+    /**
+     * Visits the key's trips with min_fare <= fare <= max_fare in ascending
+     * fare order until visit returns false: one O(log n) seek, then O(1)
+     * per visited trip, however many trips the key holds.
+     */
+    template <typename Visit>
+    void VisitFareRange(Key key, std::uint32_t min_fare, std::uint32_t max_fare, Visit &&visit) const noexcept
+    {
+        auto const entries{container_.find(key)};
+
+        if (entries == container_.cend())
+        {
+            return;
+        }
+
+        for (auto entry = entries->second.lower_bound(FareEntry{min_fare, 0U});
+             entry != entries->second.cend() && entry->first <= max_fare && visit(*entry); ++entry)
+        {
+        }
+    }
+
+    std::size_t KeyCount() const noexcept
+    {
+        return container_.size();
+    }
+
+private:
+    Container container_;
+};
+
+using RouteKey = std::uint64_t;
+
+constexpr RouteKey MakeRouteKey(InternId origin, InternId destination) noexcept
+{
+    return (static_cast<RouteKey>(origin) << 32U) | destination;
+}
+
+constexpr InternId RouteOrigin(RouteKey route) noexcept
+{
+    return static_cast<InternId>(route >> 32U);
+}
+
+constexpr InternId RouteDestination(RouteKey route) noexcept
+{
+    return static_cast<InternId>(route);
+}
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_FARE_ORDERED_INDEX_H
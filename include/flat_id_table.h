@@ -0,0 +1,207 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_FLAT_ID_TABLE_H
+#define FLIGHT_MANAGEMENT_INCLUDE_FLAT_ID_TABLE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "common_data.h"
+
+namespace flight_management
+{
+
+/**
+ * Open-addressing hash table of dense ids, Swiss-table style. A slot
+ * holds only its 4-byte id; the caller resolves ids back to their keys
+ * to compare and rehash, so the table is two flat arrays: ids and one
+ * control byte per slot, either empty or the low 7 bits of the slot's
+ * hash.
+ *
+ * Slots are probed a 16-wide group at a time: one compare of the group's
+ * control bytes (SSE2 where available) finds the few slots worth a key
+ * comparison, and an empty byte in the group ends the search. Groups
+ * follow a triangular sequence, which visits every group of a
+ * power-of-two table. Ids are never erased, so there are no tombstones.
+ */
+class FlatIdTable
+{
+public:
+    static constexpr std::size_t kGroupWidth{16U};
+
+    explicit FlatIdTable(std::pmr::memory_resource *resource = std::pmr::get_default_resource()) noexcept
+        : control_{resource},
+          slots_{resource}
+    {
+    }
+
+    /**
+     * The id with this hash for which matches(id) holds, or
+     * kInvalidInternId.
+     */
+    template <typename Matches>
+    InternId Find(std::size_t hash, Matches &&matches) const noexcept
+    {
+        if (control_.empty())
+        {
+            return kInvalidInternId;
+        }
+
+        std::size_t const group_mask{control_.size() / kGroupWidth - 1U};
+        std::size_t group{(hash >> kTagBits) & group_mask};
+
+        for (std::size_t step = 1U;; ++step)
+        {
+            std::size_t const first{group * kGroupWidth};
+
+            for (std::uint32_t match = MatchGroup(first, TagOf(hash)); match != 0U; match &= match - 1U)
+            {
+                InternId const id{slots_[first + static_cast<std::size_t>(__builtin_ctz(match))]};
+                if (matches(id))
+                {
+                    return id;
+                }
+            }
+
+            if (MatchGroup(first, kEmpty) != 0U)
+            {
+                return kInvalidInternId;
+            }
+
+            group = (group + step) & group_mask;
+        }
+    }
+
+    /**
+     * Adds id, which must not be in the table yet. hash_of(id) gives the
+     * hash of any id already inserted, for rehashing on growth.
+     */
+    template <typename HashOf>
+    void Insert(std::size_t hash, InternId id, HashOf &&hash_of) noexcept
+    {
+        if ((size_ + 1U) * kMaxLoadDenominator > control_.size() * kMaxLoadNumerator)
+        {
+            Rehash(std::max(control_.size() * 2U, kGroupWidth), hash_of);
+        }
+
+        Place(hash, id);
+    }
+
+    /**
+     * Grows the table to hold count ids without rehashing again.
+     */
+    template <typename HashOf>
+    void Reserve(std::size_t count, HashOf &&hash_of) noexcept
+    {
+        std::size_t capacity{kGroupWidth};
+        while (count * kMaxLoadDenominator > capacity * kMaxLoadNumerator)
+        {
+            capacity *= 2U;
+        }
+
+        if (capacity > control_.size())
+        {
+            Rehash(capacity, hash_of);
+        }
+    }
+
+    void Clear() noexcept
+    {
+        control_.clear();
+        slots_.clear();
+        size_ = 0U;
+    }
+
+    std::size_t Size() const noexcept
+    {
+        return size_;
+    }
+
+    std::size_t GetCapacity() const noexcept
+    {
+        return control_.size();
+    }
+
+private:
+    static constexpr unsigned kTagBits{7U};
+    static constexpr std::int8_t kEmpty{-128};
+
+    // Grow past a load factor of 7/8.
+    static constexpr std::size_t kMaxLoadNumerator{7U};
+    static constexpr std::size_t kMaxLoadDenominator{8U};
+
+    static std::int8_t TagOf(std::size_t hash) noexcept
+    {
+        return static_cast<std::int8_t>(hash & ((1U << kTagBits) - 1U));
+    }
+
+    // Bit i is set when control byte i of the group equals value.
+    std::uint32_t MatchGroup(std::size_t first, std::int8_t value) const noexcept
+    {
+#if defined(__SSE2__)
+        __m128i const group{_mm_loadu_si128(reinterpret_cast<const __m128i *>(control_.data() + first))};
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(value))));
+#else
+        std::uint32_t match{0U};
+        for (std::size_t index = 0U; index < kGroupWidth; ++index)
+        {
+            match |= static_cast<std::uint32_t>(control_[first + index] == value) << index;
+        }
+        return match;
+#endif
+    }
+
+    void Place(std::size_t hash, InternId id) noexcept
+    {
+        std::size_t const group_mask{control_.size() / kGroupWidth - 1U};
+        std::size_t group{(hash >> kTagBits) & group_mask};
+
+        for (std::size_t step = 1U;; ++step)
+        {
+            std::size_t const first{group * kGroupWidth};
+            std::uint32_t const empty{MatchGroup(first, kEmpty)};
+
+            if (empty != 0U)
+            {
+                std::size_t const slot{first + static_cast<std::size_t>(__builtin_ctz(empty))};
+                control_[slot] = TagOf(hash);
+                slots_[slot] = id;
+                ++size_;
+                return;
+            }
+
+            group = (group + step) & group_mask;
+        }
+    }
+
+    template <typename HashOf>
+    void Rehash(std::size_t capacity, HashOf &hash_of) noexcept
+    {
+        std::pmr::vector<std::int8_t> control(capacity, kEmpty, control_.get_allocator());
+        std::pmr::vector<InternId> slots(capacity, kInvalidInternId, slots_.get_allocator());
+
+        control.swap(control_);
+        slots.swap(slots_);
+        size_ = 0U;
+
+        for (std::size_t slot = 0U; slot < control.size(); ++slot)
+        {
+            if (control[slot] != kEmpty)
+            {
+                Place(hash_of(slots[slot]), slots[slot]);
+            }
+        }
+    }
+
+    std::pmr::vector<std::int8_t> control_;
+    std::pmr::vector<InternId> slots_;
+    std::size_t size_{0U};
+};
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_FLAT_ID_TABLE_H
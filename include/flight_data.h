@@ -3,16 +3,18 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <ostream>
 #include <tuple>
+#include <vector>
 
 namespace flight_management
 {
 class FlightData
 {
 public:
-    FlightData(const std::string &flightNumber, const std::string &origin_city, const std::string &destination_city,
-               const std::string &flight_operator, std::uint32_t fare) noexcept
+    FlightData(std::string_view flightNumber, std::string_view origin_city, std::string_view destination_city,
+               std::string_view flight_operator, std::uint32_t fare) noexcept
         : flight_number_{flightNumber},
           origin_city_{origin_city},
           destination_city_{destination_city},
@@ -25,10 +27,30 @@ public:
     ~FlightData() noexcept = default;
 
     FlightData(const FlightData &) = default;
-    FlightData &operator=(const FlightData &) noexcept = delete;
+    FlightData &operator=(const FlightData &) = default;
 
-    FlightData(FlightData &&) noexcept = delete;
-    FlightData &operator=(FlightData &&) noexcept = delete;
+    FlightData(FlightData &&) noexcept = default;
+    FlightData &operator=(FlightData &&) noexcept = default;
+
+    const std::string &GetFlightNumber() const noexcept
+    {
+        return flight_number_;
+    }
+
+    const std::string &GetOriginCity() const noexcept
+    {
+        return origin_city_;
+    }
+
+    const std::string &GetDestinationCity() const noexcept
+    {
+        return destination_city_;
+    }
+
+    const std::string &GetOperator() const noexcept
+    {
+        return operator_;
+    }
 
     void SetAirFare(const std::uint32_t fare) noexcept
     {
@@ -68,6 +90,15 @@ private:
     std::uint32_t air_fare_{};
 };
 
+/**
+ * A multi-leg journey: its flights in flying order and their summed fare.
+ */
+struct Itinerary
+{
+    std::uint64_t total_fare{0U};
+    std::vector<FlightData> legs{};
+};
+
 } // namespace flight_management
 
 #endif //FLIGHT_MANAGEMENT_INCLUDE_FLIGHT_DATA_H
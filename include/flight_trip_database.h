@@ -3,131 +3,651 @@
 
 #include <map>
 #include <string>
+#include <string_view>
 #include <memory>
+#include <memory_resource>
 #include <vector>
 #include <algorithm>
 #include <optional>
 #include <climits>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
 
 #include "common_data.h"
+#include "database_stats.h"
+#include "fare_adjustment.h"
+#include "fare_ordered_index.h"
 #include "flight_data.h"
 #include "helper_database.h"
+#include "mutation_stream.h"
+#include "query_batch.h"
+#include "string_interner.h"
+#include "trip_aggregates.h"
+#include "trip_columns.h"
+#include "trip_index_schema.h"
+#include "trip_mutation.h"
+#include "trip_record.h"
+#include "trip_view.h"
+#include "work_stealing_thread_pool.h"
 
 namespace flight_management
 {
 
-    class FlightTripDatabase final
+    class CompressedFlightTripDatabase;
+    class MappedFlightTripDatabase;
+
+    enum class TripOrder : std::uint8_t
     {
-        using FlightDatabase = std::map<std::string, FlightData>;
-        using HelperFlightDatabase = HelperDatabase<
-            BaseDataset<Filters::kOrigin>,
-            BaseDataset<Filters::kDestination>,
-            BaseDataset<Filters::kFlightOperator>>;
+        kRowOrder = 0U,      // storage order: by when each flight number was first added
+        kByFlightNumber = 1U // sorted, at the cost of a sort over every live trip
+    };
+
+    /**
+     * Trip store whose secondary indexes are fixed at compile time by
+     * Schema, a TripSchema. Every index is kept in step through the same
+     * insert, erase and fare-change hooks; queries name the index they
+     * read and fail to compile when the schema leaves it out.
+     *
+     * Member definitions live in flight_trip_database.cpp and are
+     * instantiated there for FullTripSchema and MinimalTripSchema.
+     */
+    template <typename Schema>
+    class BasicFlightTripDatabase final
+    {
+        using IndexSet = typename Schema::IndexSet;
+
+        static_assert(!Schema::template kHas<RouteGraphIndex> || Schema::template kHas<RouteFares>,
+                      "RouteGraphIndex takes its edge fares from RouteFares");
 
     public:
+        using TripView = BasicTripView<BasicFlightTripDatabase>;
+
+        template <typename Index>
+        using TripRange = BasicTripRange<BasicFlightTripDatabase, Index>;
+
+        /**
+         * Every string, column, postings list and fare index node is drawn
+         * from resource, which must outlive the database. Copies allocate
+         * from the default resource and start with empty stats.
+         */
+        explicit BasicFlightTripDatabase(
+            std::pmr::memory_resource *resource = std::pmr::get_default_resource()) noexcept;
+
+        /**
+         * A database backed by its own monotonic arena for bulk-loaded,
+         * read-mostly data: allocation is a pointer bump and nothing is
+         * returned until the database is destroyed, so churn only grows it.
+         */
+        static BasicFlightTripDatabase WithMonotonicArena(std::size_t initial_bytes = 1U << 20U) noexcept;
+
+        BasicFlightTripDatabase(const BasicFlightTripDatabase &other) noexcept;
+        BasicFlightTripDatabase(BasicFlightTripDatabase &&) noexcept = default;
+        ~BasicFlightTripDatabase() noexcept = default;
+
+        // Assignment would leave containers on the old arena, so it is not offered.
+        BasicFlightTripDatabase &operator=(const BasicFlightTripDatabase &) = delete;
+        BasicFlightTripDatabase &operator=(BasicFlightTripDatabase &&) = delete;
+
         template <typename FlightNumber, typename Origin, typename Destination, typename Operator, typename Fare>
         bool AddTrip(FlightNumber &&flight_number, Origin &&origin_city, Destination &&destination_city,
                      Operator &&flight_operator, Fare &&fare) noexcept
         {
-            auto const &add_result = flight_database_.emplace(
-                std::piecewise_construct,
-                std::forward_as_tuple(std::forward<FlightNumber>(flight_number)),
-                std::forward_as_tuple(
-                    std::forward<FlightNumber>(flight_number),
-                    std::forward<Origin>(origin_city),
-                    std::forward<Destination>(destination_city),
-                    std::forward<Operator>(flight_operator),
-                    std::forward<Fare>(fare)));
-
-            bool result_origin_add{helper_database_.Add<Filters::kOrigin>(std::forward<Origin>(origin_city),
-                                                                          std::forward<Origin>(flight_number))};
-            bool result_origin_destination{helper_database_.Add<Filters::kDestination>(std::forward<Origin>(destination_city),
-                                                                                       std::forward<Origin>(flight_number))};
-            bool result_operator_add{helper_database_.Add<Filters::kOrigin>(std::forward<Operator>(flight_operator),
-                                                                            std::forward<Origin>(flight_number))};
-
-            return add_result.second && result_origin_add && result_origin_destination && result_operator_add;
+            return InsertTrip(std::string_view{flight_number}, std::string_view{origin_city},
+                              std::string_view{destination_city}, std::string_view{flight_operator},
+                              static_cast<std::uint32_t>(fare));
         }
 
         template <typename Origin>
         std::vector<FlightData> FindFlightsByOriginCity(Origin &&origin_city) const noexcept
         {
-            std::vector<std::string> flights_by_origin{
-                helper_database_.GetValuesForKey<Filters::kOrigin>(std::forward<Origin>(origin_city))};
-
+            OperationScope scope{stats_, StatsOperation::kFindByOriginCity};
             std::vector<FlightData> flight_data;
-            flight_data.reserve(flights_by_origin.size());
 
-            std::for_each(flights_by_origin.begin(), flights_by_origin.end(),
-                          [this, &flight_data](const auto &flight_number) {
-                              if (IsTripInDatabase(flight_number))
-                              {
-                                  flight_data.emplace_back(flight_database_.at(flight_number));
-                              }
-                          });
+            for (TripView const trip : ViewFlightsByOriginCity(std::forward<Origin>(origin_city)))
+            {
+                flight_data.emplace_back(MakeFlightData(trip.GetTripId()));
+            }
+
+            scope.AddProbes(2U);
+            scope.AddRows(flight_data.size());
 
             return flight_data;
         }
 
+        /**
+         * Allocation-free counterpart of FindFlightsByOriginCity: a range of
+         * TripView over the origin postings. Views read the database lazily
+         * and are invalidated by any mutation.
+         */
+        template <typename Origin>
+        TripRange<OriginPostings> ViewFlightsByOriginCity(Origin &&origin_city) const noexcept
+        {
+            static_assert(Schema::template kHas<OriginPostings>, "origin queries need OriginPostings in the schema");
+
+            return TripRange<OriginPostings>{*this, cities_.Find(std::string_view{origin_city})};
+        }
+
         template <typename Operator>
         std::uint32_t FindMaxFareByOperator(Operator &&flight_operator) const noexcept
         {
-            std::uint32_t max_fare{0U};
+            static_assert(Schema::template kHas<OperatorFares>, "FindMaxFareByOperator needs OperatorFares in the schema");
+
+            OperationScope scope{stats_, StatsOperation::kMaxFareByOperator};
+            scope.AddProbes(1U);
 
-            std::vector<std::string> flights_by_operator{
-                helper_database_.GetValuesForKey<Filters::kOrigin>(std::forward<Operator>(flight_operator))};
+            InternId const operator_id{operators_.Find(std::string_view{flight_operator})};
+            if (operator_id == kInvalidInternId)
+            {
+                return 0U;
+            }
 
-            std::for_each(flights_by_operator.begin(), flights_by_operator.end(),
-                          [this, &max_fare](const auto &flight_number) {
-                              if (IsTripInDatabase(flight_number))
-                              {
-                                  max_fare = std::max(max_fare, flight_database_.at(flight_number).GetAirFare());
-                              }
-                          });
+            auto const max_fare{indexes_.template Get<OperatorFares>().FindMax(operator_id)};
+            scope.AddProbes(1U);
+            scope.AddRows(max_fare ? 1U : 0U);
 
-            return max_fare;
+            return max_fare ? max_fare->first : 0U;
         }
 
         template <typename Origin, typename Destination>
         std::uint32_t FindMinFareBetweenCities(Origin &&origin_city, Destination &&destination_city) const noexcept
         {
-            std::vector<std::string> flights_by_origin{
-                helper_database_.GetValuesForKey<Filters::kOrigin>(std::forward<Origin>(origin_city))};
+            static_assert(Schema::template kHas<RouteFares>, "route queries need RouteFares in the schema");
+
+            OperationScope scope{stats_, StatsOperation::kMinFareBetweenCities};
+            auto const cheapest{FindCheapestTrip(std::string_view{origin_city}, std::string_view{destination_city})};
+            scope.AddProbes(3U);
+            scope.AddRows(cheapest ? 1U : 0U);
+
+            return cheapest ? cheapest->first : UINT_MAX;
+        }
+
+        template <typename Origin, typename Destination>
+        std::optional<FlightData> FindCheapestFlightBetweenCities(Origin &&origin_city,
+                                                                  Destination &&destination_city) const noexcept
+        {
+            static_assert(Schema::template kHas<RouteFares>, "route queries need RouteFares in the schema");
+
+            OperationScope scope{stats_, StatsOperation::kMinFareBetweenCities};
+            auto const cheapest{FindCheapestTrip(std::string_view{origin_city}, std::string_view{destination_city})};
+            scope.AddProbes(3U);
+            scope.AddRows(cheapest ? 1U : 0U);
+
+            return cheapest ? std::make_optional(MakeFlightData(cheapest->second)) : std::nullopt;
+        }
+
+        /**
+         * Cheapest way from origin_city to destination_city with at most
+         * max_stops intermediate stops, each leg the route's cheapest trip.
+         */
+        template <typename Origin, typename Destination>
+        std::optional<Itinerary> FindCheapestItinerary(Origin &&origin_city, Destination &&destination_city,
+                                                       std::size_t max_stops) const noexcept
+        {
+            static_assert(Schema::template kHas<RouteGraphIndex>, "itinerary search needs RouteGraphIndex in the schema");
+
+            OperationScope scope{stats_, StatsOperation::kCheapestItinerary};
+            auto const path{indexes_.template Get<RouteGraphIndex>().FindCheapestPath(
+                cities_.Find(std::string_view{origin_city}), cities_.Find(std::string_view{destination_city}),
+                LegsFor(max_stops))};
+            scope.AddProbes(2U);
+            scope.AddRows(path ? path->legs.size() : 0U);
+
+            return path ? std::make_optional(MakeItinerary(*path)) : std::nullopt;
+        }
+
+        /**
+         * FindCheapestItinerary for every (origin, destination) pair, searched
+         * on pool and the calling thread. Results are in the order of queries.
+         */
+        template <typename City>
+        std::vector<std::optional<Itinerary>> FindCheapestItineraries(const std::vector<std::pair<City, City>> &queries,
+                                                                      std::size_t max_stops,
+                                                                      WorkStealingThreadPool &pool) const noexcept
+        {
+            static_assert(Schema::template kHas<RouteGraphIndex>, "itinerary search needs RouteGraphIndex in the schema");
+
+            OperationScope scope{stats_, StatsOperation::kCheapestItinerary};
+            std::vector<std::pair<InternId, InternId>> city_pairs{};
+            city_pairs.reserve(queries.size());
+
+            for (auto const &query : queries)
+            {
+                city_pairs.emplace_back(cities_.Find(std::string_view{query.first}),
+                                        cities_.Find(std::string_view{query.second}));
+            }
+
+            auto const paths{
+                indexes_.template Get<RouteGraphIndex>().FindCheapestPaths(city_pairs, LegsFor(max_stops), pool)};
+
+            std::vector<std::optional<Itinerary>> itineraries{};
+            itineraries.reserve(paths.size());
+
+            for (auto const &path : paths)
+            {
+                itineraries.push_back(path ? std::make_optional(MakeItinerary(*path)) : std::nullopt);
+                scope.AddRows(path ? path->legs.size() : 0U);
+            }
+            scope.AddProbes(city_pairs.size() * 2U);
+
+            return itineraries;
+        }
+
+        /**
+         * Flights from origin_city with min_fare <= fare <= max_fare, cheapest
+         * first. Read straight off the origin's fare-ordered trips, so the
+         * cost follows the number of flights returned, not the city's size.
+         */
+        template <typename Origin>
+        std::vector<FlightData> FindFlightsByOriginInFareRange(Origin &&origin_city, std::uint32_t min_fare,
+                                                               std::uint32_t max_fare) const noexcept
+        {
+            static_assert(Schema::template kHas<OriginFares>, "fare range queries need OriginFares in the schema");
+
+            return CollectByFare<OriginFares>(cities_.Find(std::string_view{origin_city}), min_fare, max_fare,
+                                              SIZE_MAX);
+        }
+
+        template <typename Origin>
+        std::vector<FlightData> FindTopKCheapest(Origin &&origin_city, std::size_t count) const noexcept
+        {
+            static_assert(Schema::template kHas<OriginFares>, "top-k queries need OriginFares in the schema");
+
+            return CollectByFare<OriginFares>(cities_.Find(std::string_view{origin_city}), 0U, UINT32_MAX, count);
+        }
+
+        template <typename Operator>
+        std::vector<FlightData> FindTopKCheapestByOperator(Operator &&flight_operator, std::size_t count) const noexcept
+        {
+            static_assert(Schema::template kHas<OperatorFares>,
+                          "FindTopKCheapestByOperator needs OperatorFares in the schema");
+
+            return CollectByFare<OperatorFares>(operators_.Find(std::string_view{flight_operator}), 0U, UINT32_MAX,
+                                                count);
+        }
+
+        /**
+         * Point-in-time reads: each answers as the single-version call would
+         * have at version, a value once returned by GetFareVersion(). A
+         * version older than GetOldestFareVersion() reads as the oldest one
+         * retained. Cost follows the trips under the key now plus those
+         * removed within the retention window.
+         */
+        template <typename FlightNumber>
+        std::optional<FlightData> FindFlightsByNumber(FlightNumber &&flight_number, FareVersion version) const noexcept
+        {
+            static_assert(Schema::template kHas<FareHistoryIndex>, "versioned reads need FareHistoryIndex in the schema");
+
+            OperationScope scope{stats_, StatsOperation::kFindByNumber};
+            TripId const trip{flight_numbers_.Find(std::string_view{flight_number})};
+            scope.AddProbes(1U);
+            if (trip == kInvalidInternId)
+            {
+                return std::nullopt;
+            }
+
+            TripState const state{
+                indexes_.template Get<FareHistoryIndex>().StateAt(trip, trip_columns_.GetState(trip), version)};
+            scope.AddRows(state.live ? 1U : 0U);
+
+            return state.live ? std::make_optional(MakeFlightData(trip, state)) : std::nullopt;
+        }
+
+        template <typename Origin>
+        std::vector<FlightData> FindFlightsByOriginCity(Origin &&origin_city, FareVersion version) const noexcept
+        {
+            static_assert(Schema::template kHas<OriginPostings>, "origin queries need OriginPostings in the schema");
 
-            std::vector<std::string> flights_by_destination{
-                helper_database_.GetValuesForKey<Filters::kDestination>(std::forward<Destination>(destination_city))};
+            OperationScope scope{stats_, StatsOperation::kFindByOriginCity};
+            std::vector<std::pair<TripId, TripState>> trips{};
 
-            std::vector<std::string> common_flights{};
+            VisitTripsAt<OriginPostings>(cities_.Find(std::string_view{origin_city}), version,
+                                         [&trips](TripId trip, const TripState &state) {
+                                             trips.emplace_back(trip, state);
+                                         });
+            std::sort(trips.begin(), trips.end(),
+                      [](auto const &lhs, auto const &rhs) { return lhs.first < rhs.first; });
 
-            auto it{std::set_intersection(flights_by_origin.begin(), flights_by_origin.end(),
-                                          flights_by_destination.begin(), flights_by_destination.end(),
-                                          std::back_inserter(common_flights))};
+            std::vector<FlightData> flight_data{};
+            flight_data.reserve(trips.size());
+            for (auto const &trip : trips)
+            {
+                flight_data.emplace_back(MakeFlightData(trip.first, trip.second));
+            }
+            scope.AddProbes(2U);
+            scope.AddRows(flight_data.size());
 
-            std::uint32_t min_fare{UINT_MAX};
+            return flight_data;
+        }
+
+        template <typename Origin, typename Destination>
+        std::uint32_t FindMinFareBetweenCities(Origin &&origin_city, Destination &&destination_city,
+                                               FareVersion version) const noexcept
+        {
+            static_assert(Schema::template kHas<RouteFares>, "route queries need RouteFares in the schema");
+
+            OperationScope scope{stats_, StatsOperation::kMinFareBetweenCities};
+            auto const cheapest{FindCheapestAt<RouteFares>(
+                MakeRouteKey(cities_.Find(std::string_view{origin_city}), cities_.Find(std::string_view{destination_city})),
+                version)};
+            scope.AddProbes(3U);
+            scope.AddRows(cheapest ? 1U : 0U);
+
+            return cheapest ? cheapest->second.fare : UINT_MAX;
+        }
+
+        template <typename Origin, typename Destination>
+        std::optional<FlightData> FindCheapestFlightBetweenCities(Origin &&origin_city, Destination &&destination_city,
+                                                                  FareVersion version) const noexcept
+        {
+            static_assert(Schema::template kHas<RouteFares>, "route queries need RouteFares in the schema");
+
+            OperationScope scope{stats_, StatsOperation::kMinFareBetweenCities};
+            auto const cheapest{FindCheapestAt<RouteFares>(
+                MakeRouteKey(cities_.Find(std::string_view{origin_city}), cities_.Find(std::string_view{destination_city})),
+                version)};
+            scope.AddProbes(3U);
+            scope.AddRows(cheapest ? 1U : 0U);
+
+            return cheapest ? std::make_optional(MakeFlightData(cheapest->first, cheapest->second)) : std::nullopt;
+        }
+
+        template <typename Operator>
+        std::uint32_t FindMaxFareByOperator(Operator &&flight_operator, FareVersion version) const noexcept
+        {
+            static_assert(Schema::template kHas<OperatorFares>, "FindMaxFareByOperator needs OperatorFares in the schema");
+
+            OperationScope scope{stats_, StatsOperation::kMaxFareByOperator};
+            std::optional<std::uint32_t> max_fare{};
 
-            std::for_each(common_flights.begin(), common_flights.end(),
-                          [this, &min_fare](const auto &flight_number) {
-                              if (IsTripInDatabase(flight_number))
-                              {
-                                  min_fare = std::min(min_fare, flight_database_.at(flight_number).GetAirFare());
-                              }
-                          });
+            VisitTripsAt<OperatorFares>(operators_.Find(std::string_view{flight_operator}), version,
+                                        [&max_fare](TripId, const TripState &state) {
+                                            max_fare = std::max(max_fare.value_or(0U), state.fare);
+                                        });
+            scope.AddProbes(2U);
+            scope.AddRows(max_fare ? 1U : 0U);
 
-            return min_fare;
+            return max_fare.value_or(0U);
         }
 
-        bool IsTripInDatabase(const std::string &flightNumber) const noexcept;
-        bool RemoveTrip(const std::string &flightNumber) noexcept;
-        bool UpdateFareByTrip(const std::string &flightNumber, std::uint32_t fare) noexcept;
-        void DisplayAllTrips() const noexcept;
+        /**
+         * Applies adjust, a whole percentage, a FarePercentage or any fare -> fare
+         * callable, to every trip of the operator in one pass over a gathered
+         * fare block, then brings the fare indexes and aggregates up to date for
+         * the changed trips. Returns the number of trips whose fare changed.
+         */
+        template <typename Operator, typename Adjustment>
+        std::size_t UpdateFaresByOperator(Operator &&flight_operator, Adjustment &&adjust) noexcept
+        {
+            static_assert(Schema::template kHas<OperatorPostings>,
+                          "UpdateFaresByOperator needs OperatorPostings in the schema");
+
+            OperationScope scope{stats_, StatsOperation::kUpdateFaresByOperator};
+            scope.AddProbes(1U);
+
+            InternId const operator_id{operators_.Find(std::string_view{flight_operator})};
+            if (operator_id == kInvalidInternId)
+            {
+                return 0U;
+            }
+
+            auto const &postings{indexes_.template Get<OperatorPostings>()};
+            auto const &operator_trips{postings.EqualRange(operator_id)};
+            scope.AddProbes(1U);
+
+            std::vector<TripId> trips{};
+            trips.reserve(operator_trips.size());
+            std::copy_if(operator_trips.cbegin(), operator_trips.cend(), std::back_inserter(trips),
+                         [this, &postings, operator_id](TripId trip) {
+                             return postings.IsCurrent(trip_columns_, operator_id, trip);
+                         });
+
+            std::vector<std::uint32_t> fares(trips.size());
+            std::transform(trips.cbegin(), trips.cend(), fares.begin(),
+                           [this](TripId trip) { return trip_columns_.GetAirFare(trip); });
+
+            std::vector<std::uint32_t> adjusted_fares(trips.size());
+            if constexpr (std::is_integral_v<std::decay_t<Adjustment>>)
+            {
+                AdjustFares(fares.data(), adjusted_fares.data(), fares.size(),
+                            FarePercentage{static_cast<std::int32_t>(adjust)});
+            }
+            else
+            {
+                AdjustFares(fares.data(), adjusted_fares.data(), fares.size(), std::forward<Adjustment>(adjust));
+            }
+
+            std::size_t updated{0U};
+
+            for (std::size_t index = 0U; index < trips.size(); ++index)
+            {
+                if (adjusted_fares[index] != fares[index])
+                {
+                    ChangeFare(trips[index], adjusted_fares[index]);
+                    ++updated;
+                }
+            }
+            scope.AddRows(updated);
+
+            return updated;
+        }
+
+        std::size_t UpdateFaresByOperators(const std::vector<std::pair<std::string, FarePercentage>> &adjustments) noexcept;
+
+        /**
+         * Answers every query of batch, in the order the queries were added,
+         * with what the single calls would return. Queries are resolved to
+         * index keys, deduplicated and sorted, so each distinct key is looked
+         * up once and in key order, split over pool's workers. A query whose
+         * index the schema leaves out gets the not-found answer.
+         */
+        std::vector<std::uint32_t> ExecuteBatch(const QueryBatch &batch) const noexcept;
+        std::vector<std::uint32_t> ExecuteBatch(const QueryBatch &batch, WorkStealingThreadPool &pool) const noexcept;
+
+        std::size_t BulkLoad(const std::vector<TripRecordView> &records) noexcept;
+
+        bool IsTripInDatabase(std::string_view flight_number) const noexcept;
+        bool RemoveTrip(std::string_view flight_number) noexcept;
+        bool UpdateFareByTrip(std::string_view flight_number, std::uint32_t fare) noexcept;
+        void DisplayAllTrips(TripOrder order = TripOrder::kRowOrder) const noexcept;
         std::uint32_t FindAverageCostOfAllTrips() const noexcept;
-        std::optional<FlightData> FindFlightsByNumber(const std::string &flight_number) const noexcept;
+        std::uint64_t GetTotalFare() const noexcept;
+        std::size_t GetTripCount() const noexcept;
+        std::optional<FlightData> FindFlightsByNumber(std::string_view flight_number) const noexcept;
+        std::optional<TripView> ViewFlightByNumber(std::string_view flight_number) const noexcept;
+        bool CheckAggregateConsistency() const noexcept;
+        bool ApplyMutation(const TripMutation &mutation) noexcept;
+        IndexStatistics GetIndexStatistics() const noexcept;
+
+        /**
+         * Latency, probe and row counts per public operation and the bytes
+         * held by storage and indexes. Only the index entries are filled in
+         * unless built with FLIGHT_MANAGEMENT_ENABLE_STATS.
+         */
+        DatabaseStats GetStats() const noexcept;
+
+        /**
+         * The fare history's current version, oldest retained version and
+         * retention window in versions. Without FareHistoryIndex in the
+         * schema there is no history: versions read 0 and nothing is kept.
+         */
+        FareVersion GetFareVersion() const noexcept;
+        FareVersion GetOldestFareVersion() const noexcept;
+        void SetFareHistoryRetention(FareVersion versions) noexcept;
+
+        /**
+         * Drops fare history older than the retention window now rather
+         * than when the log next doubles. Returns the bytes released.
+         */
+        std::size_t CollectFareHistory() noexcept;
+
+        /**
+         * Publishes every later trip add, removal and fare change to stream,
+         * which must outlive the database or be replaced with nullptr first.
+         * Copies of the database are not attached.
+         */
+        void SetMutationStream(MutationStream *stream) noexcept;
+        std::pmr::memory_resource *GetMemoryResource() const noexcept;
+        std::size_t CompactIndexes() noexcept;
+        bool SaveSnapshot(const std::string &path) const noexcept;
+        static std::unique_ptr<MappedFlightTripDatabase> OpenSnapshot(const std::string &path) noexcept;
 
     private:
-        FlightDatabase flight_database_{};
-        HelperFlightDatabase helper_database_{};
+        template <typename Database>
+        friend class BasicTripView;
+
+        template <typename Database, typename Index>
+        friend class BasicTripRange;
+
+        friend class CompressedFlightTripDatabase;
+
+        explicit BasicFlightTripDatabase(std::shared_ptr<std::pmr::memory_resource> arena) noexcept;
+
+        bool InsertTrip(std::string_view flight_number, std::string_view origin_city,
+                        std::string_view destination_city, std::string_view flight_operator,
+                        std::uint32_t fare) noexcept;
+        TripId FindLiveTrip(std::string_view flight_number) const noexcept;
+        std::optional<FareEntry> FindCheapestTrip(std::string_view origin_city,
+                                                  std::string_view destination_city) const noexcept;
+        void ChangeFare(TripId trip, std::uint32_t fare) noexcept;
+
+        /**
+         * Up to count flights of key in Index, in fare order, with fares in
+         * [min_fare, max_fare].
+         */
+        template <typename Index>
+        std::vector<FlightData> CollectByFare(InternId key, std::uint32_t min_fare, std::uint32_t max_fare,
+                                              std::size_t count) const noexcept
+        {
+            OperationScope scope{stats_, StatsOperation::kFindByFare};
+            std::vector<FlightData> flight_data{};
+
+            scope.AddProbes(1U);
+            if (key == kInvalidInternId || count == 0U)
+            {
+                return flight_data;
+            }
+
+            // A fare range is unbounded, so only a top-k request knows its output size up front.
+            if (count != SIZE_MAX)
+            {
+                flight_data.reserve(std::min(count, aggregates_.GetTripCount()));
+            }
+
+            indexes_.template Get<Index>().VisitFareRange(key, min_fare, max_fare,
+                                                          [this, &flight_data, count](const FareEntry &entry) {
+                                                              flight_data.emplace_back(MakeFlightData(entry.second));
+                                                              return flight_data.size() < count;
+                                                          });
+            scope.AddProbes(1U);
+            scope.AddRows(flight_data.size());
+
+            return flight_data;
+        }
+
+        /**
+         * Visits (trip, state) for every trip that was live under key in
+         * Index at version: the trips under the key now, and those removed
+         * since, which no index holds any more.
+         */
+        template <typename Index, typename Visit>
+        void VisitTripsAt(typename Index::KeyOf::Type key, FareVersion version, Visit &&visit) const noexcept
+        {
+            static_assert(Schema::template kHas<FareHistoryIndex>, "versioned reads need FareHistoryIndex in the schema");
+
+            auto const &history{indexes_.template Get<FareHistoryIndex>()};
+            auto const &index{indexes_.template Get<Index>()};
+
+            auto visit_at = [this, &history, &visit, key, version](TripId trip) {
+                TripState const state{history.StateAt(trip, trip_columns_.GetState(trip), version)};
+                if (state.live && Index::KeyOf::Of(state) == key)
+                {
+                    visit(trip, state);
+                }
+            };
+
+            if constexpr (Index::kKind == IndexKind::kFareOrdered)
+            {
+                index.VisitFareRange(key, 0U, UINT32_MAX, [&visit_at](const FareEntry &entry) {
+                    visit_at(entry.second);
+                    return true;
+                });
+            }
+            else
+            {
+                for (TripId trip : index.EqualRange(key))
+                {
+                    if (index.IsCurrent(trip_columns_, key, trip))
+                    {
+                        visit_at(trip);
+                    }
+                }
+            }
+
+            // A displaced trip still under key now was visited above.
+            history.ForEachDisplaced([this, &visit_at, key](TripId trip) {
+                if (!trip_columns_.IsLive(trip) || Index::KeyOf::Of(trip_columns_, trip) != key)
+                {
+                    visit_at(trip);
+                }
+            });
+        }
+
+        /**
+         * The cheapest trip under key in Index at version, ties going to the
+         * lower trip id as in the fare index.
+         */
+        template <typename Index>
+        std::optional<std::pair<TripId, TripState>> FindCheapestAt(typename Index::KeyOf::Type key,
+                                                                   FareVersion version) const noexcept
+        {
+            std::optional<std::pair<TripId, TripState>> cheapest{};
+
+            VisitTripsAt<Index>(key, version, [&cheapest](TripId trip, const TripState &state) {
+                if (!cheapest ||
+                    std::make_pair(state.fare, trip) < std::make_pair(cheapest->second.fare, cheapest->first))
+                {
+                    cheapest = std::make_pair(trip, state);
+                }
+            });
+
+            return cheapest;
+        }
+
+        FlightData MakeFlightData(TripId trip) const noexcept;
+        FlightData MakeFlightData(TripId trip, const TripState &state) const noexcept;
+        Itinerary MakeItinerary(const RoutePath &path) const noexcept;
+
+        // max_stops stops take one more leg; SIZE_MAX, no limit, stays SIZE_MAX.
+        static constexpr std::size_t LegsFor(std::size_t max_stops) noexcept
+        {
+            return (max_stops != SIZE_MAX) ? max_stops + 1U : SIZE_MAX;
+        }
+
+        void RefreshRouteGraph() noexcept;
+        std::vector<std::uint32_t> RunBatch(const QueryBatch &batch, WorkStealingThreadPool *pool) const noexcept;
+        std::uint32_t AnswerFareQuery(QueryKind kind, std::uint64_t key) const noexcept;
+
+        std::shared_ptr<std::pmr::memory_resource> arena_;
+        StatsHandle stats_;
+        StringInterner flight_numbers_;
+        StringInterner cities_;
+        StringInterner operators_;
+        TripColumns trip_columns_;
+        IndexSet indexes_;
+        TripAggregates aggregates_;
+        std::size_t compactions_{0U};
+        MutationStream *mutation_stream_{nullptr};
     };
 
+    using FlightTripDatabase = BasicFlightTripDatabase<FullTripSchema>;
+    using MinimalFlightTripDatabase = BasicFlightTripDatabase<MinimalTripSchema>;
+    using TripView = FlightTripDatabase::TripView;
+
+    extern template class BasicFlightTripDatabase<FullTripSchema>;
+    extern template class BasicFlightTripDatabase<MinimalTripSchema>;
+
 } // namespace flight_management
 
 #endif //FLIGHT_MANAGEMENT_INCLUDE_FLIGHT_TRIP_DATABASE_H
@@ -2,6 +2,7 @@
 #define FLIGHT_MANAGEMENT_INCLUDE_HELPER_DATABASE_H
 
 #include <map>
+#include <memory_resource>
 
 #include "base_dataset.h"
 #include "common_data.h"
@@ -13,6 +14,35 @@ template <typename... Args>
 class HelperDatabase : public Args...
 {
 public:
+    explicit HelperDatabase(std::pmr::memory_resource *resource = std::pmr::get_default_resource()) noexcept
+        : Args{resource}...
+    {
+    }
+
+    template <typename Index>
+    Index &Get() noexcept
+    {
+        return static_cast<Index &>(*this);
+    }
+
+    template <typename Index>
+    const Index &Get() const noexcept
+    {
+        return static_cast<const Index &>(*this);
+    }
+
+    template <typename Visitor>
+    void ForEach(Visitor &&visit) noexcept
+    {
+        (visit(static_cast<Args &>(*this)), ...);
+    }
+
+    template <typename Visitor>
+    void ForEach(Visitor &&visit) const noexcept
+    {
+        (visit(static_cast<const Args &>(*this)), ...);
+    }
+
     template <Filters filter, class... Data>
     bool Add(Data &&... data) noexcept
     {
@@ -20,7 +50,43 @@ public:
     };
 
     template <Filters filter, class... Data>
-    std::vector<std::string> GetValuesForKey(Data &&... data) const noexcept
+    bool Remove(Data &&... data) noexcept
+    {
+        return BaseDataset<filter>::Remove(std::forward<Data>(data)...);
+    };
+
+    template <Filters filter, class... Data>
+    void BulkAdd(Data &&... data) noexcept
+    {
+        BaseDataset<filter>::BulkAdd(std::forward<Data>(data)...);
+    };
+
+    template <Filters filter, class... Data>
+    void MarkDead(Data &&... data) noexcept
+    {
+        BaseDataset<filter>::MarkDead(std::forward<Data>(data)...);
+    };
+
+    template <Filters filter, class... Data>
+    std::size_t Compact(Data &&... data) noexcept
+    {
+        return BaseDataset<filter>::Compact(std::forward<Data>(data)...);
+    };
+
+    template <Filters filter>
+    std::size_t GetEntryCount() const noexcept
+    {
+        return BaseDataset<filter>::GetEntryCount();
+    }
+
+    template <Filters filter>
+    std::size_t GetDeadEntryCount() const noexcept
+    {
+        return BaseDataset<filter>::GetDeadEntryCount();
+    }
+
+    template <Filters filter, class... Data>
+    const typename BaseDataset<filter>::Postings &GetValuesForKey(Data &&... data) const noexcept
     {
         return BaseDataset<filter>::EqualRange(std::forward<Data>(data)...);
     }
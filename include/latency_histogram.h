@@ -0,0 +1,115 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_LATENCY_HISTOGRAM_H
+#define FLIGHT_MANAGEMENT_INCLUDE_LATENCY_HISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace flight_management
+{
+
+/**
+ * HDR-style log-linear histogram of nanosecond latencies. Every power of
+ * two is split into 16 linear sub-buckets, so a recorded value is known
+ * to within 1/16 of itself across the whole 64-bit range in 8 KB.
+ * Recording is a few relaxed atomic adds, safe from concurrent readers.
+ */
+class LatencyHistogram
+{
+public:
+    static constexpr unsigned kSubBucketBits{4U};
+    static constexpr std::uint64_t kSubBuckets{1U << kSubBucketBits};
+    static constexpr std::size_t kBucketCount{(64U - kSubBucketBits + 1U) * kSubBuckets};
+
+    void Record(std::uint64_t nanoseconds) noexcept
+    {
+        buckets_[BucketOf(nanoseconds)].fetch_add(1U, std::memory_order_relaxed);
+        count_.fetch_add(1U, std::memory_order_relaxed);
+        sum_.fetch_add(nanoseconds, std::memory_order_relaxed);
+
+        std::uint64_t max{max_.load(std::memory_order_relaxed)};
+        while (nanoseconds > max && !max_.compare_exchange_weak(max, nanoseconds, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    /**
+     * The highest value equivalent to the one at quantile (0 to 1): the
+     * top of its bucket, never above the largest value recorded.
+     */
+    std::uint64_t ValueAtQuantile(double quantile) const noexcept
+    {
+        std::uint64_t const count{GetCount()};
+        if (count == 0U)
+        {
+            return 0U;
+        }
+
+        auto const rank{static_cast<std::uint64_t>(quantile * static_cast<double>(count) + 0.5)};
+        std::uint64_t const target{(rank == 0U) ? 1U : (rank > count ? count : rank)};
+        std::uint64_t seen{0U};
+
+        for (std::size_t bucket = 0U; bucket < kBucketCount; ++bucket)
+        {
+            seen += buckets_[bucket].load(std::memory_order_relaxed);
+            if (seen >= target)
+            {
+                std::uint64_t const highest{HighestOf(bucket)};
+                return (highest < GetMax()) ? highest : GetMax();
+            }
+        }
+
+        return GetMax();
+    }
+
+    std::uint64_t GetCount() const noexcept
+    {
+        return count_.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t GetSum() const noexcept
+    {
+        return sum_.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t GetMax() const noexcept
+    {
+        return max_.load(std::memory_order_relaxed);
+    }
+
+    static constexpr std::size_t BucketOf(std::uint64_t value) noexcept
+    {
+        if (value < kSubBuckets)
+        {
+            return static_cast<std::size_t>(value);
+        }
+
+        unsigned const exponent{63U - static_cast<unsigned>(__builtin_clzll(value))};
+        std::uint64_t const sub_bucket{(value >> (exponent - kSubBucketBits)) & (kSubBuckets - 1U)};
+
+        return static_cast<std::size_t>((exponent - kSubBucketBits + 1U) * kSubBuckets + sub_bucket);
+    }
+
+    static constexpr std::uint64_t HighestOf(std::size_t bucket) noexcept
+    {
+        if (bucket < kSubBuckets)
+        {
+            return bucket;
+        }
+
+        unsigned const exponent{static_cast<unsigned>(bucket / kSubBuckets) + kSubBucketBits - 1U};
+        std::uint64_t const lowest{(kSubBuckets + bucket % kSubBuckets) << (exponent - kSubBucketBits)};
+
+        return lowest + ((std::uint64_t{1U} << (exponent - kSubBucketBits)) - 1U);
+    }
+
+private:
+    std::array<std::atomic<std::uint64_t>, kBucketCount> buckets_{};
+    std::atomic<std::uint64_t> count_{0U};
+    std::atomic<std::uint64_t> sum_{0U};
+    std::atomic<std::uint64_t> max_{0U};
+};
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_LATENCY_HISTOGRAM_H
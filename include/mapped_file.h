@@ -0,0 +1,52 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_MAPPED_FILE_H
+#define FLIGHT_MANAGEMENT_INCLUDE_MAPPED_FILE_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace flight_management
+{
+
+/**
+ * How a mapping will be read, passed on to the kernel as madvise advice.
+ */
+enum class AccessPattern : std::uint8_t
+{
+    kNormal = 0U,     // default read-ahead, for files scanned once and then probed
+    kSequential = 1U, // aggressive read-ahead, pages dropped once passed
+    kRandom = 2U      // no read-ahead
+};
+
+/**
+ * Read-only private mapping of a whole file, unmapped on destruction.
+ */
+class MappedFile final
+{
+public:
+    MappedFile() noexcept = default;
+    MappedFile(const std::string &path, AccessPattern access) noexcept;
+    ~MappedFile() noexcept;
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+
+    bool IsOpen() const noexcept;
+    const char *Data() const noexcept;
+    std::size_t Size() const noexcept;
+    std::string_view Contents() const noexcept;
+
+private:
+    void Unmap() noexcept;
+
+    void *data_{nullptr};
+    std::size_t size_{0U};
+    bool open_{false};
+};
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_MAPPED_FILE_H
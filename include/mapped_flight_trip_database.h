@@ -0,0 +1,108 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_MAPPED_FLIGHT_TRIP_DATABASE_H
+#define FLIGHT_MANAGEMENT_INCLUDE_MAPPED_FLIGHT_TRIP_DATABASE_H
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "flight_data.h"
+#include "flight_trip_database.h"
+#include "mapped_file.h"
+#include "snapshot_format.h"
+
+namespace flight_management
+{
+
+/**
+ * A FlightTripDatabase snapshot served straight from its file mapping.
+ *
+ * Queries read the mapped string tables, columns and sorted index arrays
+ * in place. The first mutation that changes something copies the
+ * snapshot into an owned FlightTripDatabase and releases the mapping;
+ * every later call is forwarded to that copy. Mutations that miss or
+ * change nothing are answered from the mapping.
+ */
+class MappedFlightTripDatabase final
+{
+public:
+    static std::unique_ptr<MappedFlightTripDatabase> Open(const std::string &path,
+                                                          bool verify_checksum = true) noexcept;
+
+    template <typename FlightNumber, typename Origin, typename Destination, typename Operator, typename Fare>
+    bool AddTrip(FlightNumber &&flight_number, Origin &&origin_city, Destination &&destination_city,
+                 Operator &&flight_operator, Fare &&fare) noexcept
+    {
+        if (!materialized_ && FindLiveTrip(std::string_view{flight_number}) != kInvalidInternId)
+        {
+            return false;
+        }
+
+        return Materialize().AddTrip(std::forward<FlightNumber>(flight_number), std::forward<Origin>(origin_city),
+                                     std::forward<Destination>(destination_city),
+                                     std::forward<Operator>(flight_operator), std::forward<Fare>(fare));
+    }
+
+    template <typename Origin>
+    std::vector<FlightData> FindFlightsByOriginCity(Origin &&origin_city) const noexcept
+    {
+        return FindFlightsByOrigin(std::string_view{origin_city});
+    }
+
+    template <typename Operator>
+    std::uint32_t FindMaxFareByOperator(Operator &&flight_operator) const noexcept
+    {
+        return FindMaxFare(std::string_view{flight_operator});
+    }
+
+    template <typename Origin, typename Destination>
+    std::uint32_t FindMinFareBetweenCities(Origin &&origin_city, Destination &&destination_city) const noexcept
+    {
+        return FindMinFare(std::string_view{origin_city}, std::string_view{destination_city});
+    }
+
+    bool IsTripInDatabase(std::string_view flight_number) const noexcept;
+    bool RemoveTrip(std::string_view flight_number) noexcept;
+    bool UpdateFareByTrip(std::string_view flight_number, std::uint32_t fare) noexcept;
+    std::uint32_t FindAverageCostOfAllTrips() const noexcept;
+    std::optional<FlightData> FindFlightsByNumber(std::string_view flight_number) const noexcept;
+    bool IsMaterialized() const noexcept;
+
+    /**
+     * Materializes the snapshot if needed and hands the owned database to
+     * the caller. The mapped database must not be used afterwards.
+     */
+    std::unique_ptr<FlightTripDatabase> Release() noexcept;
+
+private:
+    explicit MappedFlightTripDatabase(MappedFile &&file) noexcept;
+
+    template <typename Type>
+    const Type *Section(SnapshotSection section) const noexcept
+    {
+        return reinterpret_cast<const Type *>(file_.Data() + header_->sections[section].offset);
+    }
+
+    std::size_t SectionLength(SnapshotSection section, std::size_t element_size) const noexcept;
+    std::string_view GetString(SnapshotSection offsets, SnapshotSection blob, InternId id) const noexcept;
+    InternId FindString(SnapshotSection offsets, SnapshotSection blob, SnapshotSection order,
+                        std::string_view value) const noexcept;
+    TripId FindLiveTrip(std::string_view flight_number) const noexcept;
+    FlightData MakeFlightData(TripId trip) const noexcept;
+
+    std::vector<FlightData> FindFlightsByOrigin(std::string_view origin_city) const noexcept;
+    std::uint32_t FindMaxFare(std::string_view flight_operator) const noexcept;
+    std::uint32_t FindMinFare(std::string_view origin_city, std::string_view destination_city) const noexcept;
+
+    FlightTripDatabase &Materialize() noexcept;
+
+    MappedFile file_;
+    const SnapshotHeader *header_{nullptr};
+    std::unique_ptr<FlightTripDatabase> materialized_{};
+};
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_MAPPED_FLIGHT_TRIP_DATABASE_H
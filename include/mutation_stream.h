@@ -0,0 +1,189 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_MUTATION_STREAM_H
+#define FLIGHT_MANAGEMENT_INCLUDE_MUTATION_STREAM_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "trip_mutation.h"
+
+namespace flight_management
+{
+
+/**
+ * What the producer does when a consumer is a whole ring behind.
+ */
+enum class OverflowPolicy : std::uint8_t
+{
+    kBlock = 0U, // backpressure: the producer waits for the consumer to catch up
+    kDetach = 1U // the consumer is cut off and must Resync, the producer never waits for it
+};
+
+class MutationStream;
+
+/**
+ * One consumer's cursor into a MutationStream. Move-only; releases its
+ * consumer slot when destroyed. Each subscription is read by one thread
+ * at a time, but different subscriptions may be read concurrently.
+ */
+class MutationSubscription final
+{
+public:
+    MutationSubscription(MutationSubscription &&other) noexcept;
+    MutationSubscription &operator=(MutationSubscription &&other) noexcept;
+    ~MutationSubscription() noexcept;
+
+    MutationSubscription(const MutationSubscription &) = delete;
+    MutationSubscription &operator=(const MutationSubscription &) = delete;
+
+    /**
+     * Calls visit(const TripMutation &) on up to max_count published
+     * mutations, oldest first, straight from the ring, and returns how
+     * many were visited. visit must not keep references to the mutation.
+     * Returns 0 once the subscription is overrun.
+     */
+    template <typename Visit>
+    std::size_t Consume(std::size_t max_count, Visit &&visit) noexcept;
+
+    /**
+     * Appends up to max_count published mutations to batch.
+     */
+    std::size_t Poll(std::vector<TripMutation> &batch, std::size_t max_count) noexcept;
+
+    /**
+     * Whether a kDetach subscription fell a whole ring behind and was cut
+     * off. Mutations since are lost; whatever it mirrors must be rebuilt.
+     */
+    bool IsOverrun() const noexcept;
+
+    /**
+     * Rejoins the stream at the newest mutation after an overrun.
+     */
+    void Resync() noexcept;
+
+    /**
+     * Mutations published but not yet consumed.
+     */
+    std::size_t GetLag() const noexcept;
+
+private:
+    friend class MutationStream;
+
+    MutationSubscription(MutationStream &stream, std::size_t consumer) noexcept;
+
+    MutationStream *stream_;
+    std::size_t consumer_;
+};
+
+/**
+ * Change-data-capture feed of trip mutations: a lock-free ring buffer
+ * with one producer, the database's writer, and up to kMaxConsumers
+ * subscriptions that each read every mutation at their own pace.
+ *
+ * Slots are reused in place, so once the ring is warm publishing copies
+ * the strings into existing capacity and does not allocate. A consumer
+ * owns the slots from its cursor onwards: the producer only overwrites a
+ * slot once every attached consumer is past it, waiting for kBlock
+ * consumers and detaching lapped kDetach ones. A consumer reading a
+ * batch flags its cursor busy, so it is never detached mid-batch.
+ */
+class MutationStream final
+{
+public:
+    static constexpr std::size_t kMaxConsumers{64U};
+
+    /**
+     * capacity is rounded up to a power of two.
+     */
+    explicit MutationStream(std::size_t capacity = 1U << 12U) noexcept;
+
+    MutationStream(const MutationStream &) = delete;
+    MutationStream &operator=(const MutationStream &) = delete;
+
+    /**
+     * Producer side, from one thread at a time.
+     */
+    void Publish(MutationKind kind, std::string_view flight_number, std::string_view origin_city,
+                 std::string_view destination_city, std::string_view flight_operator, std::uint32_t fare) noexcept;
+    void Publish(const TripMutation &mutation) noexcept;
+
+    /**
+     * A subscription starting after the newest published mutation, or
+     * none when kMaxConsumers are attached already. Any thread may
+     * subscribe while the producer runs.
+     */
+    std::optional<MutationSubscription> Subscribe(OverflowPolicy policy) noexcept;
+
+    std::size_t GetCapacity() const noexcept
+    {
+        return slots_.size();
+    }
+
+    std::uint64_t GetPublishedCount() const noexcept
+    {
+        return head_.load(std::memory_order_acquire);
+    }
+
+private:
+    friend class MutationSubscription;
+
+    // A consumer's state is position << 1 | busy, or one of these.
+    static constexpr std::uint64_t kFree{~std::uint64_t{0U}};
+    static constexpr std::uint64_t kDetached{~std::uint64_t{1U}};
+    static constexpr std::uint64_t kBusy{1U};
+
+    struct alignas(64) Consumer
+    {
+        std::atomic<std::uint64_t> state{kFree};
+        std::atomic<OverflowPolicy> policy{OverflowPolicy::kBlock};
+    };
+
+    void Attach(std::size_t consumer) noexcept;
+    void Release(std::size_t consumer) noexcept;
+    void WaitForSlot(std::uint64_t position) noexcept;
+
+    std::vector<TripMutation> slots_;
+    std::uint64_t mask_;
+    std::array<Consumer, kMaxConsumers> consumers_{};
+    alignas(64) std::atomic<std::uint64_t> head_{0U};
+    std::atomic<std::uint64_t> attachments_{0U};
+
+    // Producer-only: the oldest attached position as of the last scan.
+    alignas(64) std::uint64_t oldest_{0U};
+    std::uint64_t seen_attachments_{0U};
+};
+
+template <typename Visit>
+std::size_t MutationSubscription::Consume(std::size_t max_count, Visit &&visit) noexcept
+{
+    auto &state{stream_->consumers_[consumer_].state};
+    std::uint64_t current{state.load(std::memory_order_acquire)};
+
+    // Only the producer changes an attached state, and only to kDetached.
+    if (current == MutationStream::kDetached ||
+        !state.compare_exchange_strong(current, current | MutationStream::kBusy, std::memory_order_acquire))
+    {
+        return 0U;
+    }
+
+    std::uint64_t const position{current >> 1U};
+    std::uint64_t const head{stream_->head_.load(std::memory_order_acquire)};
+    std::uint64_t const count{std::min<std::uint64_t>(head - position, max_count)};
+
+    for (std::uint64_t index = 0U; index < count; ++index)
+    {
+        visit(static_cast<const TripMutation &>(stream_->slots_[(position + index) & stream_->mask_]));
+    }
+
+    state.store((position + count) << 1U, std::memory_order_release);
+
+    return static_cast<std::size_t>(count);
+}
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_MUTATION_STREAM_H
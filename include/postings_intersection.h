@@ -0,0 +1,63 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_POSTINGS_INTERSECTION_H
+#define FLIGHT_MANAGEMENT_INCLUDE_POSTINGS_INTERSECTION_H
+
+#include <algorithm>
+#include <vector>
+
+namespace flight_management
+{
+
+/**
+ * First element in [first, last) not less than value, found by doubling
+ * the stride from first before a binary search over the last stride.
+ */
+template <typename Type>
+const Type *GallopLowerBound(const Type *first, const Type *last, const Type &value) noexcept
+{
+    std::size_t step{1U};
+    auto const size{static_cast<std::size_t>(last - first)};
+
+    while (step < size && first[step] < value)
+    {
+        step <<= 1U;
+    }
+
+    return std::lower_bound(first + (step >> 1U), first + std::min(step + 1U, size), value);
+}
+
+/**
+ * Calls visit for every value present in both sorted lists. Each value
+ * of the shorter list gallops through the longer one, so the cost is
+ * O(m log(n / m)) for lists of size m <= n.
+ */
+template <typename Postings, typename Visitor>
+void IntersectPostings(const Postings &lhs, const Postings &rhs, Visitor &&visit) noexcept
+{
+    using Type = typename Postings::value_type;
+
+    auto const &shorter{(lhs.size() <= rhs.size()) ? lhs : rhs};
+    auto const &longer{(lhs.size() <= rhs.size()) ? rhs : lhs};
+
+    const Type *cursor{longer.data()};
+    const Type *const end{longer.data() + longer.size()};
+
+    for (auto const &value : shorter)
+    {
+        cursor = GallopLowerBound(cursor, end, value);
+
+        if (cursor == end)
+        {
+            break;
+        }
+
+        if (*cursor == value)
+        {
+            visit(value);
+            ++cursor;
+        }
+    }
+}
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_POSTINGS_INTERSECTION_H
@@ -0,0 +1,109 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_QUERY_BATCH_H
+#define FLIGHT_MANAGEMENT_INCLUDE_QUERY_BATCH_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace flight_management
+{
+
+enum class QueryKind : std::uint8_t
+{
+    kMinFareBetweenCities = 0U,
+    kMaxFareByOperator = 1U
+};
+
+/**
+ * One FindMinFareBetweenCities or FindMaxFareByOperator call captured as
+ * data. Operator queries leave destination_city empty.
+ */
+struct FareQuery
+{
+    QueryKind kind{QueryKind::kMinFareBetweenCities};
+    std::string first{};
+    std::string second{};
+};
+
+/**
+ * Fare queries answered together by FlightTripDatabase::ExecuteBatch.
+ * Repeated queries share one slot, so each distinct query is resolved
+ * and looked up once per execution; a batch can be executed again as
+ * long as the queries stay the same. Each Add returns the position of
+ * the query's result.
+ */
+class QueryBatch
+{
+public:
+    std::size_t AddMinFareBetweenCities(std::string origin_city, std::string destination_city) noexcept
+    {
+        return Add(FareQuery{QueryKind::kMinFareBetweenCities, std::move(origin_city), std::move(destination_city)});
+    }
+
+    std::size_t AddMaxFareByOperator(std::string flight_operator) noexcept
+    {
+        return Add(FareQuery{QueryKind::kMaxFareByOperator, std::move(flight_operator), {}});
+    }
+
+    /**
+     * The distinct queries, in order of first appearance.
+     */
+    const std::vector<FareQuery> &GetDistinctQueries() const noexcept
+    {
+        return distinct_;
+    }
+
+    /**
+     * For every added query, the index of its distinct query.
+     */
+    const std::vector<std::size_t> &GetSlots() const noexcept
+    {
+        return slots_;
+    }
+
+    const FareQuery &operator[](std::size_t position) const noexcept
+    {
+        return distinct_[slots_[position]];
+    }
+
+    std::size_t Size() const noexcept
+    {
+        return slots_.size();
+    }
+
+    void Clear() noexcept
+    {
+        distinct_.clear();
+        slots_.clear();
+        slot_by_query_.clear();
+    }
+
+private:
+    std::size_t Add(FareQuery query) noexcept
+    {
+        std::string identity{};
+        identity.reserve(query.first.size() + query.second.size() + 2U);
+        identity.push_back(static_cast<char>(query.kind));
+        identity.append(query.first).push_back('\0');
+        identity.append(query.second);
+
+        auto const slot{slot_by_query_.emplace(std::move(identity), distinct_.size())};
+        if (slot.second)
+        {
+            distinct_.push_back(std::move(query));
+        }
+
+        slots_.push_back(slot.first->second);
+
+        return slots_.size() - 1U;
+    }
+
+    std::vector<FareQuery> distinct_{};
+    std::vector<std::size_t> slots_{};
+    std::unordered_map<std::string, std::size_t> slot_by_query_{};
+};
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_QUERY_BATCH_H
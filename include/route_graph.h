@@ -0,0 +1,131 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_ROUTE_GRAPH_H
+#define FLIGHT_MANAGEMENT_INCLUDE_ROUTE_GRAPH_H
+
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common_data.h"
+#include "fare_ordered_index.h"
+#include "work_stealing_thread_pool.h"
+
+namespace flight_management
+{
+
+/**
+ * A directed route between two cities, weighted by its cheapest trip.
+ */
+struct RouteEdge
+{
+    InternId destination;
+    std::uint32_t fare;
+    TripId trip;
+};
+
+/**
+ * The trips of an itinerary in flying order and their summed fare.
+ */
+struct RoutePath
+{
+    std::uint64_t fare{0U};
+    std::vector<TripId> legs{};
+};
+
+/**
+ * City graph in compressed sparse row form: the edges leaving a city are
+ * one contiguous slice, sorted by destination, so a search walks arrays
+ * instead of chasing nodes.
+ *
+ * Edges change in place. A route that disappears is left as a dead edge
+ * and a new route goes to a per-origin overflow list; both are folded
+ * back into the arrays by Rebuild once they reach a quarter of the graph.
+ */
+class RouteGraph
+{
+public:
+    explicit RouteGraph(std::pmr::memory_resource *resource = std::pmr::get_default_resource()) noexcept
+        : offsets_{resource},
+          edges_{resource},
+          overflow_{resource}
+    {
+    }
+
+    /**
+     * Points the origin -> destination edge at cheapest, or removes the
+     * edge when the route has no trips left.
+     */
+    void SetEdge(InternId origin, InternId destination, std::optional<FareEntry> cheapest) noexcept;
+
+    void Rebuild() noexcept;
+
+    /**
+     * Cheapest itinerary of at most max_legs trips, found by Bellman-Ford
+     * cut off after max_legs rounds; each round relaxes only the cities
+     * the previous one improved.
+     */
+    std::optional<RoutePath> FindCheapestPath(InternId origin, InternId destination,
+                                              std::size_t max_legs) const noexcept;
+
+    /**
+     * FindCheapestPath for many pairs. Pairs sharing an origin share one
+     * search, and the origins are spread over pool, the calling thread
+     * taking part. Results are in the order of queries.
+     */
+    std::vector<std::optional<RoutePath>> FindCheapestPaths(const std::vector<std::pair<InternId, InternId>> &queries,
+                                                            std::size_t max_legs,
+                                                            WorkStealingThreadPool &pool) const noexcept;
+
+    std::size_t GetEdgeCount() const noexcept
+    {
+        return edges_.size() - dead_edges_ + overflow_edges_;
+    }
+
+    std::size_t GetCityCount() const noexcept
+    {
+        return city_count_;
+    }
+
+private:
+    class Search;
+
+    bool SetArrayEdge(InternId origin, InternId destination, std::optional<FareEntry> cheapest) noexcept;
+    void SetOverflowEdge(InternId origin, InternId destination, std::optional<FareEntry> cheapest) noexcept;
+
+    template <typename Visit>
+    void ForEachEdge(InternId origin, Visit &&visit) const noexcept
+    {
+        if (origin + 1U < offsets_.size())
+        {
+            for (std::uint32_t edge = offsets_[origin]; edge < offsets_[origin + 1U]; ++edge)
+            {
+                if (edges_[edge].trip != kInvalidInternId)
+                {
+                    visit(edges_[edge]);
+                }
+            }
+        }
+
+        auto const overflow{overflow_.find(origin)};
+        if (overflow != overflow_.cend())
+        {
+            for (auto const &edge : overflow->second)
+            {
+                visit(edge);
+            }
+        }
+    }
+
+    std::pmr::vector<std::uint32_t> offsets_;
+    std::pmr::vector<RouteEdge> edges_;
+    std::pmr::unordered_map<InternId, std::pmr::vector<RouteEdge>> overflow_;
+    std::size_t dead_edges_{0U};
+    std::size_t overflow_edges_{0U};
+    std::size_t city_count_{0U};
+};
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_ROUTE_GRAPH_H
@@ -0,0 +1,60 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_SCHEDULE_LOADER_H
+#define FLIGHT_MANAGEMENT_INCLUDE_SCHEDULE_LOADER_H
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "flight_trip_database.h"
+#include "trip_record.h"
+#include "work_stealing_thread_pool.h"
+
+namespace flight_management
+{
+
+struct LoadStatistics
+{
+    double RowsPerSecond() const noexcept
+    {
+        return (seconds > 0.0) ? static_cast<double>(rows_loaded) / seconds : 0.0;
+    }
+
+    std::size_t rows_loaded{0U};
+    std::size_t rows_rejected{0U};
+    double seconds{0.0};
+};
+
+/**
+ * Bulk ingestion of schedule files with one trip per line:
+ *
+ *     flight_number,origin_city,destination_city,operator,fare
+ *
+ * An optional header line starting with "flight_number" is skipped. Rows
+ * are parsed into views over the mapped file in line-aligned chunks, one
+ * per parser thread, and handed to FlightTripDatabase::BulkLoad in file
+ * order. The calling thread parses alongside a pool of parser_threads - 1
+ * workers started with the loader; with one parser thread it parses
+ * alone. Malformed rows and already known flights count as rejected.
+ */
+class ScheduleLoader final
+{
+public:
+    explicit ScheduleLoader(std::size_t parser_threads = 1U) noexcept;
+
+    std::optional<LoadStatistics> LoadCsvFile(const std::string &path, FlightTripDatabase &database) const noexcept;
+    LoadStatistics LoadCsv(std::string_view contents, FlightTripDatabase &database) const noexcept;
+
+    static bool ParseCsvLine(std::string_view line, TripRecordView &record) noexcept;
+
+private:
+    static std::size_t ParseChunk(std::string_view chunk, std::vector<TripRecordView> &records) noexcept;
+
+    std::size_t parser_threads_{1U};
+    std::unique_ptr<WorkStealingThreadPool> pool_{};
+};
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_SCHEDULE_LOADER_H
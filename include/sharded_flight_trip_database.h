@@ -0,0 +1,151 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_SHARDED_FLIGHT_TRIP_DATABASE_H
+#define FLIGHT_MANAGEMENT_INCLUDE_SHARDED_FLIGHT_TRIP_DATABASE_H
+
+#include <algorithm>
+#include <climits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "flight_data.h"
+#include "flight_trip_database.h"
+#include "work_stealing_thread_pool.h"
+
+namespace flight_management
+{
+
+/**
+ * Trips hash-partitioned by flight number over independent
+ * FlightTripDatabase shards, each behind its own reader/writer lock.
+ * Single-trip operations touch only the owning shard. Queries over
+ * every shard merge per-shard partial results: index lookups that cost
+ * O(1) per shard run on the calling thread, scans fan out over a pool of
+ * shard_count - 1 workers started with the database. Flights from
+ * several shards are returned grouped by shard.
+ */
+class ShardedFlightTripDatabase final
+{
+public:
+    explicit ShardedFlightTripDatabase(std::size_t shard_count) noexcept;
+
+    template <typename FlightNumber, typename Origin, typename Destination, typename Operator, typename Fare>
+    bool AddTrip(FlightNumber &&flight_number, Origin &&origin_city, Destination &&destination_city,
+                 Operator &&flight_operator, Fare &&fare) noexcept
+    {
+        Shard &shard{ShardOf(std::string_view{flight_number})};
+        std::unique_lock<std::shared_mutex> lock{shard.mutex};
+
+        return shard.database.AddTrip(std::forward<FlightNumber>(flight_number), std::forward<Origin>(origin_city),
+                                      std::forward<Destination>(destination_city),
+                                      std::forward<Operator>(flight_operator), std::forward<Fare>(fare));
+    }
+
+    template <typename Origin>
+    std::vector<FlightData> FindFlightsByOriginCity(Origin &&origin_city) const noexcept
+    {
+        auto partials{FanOut([&origin_city](const FlightTripDatabase &database) {
+            return database.FindFlightsByOriginCity(origin_city);
+        })};
+
+        std::vector<FlightData> flight_data{};
+
+        for (auto &partial : partials)
+        {
+            std::move(partial.begin(), partial.end(), std::back_inserter(flight_data));
+        }
+
+        return flight_data;
+    }
+
+    template <typename Operator>
+    std::uint32_t FindMaxFareByOperator(Operator &&flight_operator) const noexcept
+    {
+        auto const partials{Gather([&flight_operator](const FlightTripDatabase &database) {
+            return database.FindMaxFareByOperator(flight_operator);
+        })};
+
+        return *std::max_element(partials.cbegin(), partials.cend());
+    }
+
+    template <typename Origin, typename Destination>
+    std::uint32_t FindMinFareBetweenCities(Origin &&origin_city, Destination &&destination_city) const noexcept
+    {
+        auto const partials{Gather([&origin_city, &destination_city](const FlightTripDatabase &database) {
+            return database.FindMinFareBetweenCities(origin_city, destination_city);
+        })};
+
+        return *std::min_element(partials.cbegin(), partials.cend());
+    }
+
+    bool IsTripInDatabase(std::string_view flight_number) const noexcept;
+    bool RemoveTrip(std::string_view flight_number) noexcept;
+    bool UpdateFareByTrip(std::string_view flight_number, std::uint32_t fare) noexcept;
+    std::uint32_t FindAverageCostOfAllTrips() const noexcept;
+    std::optional<FlightData> FindFlightsByNumber(std::string_view flight_number) const noexcept;
+    std::size_t GetShardCount() const noexcept;
+
+private:
+    struct Shard
+    {
+        mutable std::shared_mutex mutex{};
+        FlightTripDatabase database{};
+    };
+
+    Shard &ShardOf(std::string_view flight_number) noexcept;
+    const Shard &ShardOf(std::string_view flight_number) const noexcept;
+
+    template <typename Query>
+    auto RunOnShard(std::size_t index, Query &query) const noexcept
+    {
+        std::shared_lock<std::shared_mutex> lock{shards_[index]->mutex};
+        return query(shards_[index]->database);
+    }
+
+    /**
+     * Runs query on every shard under its read lock, one after another on
+     * the calling thread, and returns the results by shard.
+     */
+    template <typename Query>
+    auto Gather(Query query) const noexcept
+    {
+        std::vector<decltype(query(std::declval<const FlightTripDatabase &>()))> partials{};
+        partials.reserve(shards_.size());
+
+        for (std::size_t index = 0U; index < shards_.size(); ++index)
+        {
+            partials.push_back(RunOnShard(index, query));
+        }
+
+        return partials;
+    }
+
+    /**
+     * Gather with the shards spread over the pool, the calling thread
+     * taking part.
+     */
+    template <typename Query>
+    auto FanOut(Query query) const noexcept
+    {
+        std::vector<decltype(query(std::declval<const FlightTripDatabase &>()))> partials(shards_.size());
+
+        pool_->ParallelFor(shards_.size(), 1U, [this, &query, &partials](std::size_t begin, std::size_t end) {
+            for (std::size_t index = begin; index < end; ++index)
+            {
+                partials[index] = RunOnShard(index, query);
+            }
+        });
+
+        return partials;
+    }
+
+    std::vector<std::unique_ptr<Shard>> shards_{};
+    std::unique_ptr<WorkStealingThreadPool> pool_{};
+};
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_SHARDED_FLIGHT_TRIP_DATABASE_H
@@ -0,0 +1,103 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_SNAPSHOT_FORMAT_H
+#define FLIGHT_MANAGEMENT_INCLUDE_SNAPSHOT_FORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace flight_management
+{
+
+/**
+ * On-disk layout of a FlightTripDatabase snapshot, version 2.
+ *
+ * A fixed header is followed by 8-byte aligned sections addressed by byte
+ * offsets from the start of the file, so a mapping can be read in place
+ * at any address. Integers are stored in host byte order; byte_order
+ * rejects files written on a host of the other endianness.
+ *
+ * String tables are an offsets array (count + 1 entries) into a blob plus
+ * the ids ordered by string for binary search. Trip columns are indexed
+ * by trip id. Postings are CSR: per-key offsets (key count + 1) into one
+ * array of trip ids. Route and operator trips are ordered by fare.
+ */
+enum SnapshotSection : std::uint32_t
+{
+    kFlightNumberOffsets = 0U,
+    kFlightNumberBlob,
+    kFlightNumberOrder,
+    kCityOffsets,
+    kCityBlob,
+    kCityOrder,
+    kOperatorOffsets,
+    kOperatorBlob,
+    kOperatorOrder,
+    kOriginColumn,
+    kDestinationColumn,
+    kOperatorColumn,
+    kFareColumn,
+    kLiveColumn,
+    kOriginPostingOffsets,
+    kOriginPostings,
+    kRouteKeys,
+    kRouteOffsets,
+    kRouteTrips,
+    kOperatorFareOffsets,
+    kOperatorFareTrips,
+    kSnapshotSectionCount
+};
+
+struct SnapshotSectionEntry
+{
+    std::uint64_t offset;
+    std::uint64_t size;
+};
+
+struct SnapshotHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::uint64_t checksum;
+    std::uint64_t file_size;
+    std::uint64_t trip_count;
+    std::uint64_t fare_sum;
+    SnapshotSectionEntry sections[kSnapshotSectionCount];
+};
+
+constexpr char kSnapshotMagic[8]{'F', 'L', 'T', 'S', 'N', 'A', 'P', '\0'};
+constexpr std::uint32_t kSnapshotVersion{2U};
+constexpr std::uint32_t kSnapshotByteOrder{0x01020304U};
+constexpr std::size_t kSnapshotAlignment{8U};
+
+static_assert(sizeof(SnapshotHeader) % sizeof(std::uint64_t) == 0U, "the header is checksummed as whole words");
+
+/**
+ * FNV-1a folded over 64-bit words of the header, its checksum field taken
+ * as 0, and then of the count payload words after it; the section padding
+ * keeps that payload a whole number of words.
+ */
+inline std::uint64_t SnapshotChecksum(SnapshotHeader header, const std::uint64_t *words, std::size_t count) noexcept
+{
+    std::uint64_t header_words[sizeof(SnapshotHeader) / sizeof(std::uint64_t)];
+    header.checksum = 0U;
+    std::memcpy(header_words, &header, sizeof(SnapshotHeader));
+
+    std::uint64_t hash{14695981039346656037ULL};
+
+    for (std::uint64_t const word : header_words)
+    {
+        hash = (hash ^ word) * 1099511628211ULL;
+    }
+
+    for (std::size_t index = 0U; index < count; ++index)
+    {
+        hash = (hash ^ words[index]) * 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_SNAPSHOT_FORMAT_H
@@ -0,0 +1,120 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_STRING_INTERNER_H
+#define FLIGHT_MANAGEMENT_INCLUDE_STRING_INTERNER_H
+
+#include <deque>
+#include <functional>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+
+#include "common_data.h"
+#include "flat_id_table.h"
+
+namespace flight_management
+{
+
+/**
+ * Maps every distinct string to a dense id, starting at zero.
+ * Strings live in a deque and the index is a FlatIdTable of their ids,
+ * so a lookup is one hash, one group probe and, almost always, one
+ * string comparison. Both draw from the given memory resource.
+ */
+class StringInterner
+{
+public:
+    explicit StringInterner(std::pmr::memory_resource *resource = std::pmr::get_default_resource()) noexcept
+        : strings_{resource},
+          ids_{resource}
+    {
+    }
+
+    ~StringInterner() noexcept = default;
+
+    StringInterner(const StringInterner &other) noexcept
+        : strings_{other.strings_}
+    {
+        Reindex();
+    }
+
+    StringInterner &operator=(const StringInterner &other) noexcept
+    {
+        if (this != &other)
+        {
+            strings_ = other.strings_;
+            Reindex();
+        }
+
+        return *this;
+    }
+
+    StringInterner(StringInterner &&) noexcept = default;
+    StringInterner &operator=(StringInterner &&) noexcept = default;
+
+    InternId Intern(std::string_view value) noexcept
+    {
+        std::size_t const hash{Hash(value)};
+        InternId const found{Find(value, hash)};
+
+        if (found != kInvalidInternId)
+        {
+            return found;
+        }
+
+        auto const id{static_cast<InternId>(strings_.size())};
+        strings_.emplace_back(value);
+        ids_.Insert(hash, id, [this](InternId other) { return Hash(strings_[other]); });
+
+        return id;
+    }
+
+    InternId Find(std::string_view value) const noexcept
+    {
+        return Find(value, Hash(value));
+    }
+
+    std::string_view Get(InternId id) const noexcept
+    {
+        return strings_[id];
+    }
+
+    std::size_t Size() const noexcept
+    {
+        return strings_.size();
+    }
+
+    std::pmr::memory_resource *GetMemoryResource() const noexcept
+    {
+        return strings_.get_allocator().resource();
+    }
+
+private:
+    static std::size_t Hash(std::string_view value) noexcept
+    {
+        return std::hash<std::string_view>{}(value);
+    }
+
+    InternId Find(std::string_view value, std::size_t hash) const noexcept
+    {
+        return ids_.Find(hash, [this, value](InternId id) { return std::string_view{strings_[id]} == value; });
+    }
+
+    void Reindex() noexcept
+    {
+        auto const hash_of = [this](InternId id) { return Hash(strings_[id]); };
+
+        ids_.Clear();
+        ids_.Reserve(strings_.size(), hash_of);
+
+        for (std::size_t id = 0U; id < strings_.size(); ++id)
+        {
+            ids_.Insert(Hash(strings_[id]), static_cast<InternId>(id), hash_of);
+        }
+    }
+
+    std::pmr::deque<std::pmr::string> strings_;
+    FlatIdTable ids_;
+};
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_STRING_INTERNER_H
@@ -0,0 +1,64 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_TRIP_AGGREGATES_H
+#define FLIGHT_MANAGEMENT_INCLUDE_TRIP_AGGREGATES_H
+
+#include <cstdint>
+
+#include "common_data.h"
+
+namespace flight_management
+{
+
+/**
+ * Running totals kept in step with every trip mutation: the 64-bit fare
+ * sum and trip count behind the average. Per-operator fare order is the
+ * OperatorFares index of the schema.
+ */
+class TripAggregates
+{
+public:
+    void OnAdd(std::uint32_t fare) noexcept
+    {
+        fare_sum_ += fare;
+        ++trip_count_;
+    }
+
+    void OnBulkAdd(std::size_t trip_count, std::uint64_t fare_sum) noexcept
+    {
+        fare_sum_ += fare_sum;
+        trip_count_ += trip_count;
+    }
+
+    void OnRemove(std::uint32_t fare) noexcept
+    {
+        fare_sum_ -= fare;
+        --trip_count_;
+    }
+
+    void OnFareUpdate(std::uint32_t old_fare, std::uint32_t new_fare) noexcept
+    {
+        fare_sum_ = fare_sum_ - old_fare + new_fare;
+    }
+
+    std::uint64_t GetFareSum() const noexcept
+    {
+        return fare_sum_;
+    }
+
+    std::size_t GetTripCount() const noexcept
+    {
+        return trip_count_;
+    }
+
+    std::uint32_t GetAverageFare() const noexcept
+    {
+        return (trip_count_ != 0U) ? static_cast<std::uint32_t>(fare_sum_ / trip_count_) : 0U;
+    }
+
+private:
+    std::uint64_t fare_sum_{0U};
+    std::size_t trip_count_{0U};
+};
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_TRIP_AGGREGATES_H
@@ -0,0 +1,156 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_TRIP_COLUMNS_H
+#define FLIGHT_MANAGEMENT_INCLUDE_TRIP_COLUMNS_H
+
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include "common_data.h"
+
+namespace flight_management
+{
+
+/**
+ * One row of TripColumns gathered by value, e.g. as it stood at an
+ * earlier version.
+ */
+struct TripState
+{
+    InternId origin{kInvalidInternId};
+    InternId destination{kInvalidInternId};
+    InternId flight_operator{kInvalidInternId};
+    std::uint32_t fare{0U};
+    bool live{false};
+};
+
+/**
+ * Struct-of-arrays trip storage, one row per interned flight number.
+ * A removed trip keeps its row so that re-adding the flight reuses it.
+ */
+class TripColumns
+{
+public:
+    explicit TripColumns(std::pmr::memory_resource *resource = std::pmr::get_default_resource()) noexcept
+        : origin_ids_{resource},
+          destination_ids_{resource},
+          operator_ids_{resource},
+          fares_{resource},
+          live_{resource}
+    {
+    }
+
+    void Assign(TripId trip, InternId origin, InternId destination, InternId flight_operator,
+                std::uint32_t fare) noexcept
+    {
+        if (trip >= live_.size())
+        {
+            Resize(trip + 1U);
+        }
+
+        origin_ids_[trip] = origin;
+        destination_ids_[trip] = destination;
+        operator_ids_[trip] = flight_operator;
+        fares_[trip] = fare;
+        live_[trip] = 1U;
+    }
+
+    void Reserve(std::size_t size) noexcept
+    {
+        origin_ids_.reserve(size);
+        destination_ids_.reserve(size);
+        operator_ids_.reserve(size);
+        fares_.reserve(size);
+        live_.reserve(size);
+    }
+
+    void Erase(TripId trip) noexcept
+    {
+        live_[trip] = 0U;
+    }
+
+    bool IsLive(TripId trip) const noexcept
+    {
+        return trip < live_.size() && live_[trip] != 0U;
+    }
+
+    InternId GetOrigin(TripId trip) const noexcept
+    {
+        return origin_ids_[trip];
+    }
+
+    InternId GetDestination(TripId trip) const noexcept
+    {
+        return destination_ids_[trip];
+    }
+
+    InternId GetOperator(TripId trip) const noexcept
+    {
+        return operator_ids_[trip];
+    }
+
+    std::uint32_t GetAirFare(TripId trip) const noexcept
+    {
+        return fares_[trip];
+    }
+
+    TripState GetState(TripId trip) const noexcept
+    {
+        return IsLive(trip) ? TripState{origin_ids_[trip], destination_ids_[trip], operator_ids_[trip], fares_[trip], true}
+                            : TripState{};
+    }
+
+    void SetAirFare(TripId trip, std::uint32_t fare) noexcept
+    {
+        fares_[trip] = fare;
+    }
+
+    std::size_t Size() const noexcept
+    {
+        return live_.size();
+    }
+
+    const std::pmr::vector<InternId> &GetOriginColumn() const noexcept
+    {
+        return origin_ids_;
+    }
+
+    const std::pmr::vector<InternId> &GetDestinationColumn() const noexcept
+    {
+        return destination_ids_;
+    }
+
+    const std::pmr::vector<InternId> &GetOperatorColumn() const noexcept
+    {
+        return operator_ids_;
+    }
+
+    const std::pmr::vector<std::uint32_t> &GetFareColumn() const noexcept
+    {
+        return fares_;
+    }
+
+    const std::pmr::vector<std::uint8_t> &GetLiveColumn() const noexcept
+    {
+        return live_;
+    }
+
+private:
+    void Resize(std::size_t size) noexcept
+    {
+        origin_ids_.resize(size, kInvalidInternId);
+        destination_ids_.resize(size, kInvalidInternId);
+        operator_ids_.resize(size, kInvalidInternId);
+        fares_.resize(size, 0U);
+        live_.resize(size, 0U);
+    }
+
+    std::pmr::vector<InternId> origin_ids_;
+    std::pmr::vector<InternId> destination_ids_;
+    std::pmr::vector<InternId> operator_ids_;
+    std::pmr::vector<std::uint32_t> fares_;
+    std::pmr::vector<std::uint8_t> live_;
+};
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_TRIP_COLUMNS_H
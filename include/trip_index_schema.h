@@ -0,0 +1,323 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_TRIP_INDEX_SCHEMA_H
+#define FLIGHT_MANAGEMENT_INCLUDE_TRIP_INDEX_SCHEMA_H
+
+#include <algorithm>
+#include <cstdint>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "base_dataset.h"
+#include "common_data.h"
+#include "fare_history.h"
+#include "fare_ordered_index.h"
+#include "helper_database.h"
+#include "route_graph.h"
+#include "trip_columns.h"
+
+namespace flight_management
+{
+
+enum class IndexKind : std::uint8_t
+{
+    kSortedPostings = 0U, // trip ids sorted per key, tombstoned on removal
+    kFareOrdered = 1U,    // hashed key to a fare-ordered set of trips
+    kRouteGraph = 2U,     // CSR city graph weighted by each route's cheapest fare
+    kFareHistory = 3U     // per-trip undo log of fare and liveness changes
+};
+
+/**
+ * Key extractors: where an index reads its key from the trip columns, or
+ * from a TripState for a row as it stood at an earlier version.
+ */
+struct OriginKey
+{
+    using Type = InternId;
+
+    static Type Of(const TripColumns &columns, TripId trip) noexcept
+    {
+        return columns.GetOrigin(trip);
+    }
+
+    static Type Of(const TripState &state) noexcept
+    {
+        return state.origin;
+    }
+};
+
+struct DestinationKey
+{
+    using Type = InternId;
+
+    static Type Of(const TripColumns &columns, TripId trip) noexcept
+    {
+        return columns.GetDestination(trip);
+    }
+
+    static Type Of(const TripState &state) noexcept
+    {
+        return state.destination;
+    }
+};
+
+struct OperatorKey
+{
+    using Type = InternId;
+
+    static Type Of(const TripColumns &columns, TripId trip) noexcept
+    {
+        return columns.GetOperator(trip);
+    }
+
+    static Type Of(const TripState &state) noexcept
+    {
+        return state.flight_operator;
+    }
+};
+
+struct RouteKeyOf
+{
+    using Type = RouteKey;
+
+    static Type Of(const TripColumns &columns, TripId trip) noexcept
+    {
+        return MakeRouteKey(columns.GetOrigin(trip), columns.GetDestination(trip));
+    }
+
+    static Type Of(const TripState &state) noexcept
+    {
+        return MakeRouteKey(state.origin, state.destination);
+    }
+};
+
+/**
+ * Sorted postings keyed by KeyExtractor. The hooks run before the
+ * columns change, so they still see the trip's current key and fare.
+ */
+template <Filters filter, typename KeyExtractor>
+class PostingsIndex : public BaseDataset<filter>
+{
+public:
+    using KeyOf = KeyExtractor;
+    static constexpr IndexKind kKind{IndexKind::kSortedPostings};
+
+    using BaseDataset<filter>::BaseDataset;
+
+    void OnInsert(const TripColumns &columns, TripId trip) noexcept
+    {
+        this->Add(KeyOf::Of(columns, trip), trip);
+    }
+
+    void OnBulkInsert(const TripColumns &columns, const std::vector<TripId> &trips) noexcept
+    {
+        std::vector<std::pair<InternId, TripId>> entries{};
+        entries.reserve(trips.size());
+
+        for (TripId trip : trips)
+        {
+            entries.emplace_back(KeyOf::Of(columns, trip), trip);
+        }
+
+        this->BulkAdd(std::move(entries));
+    }
+
+    void OnErase(const TripColumns &, TripId) noexcept
+    {
+        this->MarkDead();
+    }
+
+    void OnFareChange(const TripColumns &, TripId, std::uint32_t) noexcept
+    {
+    }
+
+    /**
+     * False for a tombstone: the trip is dead or its column no longer
+     * holds key because it was re-added under another one.
+     */
+    bool IsCurrent(const TripColumns &columns, InternId key, TripId trip) const noexcept
+    {
+        return columns.IsLive(trip) && KeyOf::Of(columns, trip) == key;
+    }
+};
+
+/**
+ * Trips ordered by fare under a hashed key, kept exact on every mutation.
+ */
+template <typename KeyExtractor>
+class FareIndex : public FareOrderedIndex<typename KeyExtractor::Type>
+{
+public:
+    using KeyOf = KeyExtractor;
+    using Base = FareOrderedIndex<typename KeyExtractor::Type>;
+    static constexpr IndexKind kKind{IndexKind::kFareOrdered};
+
+    using Base::Base;
+
+    void OnInsert(const TripColumns &columns, TripId trip) noexcept
+    {
+        this->Add(KeyOf::Of(columns, trip), columns.GetAirFare(trip), trip);
+    }
+
+    void OnBulkInsert(const TripColumns &columns, const std::vector<TripId> &trips) noexcept
+    {
+        std::vector<std::pair<typename KeyOf::Type, FareEntry>> entries{};
+        entries.reserve(trips.size());
+
+        for (TripId trip : trips)
+        {
+            entries.emplace_back(KeyOf::Of(columns, trip), FareEntry{columns.GetAirFare(trip), trip});
+        }
+
+        this->BulkAdd(std::move(entries));
+    }
+
+    void OnErase(const TripColumns &columns, TripId trip) noexcept
+    {
+        this->Remove(KeyOf::Of(columns, trip), columns.GetAirFare(trip), trip);
+    }
+
+    void OnFareChange(const TripColumns &columns, TripId trip, std::uint32_t fare) noexcept
+    {
+        Base::UpdateFare(KeyOf::Of(columns, trip), columns.GetAirFare(trip), fare, trip);
+    }
+};
+
+/**
+ * The route graph, refreshed from RouteFares. The hooks only note which
+ * routes a mutation touched; once RouteFares has caught up the owner
+ * calls Refresh to re-weight just those edges.
+ */
+class RouteGraphIndex : public RouteGraph // FindCheapestItinerary, FindCheapestItineraries
+{
+public:
+    using KeyOf = RouteKeyOf;
+    static constexpr IndexKind kKind{IndexKind::kRouteGraph};
+
+    explicit RouteGraphIndex(std::pmr::memory_resource *resource = std::pmr::get_default_resource()) noexcept
+        : RouteGraph{resource},
+          dirty_{resource}
+    {
+    }
+
+    void OnInsert(const TripColumns &columns, TripId trip) noexcept
+    {
+        dirty_.push_back(KeyOf::Of(columns, trip));
+    }
+
+    void OnBulkInsert(const TripColumns &columns, const std::vector<TripId> &trips) noexcept
+    {
+        for (TripId trip : trips)
+        {
+            dirty_.push_back(KeyOf::Of(columns, trip));
+        }
+    }
+
+    void OnErase(const TripColumns &columns, TripId trip) noexcept
+    {
+        dirty_.push_back(KeyOf::Of(columns, trip));
+    }
+
+    void OnFareChange(const TripColumns &columns, TripId trip, std::uint32_t) noexcept
+    {
+        dirty_.push_back(KeyOf::Of(columns, trip));
+    }
+
+    /**
+     * Re-weights every touched route with cheapest_of(route), the route's
+     * cheapest remaining trip if any.
+     */
+    template <typename CheapestOf>
+    void Refresh(CheapestOf &&cheapest_of) noexcept
+    {
+        std::sort(dirty_.begin(), dirty_.end());
+        dirty_.erase(std::unique(dirty_.begin(), dirty_.end()), dirty_.end());
+
+        for (RouteKey route : dirty_)
+        {
+            SetEdge(RouteOrigin(route), RouteDestination(route), cheapest_of(route));
+        }
+
+        dirty_.clear();
+    }
+
+private:
+    std::pmr::vector<RouteKey> dirty_;
+};
+
+/**
+ * The fare history. The hooks run before the columns change, so a
+ * removal and a fare change still see the row they replace.
+ */
+class FareHistoryIndex : public FareHistory // Find* overloads taking a FareVersion
+{
+public:
+    static constexpr IndexKind kKind{IndexKind::kFareHistory};
+
+    using FareHistory::FareHistory;
+
+    void OnInsert(const TripColumns &, TripId trip) noexcept
+    {
+        RecordInsert(trip);
+    }
+
+    void OnBulkInsert(const TripColumns &, const std::vector<TripId> &trips) noexcept
+    {
+        RecordBulkInsert(trips);
+    }
+
+    void OnErase(const TripColumns &columns, TripId trip) noexcept
+    {
+        RecordRemoval(trip, columns.GetState(trip));
+    }
+
+    void OnFareChange(const TripColumns &columns, TripId trip, std::uint32_t fare) noexcept
+    {
+        RecordFareChange(trip, columns.GetAirFare(trip), fare);
+    }
+};
+
+/**
+ * The indexes a schema can pick from, and the queries each one serves.
+ */
+using OriginPostings = PostingsIndex<Filters::kOrigin, OriginKey>;           // FindFlightsByOriginCity
+using DestinationPostings = PostingsIndex<Filters::kDestination, DestinationKey>;
+using OperatorPostings = PostingsIndex<Filters::kFlightOperator, OperatorKey>; // UpdateFaresByOperator
+
+struct RouteFares : FareIndex<RouteKeyOf> // FindMinFareBetweenCities, FindCheapestFlightBetweenCities
+{
+    using FareIndex::FareIndex;
+};
+
+struct OperatorFares : FareIndex<OperatorKey> // FindMaxFareByOperator, FindTopKCheapestByOperator
+{
+    using FareIndex::FareIndex;
+};
+
+struct OriginFares : FareIndex<OriginKey> // FindFlightsByOriginInFareRange, FindTopKCheapest
+{
+    using FareIndex::FareIndex;
+};
+
+/**
+ * A compile-time index set. Indexes left out cost neither memory nor
+ * maintenance, and a query whose index is missing fails to compile.
+ */
+template <typename... Indexes>
+struct TripSchema
+{
+    using IndexSet = HelperDatabase<Indexes...>;
+
+    static constexpr std::size_t kIndexCount{sizeof...(Indexes)};
+
+    template <typename Index>
+    static constexpr bool kHas{(std::is_same_v<Index, Indexes> || ...)};
+};
+
+using FullTripSchema = TripSchema<OriginPostings, DestinationPostings, OperatorPostings, RouteFares, OperatorFares,
+                                  OriginFares, RouteGraphIndex, FareHistoryIndex>;
+using MinimalTripSchema = TripSchema<RouteFares>;
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_TRIP_INDEX_SCHEMA_H
@@ -0,0 +1,50 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_TRIP_MUTATION_H
+#define FLIGHT_MANAGEMENT_INCLUDE_TRIP_MUTATION_H
+
+#include <cstdint>
+#include <string>
+
+namespace flight_management
+{
+
+enum class MutationKind : std::uint8_t
+{
+    kAddTrip = 0U,
+    kRemoveTrip = 1U,
+    kUpdateFare = 2U
+};
+
+/**
+ * One AddTrip, RemoveTrip or UpdateFareByTrip call captured as data, so
+ * it can be batched and replayed. Unused fields are left empty.
+ */
+struct TripMutation
+{
+    static TripMutation AddTrip(std::string flight_number, std::string origin_city, std::string destination_city,
+                                std::string flight_operator, std::uint32_t fare) noexcept
+    {
+        return TripMutation{MutationKind::kAddTrip, std::move(flight_number), std::move(origin_city),
+                            std::move(destination_city), std::move(flight_operator), fare};
+    }
+
+    static TripMutation RemoveTrip(std::string flight_number) noexcept
+    {
+        return TripMutation{MutationKind::kRemoveTrip, std::move(flight_number), {}, {}, {}, 0U};
+    }
+
+    static TripMutation UpdateFare(std::string flight_number, std::uint32_t fare) noexcept
+    {
+        return TripMutation{MutationKind::kUpdateFare, std::move(flight_number), {}, {}, {}, fare};
+    }
+
+    MutationKind kind{MutationKind::kAddTrip};
+    std::string flight_number{};
+    std::string origin_city{};
+    std::string destination_city{};
+    std::string flight_operator{};
+    std::uint32_t fare{0U};
+};
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_TRIP_MUTATION_H
@@ -0,0 +1,24 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_TRIP_RECORD_H
+#define FLIGHT_MANAGEMENT_INCLUDE_TRIP_RECORD_H
+
+#include <cstdint>
+#include <string_view>
+
+namespace flight_management
+{
+
+/**
+ * Trip attributes viewed in place, e.g. inside a mapped schedule file.
+ */
+struct TripRecordView
+{
+    std::string_view flight_number{};
+    std::string_view origin_city{};
+    std::string_view destination_city{};
+    std::string_view flight_operator{};
+    std::uint32_t fare{0U};
+};
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_TRIP_RECORD_H
@@ -0,0 +1,183 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_TRIP_VIEW_H
+#define FLIGHT_MANAGEMENT_INCLUDE_TRIP_VIEW_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+
+#include "common_data.h"
+#include "flight_data.h"
+
+namespace flight_management
+{
+
+/**
+ * One trip of a database, read field by field on demand. Strings are
+ * views into the database's interners.
+ */
+template <typename Database>
+class BasicTripView
+{
+public:
+    BasicTripView(const Database &database, TripId trip) noexcept
+        : database_{&database},
+          trip_{trip}
+    {
+    }
+
+    TripId GetTripId() const noexcept
+    {
+        return trip_;
+    }
+
+    std::string_view GetFlightNumber() const noexcept
+    {
+        return database_->flight_numbers_.Get(trip_);
+    }
+
+    std::string_view GetOriginCity() const noexcept
+    {
+        return database_->cities_.Get(database_->trip_columns_.GetOrigin(trip_));
+    }
+
+    std::string_view GetDestinationCity() const noexcept
+    {
+        return database_->cities_.Get(database_->trip_columns_.GetDestination(trip_));
+    }
+
+    std::string_view GetOperator() const noexcept
+    {
+        return database_->operators_.Get(database_->trip_columns_.GetOperator(trip_));
+    }
+
+    std::uint32_t GetAirFare() const noexcept
+    {
+        return database_->trip_columns_.GetAirFare(trip_);
+    }
+
+    FlightData ToFlightData() const noexcept
+    {
+        return database_->MakeFlightData(trip_);
+    }
+
+private:
+    const Database *database_;
+    TripId trip_;
+};
+
+/**
+ * Forward range of trip views over one key's postings in a sorted
+ * postings index, skipping tombstones as it goes.
+ */
+template <typename Database, typename Index>
+class BasicTripRange
+{
+public:
+    using View = BasicTripView<Database>;
+
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = View;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = View;
+
+        Iterator(const BasicTripRange &range, const TripId *position) noexcept
+            : range_{&range},
+              position_{position}
+        {
+            SkipDead();
+        }
+
+        View operator*() const noexcept
+        {
+            return View{*range_->database_, *position_};
+        }
+
+        Iterator &operator++() noexcept
+        {
+            ++position_;
+            SkipDead();
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept
+        {
+            Iterator previous{*this};
+            ++(*this);
+            return previous;
+        }
+
+        bool operator==(const Iterator &other) const noexcept
+        {
+            return position_ == other.position_;
+        }
+
+        bool operator!=(const Iterator &other) const noexcept
+        {
+            return position_ != other.position_;
+        }
+
+    private:
+        void SkipDead() noexcept
+        {
+            while (position_ != range_->end_ && !range_->IsCurrent(*position_))
+            {
+                ++position_;
+            }
+        }
+
+        const BasicTripRange *range_;
+        const TripId *position_;
+    };
+
+    BasicTripRange(const Database &database, InternId key) noexcept
+        : database_{&database},
+          key_{key}
+    {
+        if (key != kInvalidInternId)
+        {
+            auto const &postings{Postings().EqualRange(key)};
+            begin_ = postings.data();
+            end_ = begin_ + postings.size();
+        }
+    }
+
+    Iterator begin() const noexcept
+    {
+        return Iterator{*this, begin_};
+    }
+
+    Iterator end() const noexcept
+    {
+        return Iterator{*this, end_};
+    }
+
+    bool empty() const noexcept
+    {
+        return begin() == end();
+    }
+
+private:
+    const Index &Postings() const noexcept
+    {
+        return database_->indexes_.template Get<Index>();
+    }
+
+    bool IsCurrent(TripId trip) const noexcept
+    {
+        return Postings().IsCurrent(database_->trip_columns_, key_, trip);
+    }
+
+    const Database *database_;
+    InternId key_;
+    const TripId *begin_{nullptr};
+    const TripId *end_{nullptr};
+};
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_TRIP_VIEW_H
@@ -0,0 +1,75 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_WORK_STEALING_THREAD_POOL_H
+#define FLIGHT_MANAGEMENT_INCLUDE_WORK_STEALING_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace flight_management
+{
+
+/**
+ * Fixed set of workers, each with its own task deque. A worker pops the
+ * newest task of its own deque and, when that is empty, steals the
+ * oldest task of another, so uneven chunks even out without a shared
+ * queue. The thread calling ParallelFor works and steals alongside them.
+ * Posted tasks wait in a separate queue that only workers take from.
+ */
+class WorkStealingThreadPool final
+{
+public:
+    explicit WorkStealingThreadPool(std::size_t thread_count = std::thread::hardware_concurrency()) noexcept;
+    ~WorkStealingThreadPool() noexcept;
+
+    WorkStealingThreadPool(const WorkStealingThreadPool &) = delete;
+    WorkStealingThreadPool &operator=(const WorkStealingThreadPool &) = delete;
+
+    /**
+     * Calls body(begin, end) over [0, count) in chunks of up to grain and
+     * returns once every chunk has run. Chunks run concurrently, so body
+     * must only write state owned by its chunk.
+     */
+    void ParallelFor(std::size_t count, std::size_t grain,
+                     const std::function<void(std::size_t, std::size_t)> &body) noexcept;
+
+    /**
+     * Queues task to run once on some worker and returns at once. Posted
+     * tasks share one queue that workers take from oldest first, once no
+     * ParallelFor chunk is waiting; a thread blocked in ParallelFor never
+     * runs them. A pool without workers runs task on the calling thread.
+     */
+    void Post(std::function<void()> task) noexcept;
+
+    std::size_t GetThreadCount() const noexcept;
+
+private:
+    using Task = std::function<void()>;
+
+    struct Queue
+    {
+        std::mutex mutex{};
+        std::deque<Task> tasks{};
+    };
+
+    void Push(std::size_t queue, Task task) noexcept;
+    bool TryRunOne(std::size_t self) noexcept;
+    void WorkerLoop(std::size_t self) noexcept;
+
+    // One queue per worker, and a last one the calling threads push to.
+    std::vector<std::unique_ptr<Queue>> queues_{};
+    Queue posted_{};
+    std::vector<std::thread> threads_{};
+    std::atomic<std::size_t> queued_{0U};
+    std::mutex wake_mutex_{};
+    std::condition_variable wake_{};
+    bool stopping_{false};
+};
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_WORK_STEALING_THREAD_POOL_H
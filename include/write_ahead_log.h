@@ -0,0 +1,91 @@
+#ifndef FLIGHT_MANAGEMENT_INCLUDE_WRITE_AHEAD_LOG_H
+#define FLIGHT_MANAGEMENT_INCLUDE_WRITE_AHEAD_LOG_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "trip_mutation.h"
+#include "trip_record.h"
+
+namespace flight_management
+{
+
+enum class Durability : std::uint8_t
+{
+    kNone = 0U,        // written when the buffer fills, never synced
+    kGroupCommit = 1U, // synced once per group of records and on Commit
+    kEveryWrite = 2U   // synced before every Append returns
+};
+
+struct WalOptions
+{
+    Durability durability{Durability::kGroupCommit};
+    std::size_t group_commit_records{64U};
+    std::size_t buffer_bytes{1U << 16U};
+};
+
+struct WalReplayResult
+{
+    std::size_t records{0U};
+    std::uint64_t valid_bytes{0U};
+    std::uint64_t last_sequence{0U};
+    bool torn_tail{false};
+};
+
+/**
+ * Append-only binary log of trip mutations.
+ *
+ * Every record is framed as [u32 body length][u32 CRC-32 of body] and
+ * the body holds a u64 sequence number, the mutation kind, the fare and
+ * four u32-length-prefixed strings. Replay stops at the first record that
+ * is short, fails its CRC or breaks the sequence, which is where a crash
+ * tore the tail. Reopening truncates the file back to that point and
+ * syncs both the file and its directory. Append fails, logging nothing,
+ * for a record whose body would not fit its u32 length.
+ *
+ * A write or sync that fails is reported by the Append or Commit that
+ * attempted it, and leaves the log failed: every later Append and Commit
+ * fails too, so nothing is logged after a gap. Reset, which starts the
+ * log over after a checkpoint, clears the failure.
+ */
+class WriteAheadLog final
+{
+public:
+    using Visitor = std::function<void(const TripMutation &)>;
+
+    static WalReplayResult Replay(const std::string &path, const Visitor &visit) noexcept;
+    static std::unique_ptr<WriteAheadLog> Open(const std::string &path, WalOptions options,
+                                               const WalReplayResult &recovered = {}) noexcept;
+
+    ~WriteAheadLog() noexcept;
+
+    WriteAheadLog(const WriteAheadLog &) = delete;
+    WriteAheadLog &operator=(const WriteAheadLog &) = delete;
+
+    bool Append(MutationKind kind, const TripRecordView &record) noexcept;
+    bool Append(const TripMutation &mutation) noexcept;
+    bool Commit() noexcept;
+    bool Reset() noexcept;
+    std::uint64_t GetLastSequence() const noexcept;
+
+private:
+    WriteAheadLog(int descriptor, WalOptions options, std::uint64_t last_sequence) noexcept;
+
+    bool FlushLocked(bool sync) noexcept;
+
+    mutable std::mutex mutex_{};
+    int descriptor_{-1};
+    WalOptions options_{};
+    std::uint64_t last_sequence_{0U};
+    std::size_t pending_records_{0U};
+    bool failed_{false};
+    std::vector<char> pending_{};
+};
+
+} // namespace flight_management
+
+#endif //FLIGHT_MANAGEMENT_INCLUDE_WRITE_AHEAD_LOG_H
@@ -0,0 +1,111 @@
+#include <algorithm>
+
+#include "async_flight_trip_database.h"
+
+namespace flight_management
+{
+
+AsyncFlightTripDatabase::AsyncFlightTripDatabase(const ConcurrentFlightTripDatabase &database,
+                                                 WorkStealingThreadPool &pool, std::size_t chunk_size) noexcept
+    : database_{database},
+      pool_{pool},
+      chunk_size_{std::max<std::size_t>(chunk_size, 1U)}
+{
+}
+
+Task<AsyncResult<std::optional<FlightData>>> AsyncFlightTripDatabase::FindFlightsByNumber(
+    std::string flight_number, QueryContext context) const noexcept
+{
+    return RunPointQuery(std::move(context), std::optional<FlightData>{},
+                         [flight_number = std::move(flight_number)](const FlightTripDatabase &snapshot) {
+                             return snapshot.FindFlightsByNumber(flight_number);
+                         });
+}
+
+Task<AsyncResult<std::uint32_t>> AsyncFlightTripDatabase::FindMinFareBetweenCities(std::string origin_city,
+                                                                                   std::string destination_city,
+                                                                                   QueryContext context) const noexcept
+{
+    return RunPointQuery(std::move(context), std::uint32_t{UINT_MAX},
+                         [origin_city = std::move(origin_city),
+                          destination_city = std::move(destination_city)](const FlightTripDatabase &snapshot) {
+                             return snapshot.FindMinFareBetweenCities(origin_city, destination_city);
+                         });
+}
+
+Task<AsyncResult<std::uint32_t>> AsyncFlightTripDatabase::FindMaxFareByOperator(std::string flight_operator,
+                                                                                QueryContext context) const noexcept
+{
+    return RunPointQuery(std::move(context), std::uint32_t{0U},
+                         [flight_operator = std::move(flight_operator)](const FlightTripDatabase &snapshot) {
+                             return snapshot.FindMaxFareByOperator(flight_operator);
+                         });
+}
+
+Task<AsyncResult<std::uint32_t>> AsyncFlightTripDatabase::FindAverageCostOfAllTrips(QueryContext context) const noexcept
+{
+    // Kept up to date by the aggregates, so this is a point query rather than a scan.
+    return RunPointQuery(std::move(context), std::uint32_t{0U},
+                         [](const FlightTripDatabase &snapshot) { return snapshot.FindAverageCostOfAllTrips(); });
+}
+
+Task<AsyncResult<std::vector<FlightData>>> AsyncFlightTripDatabase::FindFlightsByOriginCity(
+    std::string origin_city, QueryContext context) const noexcept
+{
+    auto stream{StreamFlightsByOriginCity(std::move(origin_city), std::move(context))};
+    std::vector<FlightData> flights{};
+
+    while (auto chunk{co_await stream.Next()})
+    {
+        flights.insert(flights.end(), std::make_move_iterator(chunk->begin()), std::make_move_iterator(chunk->end()));
+    }
+
+    if (stream.GetStatus() != QueryStatus::kOk)
+    {
+        flights.clear();
+    }
+
+    co_return AsyncResult<std::vector<FlightData>>{stream.GetStatus(), std::move(flights)};
+}
+
+ChunkStream<FlightData> AsyncFlightTripDatabase::StreamFlightsByOriginCity(std::string origin_city,
+                                                                           QueryContext context) const noexcept
+{
+    co_await ResumeOn{pool_};
+
+    // Held across every yield, so the views stay valid while writers publish.
+    auto const snapshot{database_.GetSnapshot()};
+    std::vector<FlightData> chunk{};
+    chunk.reserve(chunk_size_);
+
+    if (QueryStatus const status{context.GetStatus()}; status != QueryStatus::kOk)
+    {
+        co_return status;
+    }
+
+    for (TripView const trip : snapshot->ViewFlightsByOriginCity(origin_city))
+    {
+        chunk.push_back(trip.ToFlightData());
+
+        if (chunk.size() == chunk_size_)
+        {
+            co_yield std::exchange(chunk, {});
+            chunk.reserve(chunk_size_);
+            co_await ResumeOn{pool_};
+
+            if (QueryStatus const status{context.GetStatus()}; status != QueryStatus::kOk)
+            {
+                co_return status;
+            }
+        }
+    }
+
+    if (!chunk.empty())
+    {
+        co_yield std::move(chunk);
+    }
+
+    co_return QueryStatus::kOk;
+}
+
+} // namespace flight_management
@@ -0,0 +1,149 @@
+#include <numeric>
+
+#include "compressed_columns.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+// Below this many rows in one block, reading each row beats unpacking all 128.
+constexpr std::size_t kGatherUnpackRows{8U};
+
+} // namespace
+
+CompressedColumn::CompressedColumn(const std::uint32_t *values, std::size_t count) noexcept
+    : size_{count}
+{
+    blocks_.reserve((count + kPackedBlockSize - 1U) / kPackedBlockSize);
+    std::uint32_t offsets[kPackedBlockSize];
+
+    for (std::size_t begin = 0U; begin < count; begin += kPackedBlockSize)
+    {
+        std::size_t const length{std::min(kPackedBlockSize, count - begin)};
+        auto const [min, max]{std::minmax_element(values + begin, values + begin + length)};
+
+        Block const block{*min, static_cast<std::uint32_t>(words_.size()), PackedBitWidth(*max - *min)};
+
+        // A short last block is padded with its minimum, which packs as 0.
+        std::fill(offsets, offsets + kPackedBlockSize, 0U);
+        std::transform(values + begin, values + begin + length, offsets,
+                       [&block](std::uint32_t value) { return value - block.min; });
+
+        words_.resize(words_.size() + PackedBlockWords(block.width));
+        PackBlock(offsets, block.width, words_.data() + block.offset);
+        blocks_.push_back(block);
+    }
+
+    words_.shrink_to_fit();
+}
+
+std::uint64_t CompressedColumn::Sum() const noexcept
+{
+    alignas(16) std::uint32_t offsets[kPackedBlockSize];
+    std::uint64_t sum{0U};
+
+    for (std::size_t index = 0U; index < blocks_.size(); ++index)
+    {
+        Block const &block{blocks_[index]};
+        std::size_t const length{std::min(kPackedBlockSize, size_ - index * kPackedBlockSize)};
+
+        UnpackBlock(words_.data() + block.offset, block.width, 0U, offsets);
+        sum += std::accumulate(offsets, offsets + kPackedBlockSize, std::uint64_t{0U}) +
+               static_cast<std::uint64_t>(block.min) * length;
+    }
+
+    return sum;
+}
+
+void CompressedColumn::Gather(const std::uint32_t *rows, std::size_t count, std::uint32_t *values) const noexcept
+{
+    alignas(16) std::uint32_t unpacked[kPackedBlockSize];
+
+    for (std::size_t begin = 0U; begin < count;)
+    {
+        std::size_t const block_index{rows[begin] / kPackedBlockSize};
+        std::size_t end{begin + 1U};
+        while (end < count && rows[end] / kPackedBlockSize == block_index)
+        {
+            ++end;
+        }
+
+        Block const &block{blocks_[block_index]};
+
+        if (end - begin >= kGatherUnpackRows)
+        {
+            UnpackBlock(words_.data() + block.offset, block.width, block.min, unpacked);
+            for (; begin < end; ++begin)
+            {
+                values[begin] = unpacked[rows[begin] % kPackedBlockSize];
+            }
+        }
+        else
+        {
+            for (; begin < end; ++begin)
+            {
+                values[begin] = block.min + UnpackValue(words_.data() + block.offset, block.width,
+                                                        rows[begin] % kPackedBlockSize);
+            }
+        }
+    }
+}
+
+std::size_t CompressedColumn::GetByteSize() const noexcept
+{
+    return blocks_.capacity() * sizeof(Block) + words_.capacity() * sizeof(std::uint32_t);
+}
+
+void CompressedPostings::Append(const TripId *ids, std::size_t count) noexcept
+{
+    std::uint32_t gaps[kPackedBlockSize];
+
+    for (std::size_t begin = 0U; begin < count; begin += kPackedBlockSize)
+    {
+        std::size_t const length{std::min(kPackedBlockSize, count - begin)};
+
+        // The first gap is from the block's own first id, so it is always 0.
+        std::fill(gaps, gaps + kPackedBlockSize, 0U);
+        std::adjacent_difference(ids + begin, ids + begin + length, gaps);
+        gaps[0] = 0U;
+
+        Block const block{ids[begin], ids[begin + length - 1U], static_cast<std::uint32_t>(words_.size()),
+                          static_cast<std::uint16_t>(PackedBitWidth(*std::max_element(gaps, gaps + length))),
+                          static_cast<std::uint16_t>(length)};
+
+        words_.resize(words_.size() + PackedBlockWords(block.width));
+        PackBlock(gaps, block.width, words_.data() + block.offset);
+        blocks_.push_back(block);
+    }
+
+    key_blocks_.push_back(static_cast<std::uint32_t>(blocks_.size()));
+}
+
+void CompressedPostings::ShrinkToFit() noexcept
+{
+    key_blocks_.shrink_to_fit();
+    blocks_.shrink_to_fit();
+    words_.shrink_to_fit();
+}
+
+std::size_t CompressedPostings::GetEntryCount(InternId key) const noexcept
+{
+    std::size_t count{0U};
+
+    for (Block const &block : GetBlocks(key))
+    {
+        count += block.count;
+    }
+
+    return count;
+}
+
+std::size_t CompressedPostings::GetByteSize() const noexcept
+{
+    return key_blocks_.capacity() * sizeof(std::uint32_t) + blocks_.capacity() * sizeof(Block) +
+           words_.capacity() * sizeof(std::uint32_t);
+}
+
+} // namespace flight_management
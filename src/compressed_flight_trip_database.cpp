@@ -0,0 +1,209 @@
+#include <algorithm>
+#include <climits>
+#include <iterator>
+
+#include "compressed_flight_trip_database.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+/**
+ * The current entries of every key below key_count in index, with the
+ * tombstones the live index still filters at query time left behind.
+ */
+template <typename Index>
+CompressedPostings CompressPostings(const Index &index, const TripColumns &columns, std::size_t key_count) noexcept
+{
+    CompressedPostings postings{};
+    std::vector<TripId> trips{};
+
+    for (InternId key = 0U; key < key_count; ++key)
+    {
+        auto const &entries{index.EqualRange(key)};
+
+        trips.clear();
+        std::copy_if(entries.cbegin(), entries.cend(), std::back_inserter(trips),
+                     [&index, &columns, key](TripId trip) { return index.IsCurrent(columns, key, trip); });
+        postings.Append(trips.data(), trips.size());
+    }
+
+    postings.ShrinkToFit();
+
+    return postings;
+}
+
+// Plain loops over a gathered block, left for the compiler to vectorise.
+std::uint32_t BlockMax(const std::uint32_t *values, std::size_t count, std::uint32_t max) noexcept
+{
+    for (std::size_t index = 0U; index < count; ++index)
+    {
+        max = std::max(max, values[index]);
+    }
+
+    return max;
+}
+
+std::uint32_t BlockMin(const std::uint32_t *values, std::size_t count, std::uint32_t min) noexcept
+{
+    for (std::size_t index = 0U; index < count; ++index)
+    {
+        min = std::min(min, values[index]);
+    }
+
+    return min;
+}
+
+} // namespace
+
+CompressedFlightTripDatabase::CompressedFlightTripDatabase(const FlightTripDatabase &database) noexcept
+    : flight_numbers_{database.flight_numbers_},
+      cities_{database.cities_},
+      operators_{database.operators_},
+      origin_ids_{database.trip_columns_.GetOriginColumn().data(), database.trip_columns_.Size()},
+      destination_ids_{database.trip_columns_.GetDestinationColumn().data(), database.trip_columns_.Size()},
+      operator_ids_{database.trip_columns_.GetOperatorColumn().data(), database.trip_columns_.Size()},
+      origin_postings_{CompressPostings(database.indexes_.Get<OriginPostings>(), database.trip_columns_, cities_.Size())},
+      destination_postings_{
+          CompressPostings(database.indexes_.Get<DestinationPostings>(), database.trip_columns_, cities_.Size())},
+      operator_postings_{
+          CompressPostings(database.indexes_.Get<OperatorPostings>(), database.trip_columns_, operators_.Size())},
+      trip_count_{database.GetTripCount()}
+{
+    auto const &columns{database.trip_columns_};
+
+    // Removed rows read as fare 0, so the column sums to the live total.
+    std::vector<std::uint32_t> fares(columns.Size());
+    std::vector<std::uint32_t> live(columns.Size());
+
+    for (TripId trip = 0U; trip < columns.Size(); ++trip)
+    {
+        live[trip] = columns.IsLive(trip) ? 1U : 0U;
+        fares[trip] = columns.IsLive(trip) ? columns.GetAirFare(trip) : 0U;
+    }
+
+    fares_ = CompressedColumn{fares.data(), fares.size()};
+    live_ = CompressedColumn{live.data(), live.size()};
+}
+
+TripId CompressedFlightTripDatabase::FindLiveTrip(std::string_view flight_number) const noexcept
+{
+    TripId const trip{flight_numbers_.Find(flight_number)};
+
+    return (trip != kInvalidInternId && trip < live_.Size() && live_.Get(trip) != 0U) ? trip : kInvalidInternId;
+}
+
+FlightData CompressedFlightTripDatabase::MakeFlightData(TripId trip) const noexcept
+{
+    return FlightData{flight_numbers_.Get(trip), cities_.Get(origin_ids_.Get(trip)),
+                      cities_.Get(destination_ids_.Get(trip)), operators_.Get(operator_ids_.Get(trip)),
+                      fares_.Get(trip)};
+}
+
+std::vector<FlightData> CompressedFlightTripDatabase::FindFlights(const CompressedPostings &postings,
+                                                                  InternId key) const noexcept
+{
+    std::vector<FlightData> flight_data{};
+
+    if (key == kInvalidInternId)
+    {
+        return flight_data;
+    }
+
+    flight_data.reserve(postings.GetEntryCount(key));
+    postings.ForEach(key, [this, &flight_data](TripId trip) { flight_data.emplace_back(MakeFlightData(trip)); });
+
+    return flight_data;
+}
+
+std::uint32_t CompressedFlightTripDatabase::FindMaxFare(std::string_view flight_operator) const noexcept
+{
+    std::uint32_t max_fare{0U};
+
+    InternId const operator_id{operators_.Find(flight_operator)};
+    if (operator_id == kInvalidInternId)
+    {
+        return max_fare;
+    }
+
+    alignas(16) TripId trips[kPackedBlockSize];
+    alignas(16) std::uint32_t fares[kPackedBlockSize];
+
+    for (auto const &block : operator_postings_.GetBlocks(operator_id))
+    {
+        operator_postings_.Decode(block, trips);
+        fares_.Gather(trips, block.count, fares);
+        max_fare = BlockMax(fares, block.count, max_fare);
+    }
+
+    return max_fare;
+}
+
+std::uint32_t CompressedFlightTripDatabase::FindMinFare(std::string_view origin_city,
+                                                        std::string_view destination_city) const noexcept
+{
+    std::uint32_t min_fare{UINT_MAX};
+
+    InternId const origin_id{cities_.Find(origin_city)};
+    InternId const destination_id{cities_.Find(destination_city)};
+    if (origin_id == kInvalidInternId || destination_id == kInvalidInternId)
+    {
+        return min_fare;
+    }
+
+    // The intersection yields one trip at a time; its fares are gathered a block's worth at once.
+    alignas(16) TripId trips[kPackedBlockSize];
+    alignas(16) std::uint32_t fares[kPackedBlockSize];
+    std::size_t pending{0U};
+
+    auto const flush = [this, &trips, &fares, &pending, &min_fare] {
+        fares_.Gather(trips, pending, fares);
+        min_fare = BlockMin(fares, pending, min_fare);
+        pending = 0U;
+    };
+
+    IntersectPostings(origin_postings_, origin_id, destination_postings_, destination_id,
+                      [&trips, &pending, &flush](TripId trip) {
+                          trips[pending++] = trip;
+                          if (pending == kPackedBlockSize)
+                          {
+                              flush();
+                          }
+                      });
+    flush();
+
+    return min_fare;
+}
+
+bool CompressedFlightTripDatabase::IsTripInDatabase(std::string_view flight_number) const noexcept
+{
+    return FindLiveTrip(flight_number) != kInvalidInternId;
+}
+
+std::uint32_t CompressedFlightTripDatabase::FindAverageCostOfAllTrips() const noexcept
+{
+    return (trip_count_ != 0U) ? static_cast<std::uint32_t>(fares_.Sum() / trip_count_) : 0U;
+}
+
+std::optional<FlightData> CompressedFlightTripDatabase::FindFlightsByNumber(std::string_view flight_number) const noexcept
+{
+    TripId const trip{FindLiveTrip(flight_number)};
+
+    return (trip != kInvalidInternId) ? std::make_optional(MakeFlightData(trip)) : std::nullopt;
+}
+
+std::size_t CompressedFlightTripDatabase::GetTripCount() const noexcept
+{
+    return trip_count_;
+}
+
+std::size_t CompressedFlightTripDatabase::GetStorageBytes() const noexcept
+{
+    return origin_ids_.GetByteSize() + destination_ids_.GetByteSize() + operator_ids_.GetByteSize() +
+           fares_.GetByteSize() + live_.GetByteSize() + origin_postings_.GetByteSize() +
+           destination_postings_.GetByteSize() + operator_postings_.GetByteSize();
+}
+
+} // namespace flight_management
@@ -0,0 +1,128 @@
+#include <algorithm>
+
+#include "concurrent_flight_trip_database.h"
+
+namespace flight_management
+{
+
+ConcurrentFlightTripDatabase::ConcurrentFlightTripDatabase() noexcept
+    : standby_{std::make_shared<FlightTripDatabase>()},
+      current_{std::make_shared<const FlightTripDatabase>()}
+{
+}
+
+ConcurrentFlightTripDatabase::Snapshot ConcurrentFlightTripDatabase::GetSnapshot() const noexcept
+{
+    return current_.load(std::memory_order_acquire);
+}
+
+std::size_t ConcurrentFlightTripDatabase::Publish(const std::vector<TripMutation> &batch) noexcept
+{
+    std::lock_guard<std::mutex> lock{writer_mutex_};
+
+    std::size_t applied{0U};
+
+    for (auto const &mutation : batch)
+    {
+        applied += standby_->ApplyMutation(mutation) ? 1U : 0U;
+    }
+
+    // The retired snapshot has seen every batch before this one.
+    Snapshot retired{current_.exchange(std::move(standby_), std::memory_order_acq_rel)};
+    retired_.push_back(RetiredVersion{std::move(retired), batches_published_});
+    pending_batches_.push_back(batch);
+    ++batches_published_;
+
+    standby_ = TakeStandby();
+
+    // Batches every retired snapshot has seen are no longer needed.
+    auto const oldest{std::min_element(retired_.cbegin(), retired_.cend(),
+                                       [](const RetiredVersion &lhs, const RetiredVersion &rhs) {
+                                           return lhs.batches_applied < rhs.batches_applied;
+                                       })};
+    std::uint64_t const needed_from{(oldest != retired_.cend()) ? oldest->batches_applied : batches_published_};
+
+    for (; first_pending_batch_ < needed_from; ++first_pending_batch_)
+    {
+        pending_batches_.pop_front();
+    }
+
+    return applied;
+}
+
+std::shared_ptr<FlightTripDatabase> ConcurrentFlightTripDatabase::TakeStandby() noexcept
+{
+    // Retired snapshots are unreachable for new readers, so a use count of
+    // one means no reader holds it any more and it may be written again.
+    auto const is_free = [](const RetiredVersion &version) { return version.database.use_count() == 1; };
+
+    std::optional<RetiredVersion> newest{};
+
+    for (auto &version : retired_)
+    {
+        if (is_free(version) && (!newest || version.batches_applied > newest->batches_applied))
+        {
+            newest = std::move(version);
+        }
+    }
+
+    // Other free snapshots would only need more replaying; let them go.
+    retired_.erase(std::remove_if(retired_.begin(), retired_.end(),
+                                  [&is_free](const RetiredVersion &version) {
+                                      return !version.database || is_free(version);
+                                  }),
+                   retired_.end());
+
+    if (!newest)
+    {
+        return std::make_shared<FlightTripDatabase>(*current_.load(std::memory_order_relaxed));
+    }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    auto standby{std::const_pointer_cast<FlightTripDatabase>(std::move(newest->database))};
+
+    for (std::uint64_t batch = newest->batches_applied; batch < batches_published_; ++batch)
+    {
+        for (auto const &mutation : pending_batches_[batch - first_pending_batch_])
+        {
+            standby->ApplyMutation(mutation);
+        }
+    }
+
+    return standby;
+}
+
+bool ConcurrentFlightTripDatabase::RemoveTrip(std::string_view flight_number) noexcept
+{
+    return Publish({TripMutation::RemoveTrip(std::string{flight_number})}) == 1U;
+}
+
+bool ConcurrentFlightTripDatabase::UpdateFareByTrip(std::string_view flight_number, std::uint32_t fare) noexcept
+{
+    return Publish({TripMutation::UpdateFare(std::string{flight_number}, fare)}) == 1U;
+}
+
+bool ConcurrentFlightTripDatabase::IsTripInDatabase(std::string_view flight_number) const noexcept
+{
+    return GetSnapshot()->IsTripInDatabase(flight_number);
+}
+
+std::uint32_t ConcurrentFlightTripDatabase::FindAverageCostOfAllTrips() const noexcept
+{
+    return GetSnapshot()->FindAverageCostOfAllTrips();
+}
+
+std::optional<FlightData> ConcurrentFlightTripDatabase::FindFlightsByNumber(std::string_view flight_number) const noexcept
+{
+    return GetSnapshot()->FindFlightsByNumber(flight_number);
+}
+
+std::size_t ConcurrentFlightTripDatabase::GetVersionCount() const noexcept
+{
+    std::lock_guard<std::mutex> lock{writer_mutex_};
+
+    return retired_.size() + 2U;
+}
+
+} // namespace flight_management
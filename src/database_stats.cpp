@@ -0,0 +1,114 @@
+#include <sstream>
+
+#include "database_stats.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+constexpr std::array<std::string_view, kStatsOperationCount> kOperationNames{
+    "add_trip",        "bulk_load",          "remove_trip",
+    "update_fare",     "update_fares_by_operator", "find_by_number",
+    "find_by_origin_city", "find_by_fare",   "min_fare_between_cities",
+    "max_fare_by_operator", "cheapest_itinerary", "execute_batch"};
+
+double Seconds(std::uint64_t nanoseconds) noexcept
+{
+    return static_cast<double>(nanoseconds) / 1e9;
+}
+
+} // namespace
+
+std::string_view StatsOperationName(StatsOperation operation) noexcept
+{
+    return kOperationNames[static_cast<std::size_t>(operation)];
+}
+
+std::string FormatPrometheus(const DatabaseStats &stats, std::string_view prefix)
+{
+    std::ostringstream out{};
+
+    auto family = [&out, prefix](std::string_view name, std::string_view type, std::string_view help) {
+        out << "# HELP " << prefix << '_' << name << ' ' << help << '\n';
+        out << "# TYPE " << prefix << '_' << name << ' ' << type << '\n';
+    };
+
+    family("operation_latency_seconds", "summary", "Latency of FlightTripDatabase operations.");
+    for (std::size_t index = 0U; index < kStatsOperationCount; ++index)
+    {
+        auto const &operation{stats.operations[index]};
+        std::string_view const name{kOperationNames[index]};
+
+        for (auto const &quantile : {std::make_pair("0.5", operation.p50_nanoseconds),
+                                     std::make_pair("0.9", operation.p90_nanoseconds),
+                                     std::make_pair("0.99", operation.p99_nanoseconds),
+                                     std::make_pair("1", operation.max_nanoseconds)})
+        {
+            out << prefix << "_operation_latency_seconds{operation=\"" << name << "\",quantile=\"" << quantile.first
+                << "\"} " << Seconds(quantile.second) << '\n';
+        }
+        out << prefix << "_operation_latency_seconds_sum{operation=\"" << name << "\"} "
+            << Seconds(operation.total_nanoseconds) << '\n';
+        out << prefix << "_operation_latency_seconds_count{operation=\"" << name << "\"} " << operation.count << '\n';
+    }
+
+    family("index_probes_total", "counter", "Interner and index lookups made by each operation.");
+    for (std::size_t index = 0U; index < kStatsOperationCount; ++index)
+    {
+        out << prefix << "_index_probes_total{operation=\"" << kOperationNames[index] << "\"} "
+            << stats.operations[index].index_probes << '\n';
+    }
+
+    family("result_rows_total", "counter", "Rows returned or changed by each operation.");
+    for (std::size_t index = 0U; index < kStatsOperationCount; ++index)
+    {
+        out << prefix << "_result_rows_total{operation=\"" << kOperationNames[index] << "\"} "
+            << stats.operations[index].result_rows << '\n';
+    }
+
+    family("allocations_total", "counter", "Allocations drawn by the database's containers.");
+    out << prefix << "_allocations_total " << stats.allocations << '\n';
+
+    family("memory_bytes", "gauge", "Bytes held by the database's containers.");
+    out << prefix << "_memory_bytes{area=\"storage\"} " << stats.storage_bytes << '\n';
+    out << prefix << "_memory_bytes{area=\"indexes\"} " << stats.index_bytes << '\n';
+
+    family("index_entries", "gauge", "Postings entries, dead ones awaiting compaction.");
+    out << prefix << "_index_entries{state=\"live\"} " << stats.index_entries.live_entries << '\n';
+    out << prefix << "_index_entries{state=\"dead\"} " << stats.index_entries.dead_entries << '\n';
+
+    family("index_compactions_total", "counter", "Postings compactions run.");
+    out << prefix << "_index_compactions_total " << stats.index_entries.compactions << '\n';
+
+    return out.str();
+}
+
+#if FLIGHT_MANAGEMENT_ENABLE_STATS
+
+void StatsRecorder::Collect(DatabaseStats &stats) const noexcept
+{
+    for (std::size_t index = 0U; index < kStatsOperationCount; ++index)
+    {
+        auto const &latency{latencies_[index]};
+        auto &operation{stats.operations[index]};
+
+        operation.count = latency.GetCount();
+        operation.total_nanoseconds = latency.GetSum();
+        operation.p50_nanoseconds = latency.ValueAtQuantile(0.5);
+        operation.p90_nanoseconds = latency.ValueAtQuantile(0.9);
+        operation.p99_nanoseconds = latency.ValueAtQuantile(0.99);
+        operation.max_nanoseconds = latency.GetMax();
+        operation.index_probes = probes_[index].load(std::memory_order_relaxed);
+        operation.result_rows = rows_[index].load(std::memory_order_relaxed);
+    }
+
+    stats.allocations = storage_.GetAllocations() + indexes_.GetAllocations();
+    stats.storage_bytes = storage_.GetOutstandingBytes();
+    stats.index_bytes = indexes_.GetOutstandingBytes();
+}
+
+#endif
+
+} // namespace flight_management
@@ -0,0 +1,89 @@
+#include <sys/stat.h>
+
+#include "durable_flight_trip_database.h"
+#include "mapped_flight_trip_database.h"
+
+namespace flight_management
+{
+
+std::unique_ptr<DurableFlightTripDatabase> DurableFlightTripDatabase::Open(const std::string &snapshot_path,
+                                                                           const std::string &log_path,
+                                                                           WalOptions options) noexcept
+{
+    std::unique_ptr<FlightTripDatabase> database{};
+
+    struct stat status{};
+    if (::stat(snapshot_path.c_str(), &status) == 0)
+    {
+        auto snapshot{FlightTripDatabase::OpenSnapshot(snapshot_path)};
+        if (!snapshot)
+        {
+            return nullptr;
+        }
+
+        database = snapshot->Release();
+    }
+    else
+    {
+        database = std::make_unique<FlightTripDatabase>();
+    }
+
+    WalReplayResult const recovered{WriteAheadLog::Replay(
+        log_path, [&database](const TripMutation &mutation) { database->ApplyMutation(mutation); })};
+
+    auto log{WriteAheadLog::Open(log_path, options, recovered)};
+    if (!log)
+    {
+        return nullptr;
+    }
+
+    return std::unique_ptr<DurableFlightTripDatabase>{new DurableFlightTripDatabase{
+        snapshot_path, std::move(database), std::move(log), recovered.records}};
+}
+
+DurableFlightTripDatabase::DurableFlightTripDatabase(std::string snapshot_path,
+                                                     std::unique_ptr<FlightTripDatabase> database,
+                                                     std::unique_ptr<WriteAheadLog> log,
+                                                     std::size_t recovered_mutations) noexcept
+    : snapshot_path_{std::move(snapshot_path)},
+      database_{std::move(database)},
+      log_{std::move(log)},
+      recovered_mutations_{recovered_mutations}
+{
+}
+
+bool DurableFlightTripDatabase::RemoveTrip(std::string_view flight_number) noexcept
+{
+    return database_->IsTripInDatabase(flight_number) &&
+           log_->Append(MutationKind::kRemoveTrip, TripRecordView{flight_number, {}, {}, {}, 0U}) &&
+           database_->RemoveTrip(flight_number);
+}
+
+bool DurableFlightTripDatabase::UpdateFareByTrip(std::string_view flight_number, std::uint32_t fare) noexcept
+{
+    return database_->IsTripInDatabase(flight_number) &&
+           log_->Append(MutationKind::kUpdateFare, TripRecordView{flight_number, {}, {}, {}, fare}) &&
+           database_->UpdateFareByTrip(flight_number, fare);
+}
+
+bool DurableFlightTripDatabase::Commit() noexcept
+{
+    return log_->Commit();
+}
+
+bool DurableFlightTripDatabase::Checkpoint() noexcept
+{
+    return database_->SaveSnapshot(snapshot_path_) && log_->Reset();
+}
+
+const FlightTripDatabase &DurableFlightTripDatabase::GetDatabase() const noexcept
+{
+    return *database_;
+}
+
+std::size_t DurableFlightTripDatabase::GetRecoveredMutations() const noexcept
+{
+    return recovered_mutations_;
+}
+
+} // namespace flight_management
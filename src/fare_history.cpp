@@ -0,0 +1,298 @@
+#include <algorithm>
+
+#include "fare_history.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+// A head slot with this bit holds the version of the trip's only change, its insertion.
+constexpr std::uint64_t kInlineInsert{std::uint64_t{1U} << 63U};
+
+// Collect once the log has doubled since the last pass, and not for small logs.
+constexpr std::size_t kCollectMinBytes{std::size_t{1U} << 16U};
+constexpr std::size_t kCollectGrowth{2U};
+
+constexpr unsigned kKindBits{2U};
+
+void PutVarint(std::pmr::vector<std::uint8_t> &log, std::uint64_t value) noexcept
+{
+    while (value >= 0x80U)
+    {
+        log.push_back(static_cast<std::uint8_t>(value | 0x80U));
+        value >>= 7U;
+    }
+    log.push_back(static_cast<std::uint8_t>(value));
+}
+
+std::uint64_t GetVarint(const std::pmr::vector<std::uint8_t> &log, std::size_t &offset) noexcept
+{
+    std::uint64_t value{0U};
+
+    for (unsigned shift = 0U;; shift += 7U)
+    {
+        std::uint8_t const byte{log[offset++]};
+        value |= static_cast<std::uint64_t>(byte & 0x7FU) << shift;
+        if ((byte & 0x80U) == 0U)
+        {
+            return value;
+        }
+    }
+}
+
+constexpr std::uint64_t ZigZag(std::int64_t value) noexcept
+{
+    return (static_cast<std::uint64_t>(value) << 1U) ^ static_cast<std::uint64_t>(value >> 63U);
+}
+
+constexpr std::int64_t UnZigZag(std::uint64_t value) noexcept
+{
+    return static_cast<std::int64_t>(value >> 1U) ^ -static_cast<std::int64_t>(value & 1U);
+}
+
+} // namespace
+
+std::uint64_t &FareHistory::HeadOf(TripId trip) noexcept
+{
+    if (trip >= heads_.size())
+    {
+        heads_.resize(trip + 1U, 0U);
+    }
+
+    return heads_[trip];
+}
+
+void FareHistory::RecordInsert(TripId trip) noexcept
+{
+    std::uint64_t &head{HeadOf(trip)};
+    ++version_;
+
+    if (head == 0U)
+    {
+        head = kInlineInsert | version_;
+    }
+    else
+    {
+        Append(trip, Event{version_, EventKind::kInsert, 0U, TripState{}, 0U});
+    }
+
+    MaybeCollect();
+}
+
+void FareHistory::RecordBulkInsert(const std::vector<TripId> &trips) noexcept
+{
+    if (trips.empty())
+    {
+        return;
+    }
+
+    ++version_;
+
+    for (TripId trip : trips)
+    {
+        std::uint64_t &head{HeadOf(trip)};
+
+        if (head == 0U)
+        {
+            head = kInlineInsert | version_;
+        }
+        else
+        {
+            Append(trip, Event{version_, EventKind::kInsert, 0U, TripState{}, 0U});
+        }
+    }
+
+    MaybeCollect();
+}
+
+void FareHistory::RecordFareChange(TripId trip, std::uint32_t old_fare, std::uint32_t new_fare) noexcept
+{
+    if (old_fare == new_fare)
+    {
+        return;
+    }
+
+    ++version_;
+    std::int64_t const delta{static_cast<std::int64_t>(new_fare) - static_cast<std::int64_t>(old_fare)};
+    Append(trip, Event{version_, EventKind::kFareChange, ZigZag(delta), TripState{}, 0U});
+
+    MaybeCollect();
+}
+
+void FareHistory::RecordRemoval(TripId trip, const TripState &removed) noexcept
+{
+    ++version_;
+    Append(trip, Event{version_, EventKind::kRemoval, removed.fare, removed, 0U});
+    displaced_.insert(trip);
+
+    MaybeCollect();
+}
+
+void FareHistory::Append(TripId trip, const Event &event) noexcept
+{
+    std::uint64_t &head{HeadOf(trip)};
+
+    // The inline insertion moves into the log once the trip has a second change.
+    if ((head & kInlineInsert) != 0U)
+    {
+        FareVersion const inserted{head & ~kInlineInsert};
+        head = 0U;
+        Append(trip, Event{inserted, EventKind::kInsert, 0U, TripState{}, 0U});
+    }
+
+    std::size_t const offset{log_.size()};
+
+    PutVarint(log_, (head != 0U) ? offset - (head - 1U) : 0U);
+    PutVarint(log_, event.version - horizon_);
+    PutVarint(log_, (event.payload << kKindBits) | static_cast<std::uint64_t>(event.kind));
+
+    if (event.kind == EventKind::kRemoval)
+    {
+        PutVarint(log_, event.removed.origin);
+        PutVarint(log_, event.removed.destination);
+        PutVarint(log_, event.removed.flight_operator);
+    }
+
+    head = offset + 1U;
+}
+
+FareHistory::Event FareHistory::Decode(std::size_t offset) const noexcept
+{
+    std::size_t const start{offset};
+    std::uint64_t const link{GetVarint(log_, offset)};
+    FareVersion const version{horizon_ + GetVarint(log_, offset)};
+    std::uint64_t const header{GetVarint(log_, offset)};
+
+    Event event{version, static_cast<EventKind>(header & ((1U << kKindBits) - 1U)), header >> kKindBits,
+                TripState{}, (link != 0U) ? start - link + 1U : 0U};
+
+    if (event.kind == EventKind::kRemoval)
+    {
+        event.removed.origin = static_cast<InternId>(GetVarint(log_, offset));
+        event.removed.destination = static_cast<InternId>(GetVarint(log_, offset));
+        event.removed.flight_operator = static_cast<InternId>(GetVarint(log_, offset));
+        event.removed.fare = static_cast<std::uint32_t>(event.payload);
+        event.removed.live = true;
+    }
+
+    return event;
+}
+
+TripState FareHistory::StateAt(TripId trip, const TripState &current, FareVersion version) const noexcept
+{
+    if (version >= version_ || trip >= heads_.size() || heads_[trip] == 0U)
+    {
+        return current;
+    }
+
+    std::uint64_t const head{heads_[trip]};
+    if ((head & kInlineInsert) != 0U)
+    {
+        return ((head & ~kInlineInsert) > version) ? TripState{} : current;
+    }
+
+    TripState state{current};
+
+    // Undo the trip's changes newest first until reaching one already in effect at version.
+    for (std::size_t next = head; next != 0U;)
+    {
+        Event const event{Decode(next - 1U)};
+        if (event.version <= version)
+        {
+            break;
+        }
+
+        switch (event.kind)
+        {
+        case EventKind::kFareChange:
+            state.fare = static_cast<std::uint32_t>(static_cast<std::int64_t>(state.fare) - UnZigZag(event.payload));
+            break;
+        case EventKind::kInsert:
+            state = TripState{};
+            break;
+        case EventKind::kRemoval:
+            state = event.removed;
+            break;
+        }
+
+        next = event.previous;
+    }
+
+    return state;
+}
+
+void FareHistory::MaybeCollect() noexcept
+{
+    if (log_.size() >= kCollectMinBytes && log_.size() >= collected_bytes_ * kCollectGrowth)
+    {
+        Collect();
+    }
+}
+
+std::size_t FareHistory::Collect() noexcept
+{
+    FareVersion const horizon{std::max(horizon_, (version_ > retention_) ? version_ - retention_ : FareVersion{0U})};
+
+    FareHistory kept{log_.get_allocator().resource()};
+    kept.version_ = version_;
+    kept.horizon_ = horizon;
+    kept.retention_ = retention_;
+    kept.heads_.resize(heads_.size(), 0U);
+
+    std::vector<Event> chain{};
+
+    for (TripId trip = 0U; trip < heads_.size(); ++trip)
+    {
+        std::uint64_t const head{heads_[trip]};
+
+        if ((head & kInlineInsert) != 0U)
+        {
+            kept.heads_[trip] = ((head & ~kInlineInsert) > horizon) ? head : 0U;
+            continue;
+        }
+
+        chain.clear();
+        for (std::size_t next = head; next != 0U;)
+        {
+            Event const event{Decode(next - 1U)};
+            if (event.version <= horizon)
+            {
+                break;
+            }
+            chain.push_back(event);
+            next = event.previous;
+        }
+
+        // Rewritten oldest first, so the chain ends up contiguous and its links one event long.
+        for (auto event = chain.crbegin(); event != chain.crend(); ++event)
+        {
+            if (chain.size() == 1U && event->kind == EventKind::kInsert)
+            {
+                kept.heads_[trip] = kInlineInsert | event->version;
+            }
+            else
+            {
+                kept.Append(trip, *event);
+            }
+
+            if (event->kind == EventKind::kRemoval)
+            {
+                kept.displaced_.insert(trip);
+            }
+        }
+    }
+
+    std::size_t const released{log_.size() - std::min(log_.size(), kept.log_.size())};
+
+    log_ = std::move(kept.log_);
+    heads_ = std::move(kept.heads_);
+    displaced_ = std::move(kept.displaced_);
+    horizon_ = horizon;
+    collected_bytes_ = log_.size();
+
+    return released;
+}
+
+} // namespace flight_management
@@ -1,61 +1,699 @@
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <unordered_map>
 
 #include "flight_trip_database.h"
 
 namespace flight_management
 {
 
-    bool FlightTripDatabase::RemoveTrip(const std::string &flight_number) noexcept
+    namespace
     {
-        return flight_database_.erase(flight_number) == 1;
+
+        // Compact once tombstones reach a third of the index and are worth a full pass.
+        constexpr std::size_t kCompactionMinDeadEntries{1024U};
+        constexpr std::size_t kCompactionDeadRatio{2U};
+
+        // Distinct index lookups handed to a pool worker at a time.
+        constexpr std::size_t kBatchGrain{256U};
+
+        // Batch key of a query naming a city or operator the database does not hold.
+        constexpr std::uint64_t kNoBatchKey{std::numeric_limits<std::uint64_t>::max()};
+
+        /**
+         * Recomputes one fare index's per-key minimum and maximum from the
+         * live columns and compares them with what the index holds.
+         */
+        template <typename Index>
+        bool CheckFareIndex(const Index &index, const TripColumns &columns) noexcept
+        {
+            std::unordered_map<typename Index::KeyOf::Type, std::pair<std::uint32_t, std::uint32_t>> extremes{};
+
+            for (TripId trip = 0U; trip < columns.Size(); ++trip)
+            {
+                if (columns.IsLive(trip))
+                {
+                    std::uint32_t const fare{columns.GetAirFare(trip)};
+                    auto const extreme{extremes.emplace(Index::KeyOf::Of(columns, trip), std::make_pair(fare, fare))};
+                    extreme.first->second.first = std::min(extreme.first->second.first, fare);
+                    extreme.first->second.second = std::max(extreme.first->second.second, fare);
+                }
+            }
+
+            bool result{extremes.size() == index.KeyCount()};
+
+            for (auto const &extreme : extremes)
+            {
+                auto const min_fare{index.FindMin(extreme.first)};
+                auto const max_fare{index.FindMax(extreme.first)};
+                result = result && min_fare && min_fare->first == extreme.second.first && max_fare &&
+                         max_fare->first == extreme.second.second;
+            }
+
+            return result;
+        }
+
+    } // namespace
+
+    template <typename Schema>
+    BasicFlightTripDatabase<Schema>::BasicFlightTripDatabase(std::pmr::memory_resource *resource) noexcept
+        : arena_{},
+          stats_{resource},
+          flight_numbers_{stats_.StorageResource(resource)},
+          cities_{stats_.StorageResource(resource)},
+          operators_{stats_.StorageResource(resource)},
+          trip_columns_{stats_.StorageResource(resource)},
+          indexes_{stats_.IndexResource(resource)},
+          aggregates_{}
+    {
+    }
+
+    template <typename Schema>
+    BasicFlightTripDatabase<Schema>::BasicFlightTripDatabase(std::shared_ptr<std::pmr::memory_resource> arena) noexcept
+        : BasicFlightTripDatabase{arena.get()}
+    {
+        arena_ = std::move(arena);
+    }
+
+    template <typename Schema>
+    BasicFlightTripDatabase<Schema>::BasicFlightTripDatabase(const BasicFlightTripDatabase &other) noexcept
+        : BasicFlightTripDatabase{std::pmr::get_default_resource()}
+    {
+        // Assigned rather than copy-constructed so the containers keep the copy's own (counted) resources.
+        flight_numbers_ = other.flight_numbers_;
+        cities_ = other.cities_;
+        operators_ = other.operators_;
+        trip_columns_ = other.trip_columns_;
+        indexes_ = other.indexes_;
+        aggregates_ = other.aggregates_;
+        compactions_ = other.compactions_;
+    }
+
+    template <typename Schema>
+    BasicFlightTripDatabase<Schema> BasicFlightTripDatabase<Schema>::WithMonotonicArena(std::size_t initial_bytes) noexcept
+    {
+        return BasicFlightTripDatabase{std::shared_ptr<std::pmr::memory_resource>{
+            std::make_shared<std::pmr::monotonic_buffer_resource>(initial_bytes)}};
+    }
+
+    template <typename Schema>
+    std::pmr::memory_resource *BasicFlightTripDatabase<Schema>::GetMemoryResource() const noexcept
+    {
+        return StatsHandle::Unwrap(flight_numbers_.GetMemoryResource());
+    }
+
+    template <typename Schema>
+    DatabaseStats BasicFlightTripDatabase<Schema>::GetStats() const noexcept
+    {
+        DatabaseStats stats{};
+        stats.index_entries = GetIndexStatistics();
+        stats_.Collect(stats);
+
+        return stats;
+    }
+
+    template <typename Schema>
+    FareVersion BasicFlightTripDatabase<Schema>::GetFareVersion() const noexcept
+    {
+        if constexpr (Schema::template kHas<FareHistoryIndex>)
+        {
+            return indexes_.template Get<FareHistoryIndex>().GetVersion();
+        }
+
+        return 0U;
+    }
+
+    template <typename Schema>
+    FareVersion BasicFlightTripDatabase<Schema>::GetOldestFareVersion() const noexcept
+    {
+        if constexpr (Schema::template kHas<FareHistoryIndex>)
+        {
+            return indexes_.template Get<FareHistoryIndex>().GetOldestVersion();
+        }
+
+        return 0U;
+    }
+
+    template <typename Schema>
+    void BasicFlightTripDatabase<Schema>::SetFareHistoryRetention(FareVersion versions) noexcept
+    {
+        if constexpr (Schema::template kHas<FareHistoryIndex>)
+        {
+            indexes_.template Get<FareHistoryIndex>().SetRetention(versions);
+        }
+    }
+
+    template <typename Schema>
+    std::size_t BasicFlightTripDatabase<Schema>::CollectFareHistory() noexcept
+    {
+        if constexpr (Schema::template kHas<FareHistoryIndex>)
+        {
+            return indexes_.template Get<FareHistoryIndex>().Collect();
+        }
+
+        return 0U;
+    }
+
+    template <typename Schema>
+    void BasicFlightTripDatabase<Schema>::SetMutationStream(MutationStream *stream) noexcept
+    {
+        mutation_stream_ = stream;
     }
 
-    bool FlightTripDatabase::IsTripInDatabase(const std::string &flight_number) const noexcept
+    template <typename Schema>
+    bool BasicFlightTripDatabase<Schema>::InsertTrip(std::string_view flight_number, std::string_view origin_city,
+                                                     std::string_view destination_city,
+                                                     std::string_view flight_operator, std::uint32_t fare) noexcept
     {
-        return flight_database_.count(flight_number) == 1;
+        OperationScope scope{stats_, StatsOperation::kAddTrip};
+        scope.AddProbes(1U);
+
+        TripId const trip{flight_numbers_.Intern(flight_number)};
+
+        if (trip_columns_.IsLive(trip))
+        {
+            return false;
+        }
+
+        scope.AddProbes(3U + Schema::kIndexCount);
+        scope.AddRows(1U);
+
+        trip_columns_.Assign(trip, cities_.Intern(origin_city), cities_.Intern(destination_city),
+                             operators_.Intern(flight_operator), fare);
+        aggregates_.OnAdd(fare);
+
+        // A posting that is already present is the trip's own tombstone, revived by the insert.
+        indexes_.ForEach([this, trip](auto &index) { index.OnInsert(trip_columns_, trip); });
+        RefreshRouteGraph();
+
+        if (mutation_stream_ != nullptr)
+        {
+            mutation_stream_->Publish(MutationKind::kAddTrip, flight_number, origin_city, destination_city,
+                                      flight_operator, fare);
+        }
+
+        return true;
+    }
+
+    template <typename Schema>
+    std::size_t BasicFlightTripDatabase<Schema>::BulkLoad(const std::vector<TripRecordView> &records) noexcept
+    {
+        OperationScope scope{stats_, StatsOperation::kBulkLoad};
+        std::vector<TripId> loaded{};
+        std::uint64_t fare_sum{0U};
+
+        loaded.reserve(records.size());
+        trip_columns_.Reserve(trip_columns_.Size() + records.size());
+
+        for (auto const &record : records)
+        {
+            TripId const trip{flight_numbers_.Intern(record.flight_number)};
+
+            if (trip_columns_.IsLive(trip))
+            {
+                continue;
+            }
+
+            trip_columns_.Assign(trip, cities_.Intern(record.origin_city), cities_.Intern(record.destination_city),
+                                 operators_.Intern(record.flight_operator), record.fare);
+            loaded.push_back(trip);
+            fare_sum += record.fare;
+
+            if (mutation_stream_ != nullptr)
+            {
+                mutation_stream_->Publish(MutationKind::kAddTrip, record.flight_number, record.origin_city,
+                                          record.destination_city, record.flight_operator, record.fare);
+            }
+        }
+
+        indexes_.ForEach([this, &loaded](auto &index) { index.OnBulkInsert(trip_columns_, loaded); });
+        aggregates_.OnBulkAdd(loaded.size(), fare_sum);
+        RefreshRouteGraph();
+        scope.AddProbes(records.size() + loaded.size() * 3U);
+        scope.AddRows(loaded.size());
+
+        return loaded.size();
     }
 
-    bool FlightTripDatabase::UpdateFareByTrip(const std::string &flightNumber, std::uint32_t fare) noexcept
+    template <typename Schema>
+    TripId BasicFlightTripDatabase<Schema>::FindLiveTrip(std::string_view flight_number) const noexcept
     {
+        TripId const trip{flight_numbers_.Find(flight_number)};
+
+        return trip_columns_.IsLive(trip) ? trip : kInvalidInternId;
+    }
+
+    template <typename Schema>
+    std::optional<FareEntry> BasicFlightTripDatabase<Schema>::FindCheapestTrip(
+        std::string_view origin_city, std::string_view destination_city) const noexcept
+    {
+        InternId const origin_id{cities_.Find(origin_city)};
+        InternId const destination_id{cities_.Find(destination_city)};
+        if (origin_id == kInvalidInternId || destination_id == kInvalidInternId)
+        {
+            return std::nullopt;
+        }
+
+        return indexes_.template Get<RouteFares>().FindMin(MakeRouteKey(origin_id, destination_id));
+    }
+
+    template <typename Schema>
+    FlightData BasicFlightTripDatabase<Schema>::MakeFlightData(TripId trip) const noexcept
+    {
+        return FlightData{flight_numbers_.Get(trip),
+                          cities_.Get(trip_columns_.GetOrigin(trip)),
+                          cities_.Get(trip_columns_.GetDestination(trip)),
+                          operators_.Get(trip_columns_.GetOperator(trip)),
+                          trip_columns_.GetAirFare(trip)};
+    }
+
+    template <typename Schema>
+    FlightData BasicFlightTripDatabase<Schema>::MakeFlightData(TripId trip, const TripState &state) const noexcept
+    {
+        return FlightData{flight_numbers_.Get(trip), cities_.Get(state.origin), cities_.Get(state.destination),
+                          operators_.Get(state.flight_operator), state.fare};
+    }
+
+    template <typename Schema>
+    Itinerary BasicFlightTripDatabase<Schema>::MakeItinerary(const RoutePath &path) const noexcept
+    {
+        Itinerary itinerary{path.fare, {}};
+        itinerary.legs.reserve(path.legs.size());
+
+        for (TripId trip : path.legs)
+        {
+            itinerary.legs.push_back(MakeFlightData(trip));
+        }
+
+        return itinerary;
+    }
+
+    template <typename Schema>
+    bool BasicFlightTripDatabase<Schema>::RemoveTrip(std::string_view flight_number) noexcept
+    {
+        OperationScope scope{stats_, StatsOperation::kRemoveTrip};
+        scope.AddProbes(1U);
+
+        TripId const trip{FindLiveTrip(flight_number)};
+
+        if (trip == kInvalidInternId)
+        {
+            return false;
+        }
+
+        scope.AddProbes(Schema::kIndexCount);
+        scope.AddRows(1U);
+
+        // Postings keep the trip as a tombstone until the next compaction.
+        indexes_.ForEach([this, trip](auto &index) { index.OnErase(trip_columns_, trip); });
+        aggregates_.OnRemove(trip_columns_.GetAirFare(trip));
+        trip_columns_.Erase(trip);
+        RefreshRouteGraph();
+
+        if (mutation_stream_ != nullptr)
+        {
+            mutation_stream_->Publish(MutationKind::kRemoveTrip, flight_number, {}, {}, {}, 0U);
+        }
+
+        IndexStatistics const statistics{GetIndexStatistics()};
+        if (statistics.dead_entries >= kCompactionMinDeadEntries &&
+            statistics.dead_entries * kCompactionDeadRatio >= statistics.live_entries)
+        {
+            CompactIndexes();
+        }
+
+        return true;
+    }
+
+    template <typename Schema>
+    bool BasicFlightTripDatabase<Schema>::IsTripInDatabase(std::string_view flight_number) const noexcept
+    {
+        return FindLiveTrip(flight_number) != kInvalidInternId;
+    }
+
+    template <typename Schema>
+    bool BasicFlightTripDatabase<Schema>::UpdateFareByTrip(std::string_view flight_number, std::uint32_t fare) noexcept
+    {
+        OperationScope scope{stats_, StatsOperation::kUpdateFare};
         bool result{false};
 
-        if (IsTripInDatabase(flightNumber))
+        TripId const trip{FindLiveTrip(flight_number)};
+        scope.AddProbes(1U);
+
+        if (trip != kInvalidInternId)
         {
-            flight_database_[flightNumber].SetAirFare(fare);
+            ChangeFare(trip, fare);
+            scope.AddProbes(Schema::kIndexCount);
+            scope.AddRows(1U);
             result = true;
         }
 
         return result;
     }
 
-    void FlightTripDatabase::DisplayAllTrips() const noexcept
+    template <typename Schema>
+    void BasicFlightTripDatabase<Schema>::ChangeFare(TripId trip, std::uint32_t fare) noexcept
+    {
+        indexes_.ForEach([this, trip, fare](auto &index) { index.OnFareChange(trip_columns_, trip, fare); });
+        aggregates_.OnFareUpdate(trip_columns_.GetAirFare(trip), fare);
+        trip_columns_.SetAirFare(trip, fare);
+        RefreshRouteGraph();
+
+        if (mutation_stream_ != nullptr)
+        {
+            mutation_stream_->Publish(MutationKind::kUpdateFare, flight_numbers_.Get(trip), {}, {}, {}, fare);
+        }
+    }
+
+    template <typename Schema>
+    void BasicFlightTripDatabase<Schema>::RefreshRouteGraph() noexcept
+    {
+        if constexpr (Schema::template kHas<RouteGraphIndex>)
+        {
+            auto const &route_fares{indexes_.template Get<RouteFares>()};
+            indexes_.template Get<RouteGraphIndex>().Refresh(
+                [&route_fares](RouteKey route) { return route_fares.FindMin(route); });
+        }
+    }
+
+    template <typename Schema>
+    std::size_t BasicFlightTripDatabase<Schema>::UpdateFaresByOperators(
+        const std::vector<std::pair<std::string, FarePercentage>> &adjustments) noexcept
     {
+        OperationScope scope{stats_, StatsOperation::kUpdateFaresByOperator};
+        scope.AddProbes(adjustments.size());
+
+        // Dense operator ids turn the per-row adjustment lookup into an array index.
+        std::vector<std::int32_t> percentage_by_operator(operators_.Size(), 0);
+
+        for (auto const &adjustment : adjustments)
+        {
+            InternId const operator_id{operators_.Find(adjustment.first)};
+            if (operator_id != kInvalidInternId)
+            {
+                percentage_by_operator[operator_id] = adjustment.second.percentage;
+            }
+        }
+
+        auto const &fares{trip_columns_.GetFareColumn()};
+        auto const &operator_ids{trip_columns_.GetOperatorColumn()};
+        auto const &live{trip_columns_.GetLiveColumn()};
+
+        std::vector<std::uint32_t> adjusted_fares(fares.size());
+
+        for (std::size_t trip = 0U; trip < fares.size(); ++trip)
+        {
+            std::int32_t const percentage{live[trip] != 0U ? percentage_by_operator[operator_ids[trip]] : 0};
+            adjusted_fares[trip] = FarePercentage{percentage}(fares[trip]);
+        }
+
+        std::size_t updated{0U};
+
+        for (TripId trip = 0U; trip < adjusted_fares.size(); ++trip)
+        {
+            if (adjusted_fares[trip] != fares[trip])
+            {
+                ChangeFare(trip, adjusted_fares[trip]);
+                ++updated;
+            }
+        }
+        scope.AddRows(updated);
+
+        return updated;
+    }
+
+    template <typename Schema>
+    std::vector<std::uint32_t> BasicFlightTripDatabase<Schema>::ExecuteBatch(const QueryBatch &batch) const noexcept
+    {
+        return RunBatch(batch, nullptr);
+    }
+
+    template <typename Schema>
+    std::vector<std::uint32_t> BasicFlightTripDatabase<Schema>::ExecuteBatch(const QueryBatch &batch,
+                                                                            WorkStealingThreadPool &pool) const noexcept
+    {
+        return RunBatch(batch, &pool);
+    }
+
+    template <typename Schema>
+    std::vector<std::uint32_t> BasicFlightTripDatabase<Schema>::RunBatch(const QueryBatch &batch,
+                                                                        WorkStealingThreadPool *pool) const noexcept
+    {
+        OperationScope scope{stats_, StatsOperation::kExecuteBatch};
+        auto run = [pool](std::size_t count, const std::function<void(std::size_t, std::size_t)> &body) {
+            if (pool != nullptr)
+            {
+                pool->ParallelFor(count, kBatchGrain, body);
+            }
+            else
+            {
+                body(0U, count);
+            }
+        };
+
+        auto const &queries{batch.GetDistinctQueries()};
+        std::vector<std::uint64_t> keys(queries.size());
+
+        // Names to index keys; a name the database has never seen needs no lookup.
+        run(queries.size(), [this, &queries, &keys](std::size_t begin, std::size_t end) {
+            for (std::size_t query = begin; query < end; ++query)
+            {
+                auto const &fare_query{queries[query]};
+
+                if (fare_query.kind == QueryKind::kMinFareBetweenCities)
+                {
+                    InternId const origin_id{cities_.Find(fare_query.first)};
+                    InternId const destination_id{cities_.Find(fare_query.second)};
+                    bool const known{origin_id != kInvalidInternId && destination_id != kInvalidInternId};
+                    keys[query] = known ? MakeRouteKey(origin_id, destination_id) : kNoBatchKey;
+                }
+                else
+                {
+                    InternId const operator_id{operators_.Find(fare_query.first)};
+                    keys[query] = (operator_id != kInvalidInternId) ? operator_id : kNoBatchKey;
+                }
+            }
+        });
+
+        // Looked up in key order, so neighbouring lookups share buckets and cache lines.
+        std::vector<std::size_t> order(queries.size());
+        std::iota(order.begin(), order.end(), 0U);
+        std::sort(order.begin(), order.end(), [&queries, &keys](std::size_t lhs, std::size_t rhs) {
+            return std::tie(queries[lhs].kind, keys[lhs]) < std::tie(queries[rhs].kind, keys[rhs]);
+        });
+
+        std::vector<std::uint32_t> answers(queries.size());
+        run(order.size(), [this, &order, &queries, &keys, &answers](std::size_t begin, std::size_t end) {
+            for (std::size_t index = begin; index < end; ++index)
+            {
+                std::size_t const query{order[index]};
+                answers[query] = AnswerFareQuery(queries[query].kind, keys[query]);
+            }
+        });
+
+        std::vector<std::uint32_t> results{};
+        results.reserve(batch.Size());
+
+        for (std::size_t slot : batch.GetSlots())
+        {
+            results.push_back(answers[slot]);
+        }
+        scope.AddProbes(queries.size() * 2U);
+        scope.AddRows(results.size());
+
+        return results;
+    }
+
+    template <typename Schema>
+    std::uint32_t BasicFlightTripDatabase<Schema>::AnswerFareQuery(QueryKind kind, std::uint64_t key) const noexcept
+    {
+        if (kind == QueryKind::kMinFareBetweenCities)
+        {
+            if constexpr (Schema::template kHas<RouteFares>)
+            {
+                auto const min_fare{(key != kNoBatchKey) ? indexes_.template Get<RouteFares>().FindMin(key)
+                                                         : std::nullopt};
+                if (min_fare)
+                {
+                    return min_fare->first;
+                }
+            }
+
+            return UINT_MAX;
+        }
+
+        if constexpr (Schema::template kHas<OperatorFares>)
+        {
+            auto const max_fare{(key != kNoBatchKey)
+                                    ? indexes_.template Get<OperatorFares>().FindMax(static_cast<InternId>(key))
+                                    : std::nullopt};
+            if (max_fare)
+            {
+                return max_fare->first;
+            }
+        }
+
+        return 0U;
+    }
+
+    template <typename Schema>
+    void BasicFlightTripDatabase<Schema>::DisplayAllTrips(TripOrder order) const noexcept
+    {
+        std::vector<TripId> trips{};
+        trips.reserve(aggregates_.GetTripCount());
+
+        for (TripId trip = 0U; trip < trip_columns_.Size(); ++trip)
+        {
+            if (trip_columns_.IsLive(trip))
+            {
+                trips.push_back(trip);
+            }
+        }
+
+        if (order == TripOrder::kByFlightNumber)
+        {
+            std::sort(trips.begin(), trips.end(), [this](TripId lhs, TripId rhs) {
+                return flight_numbers_.Get(lhs) < flight_numbers_.Get(rhs);
+            });
+        }
+
         std::cout << "Flight Details: "
                   << "\n";
 
-        for (auto const &flight_detail : flight_database_)
+        for (TripId trip : trips)
         {
-            std::cout << "Flight Number: " << flight_detail.first << " " << flight_detail.second << std::endl;
+            std::cout << "Flight Number: " << flight_numbers_.Get(trip) << " " << MakeFlightData(trip) << std::endl;
         }
         std::cout << "\n";
     }
 
-    std::uint32_t FlightTripDatabase::FindAverageCostOfAllTrips() const noexcept
+    template <typename Schema>
+    std::uint32_t BasicFlightTripDatabase<Schema>::FindAverageCostOfAllTrips() const noexcept
+    {
+        return aggregates_.GetAverageFare();
+    }
+
+    template <typename Schema>
+    std::uint64_t BasicFlightTripDatabase<Schema>::GetTotalFare() const noexcept
+    {
+        return aggregates_.GetFareSum();
+    }
+
+    template <typename Schema>
+    std::size_t BasicFlightTripDatabase<Schema>::GetTripCount() const noexcept
+    {
+        return aggregates_.GetTripCount();
+    }
+
+    template <typename Schema>
+    bool BasicFlightTripDatabase<Schema>::CheckAggregateConsistency() const noexcept
     {
-        std::uint32_t average_cost{0U};
+        std::uint64_t fare_sum{0U};
+        std::size_t trip_count{0U};
+
+        for (TripId trip = 0U; trip < trip_columns_.Size(); ++trip)
+        {
+            if (trip_columns_.IsLive(trip))
+            {
+                fare_sum += trip_columns_.GetAirFare(trip);
+                ++trip_count;
+            }
+        }
+
+        bool result{fare_sum == aggregates_.GetFareSum() && trip_count == aggregates_.GetTripCount()};
+
+        indexes_.ForEach([this, &result](auto const &index) {
+            if constexpr (std::decay_t<decltype(index)>::kKind == IndexKind::kFareOrdered)
+            {
+                result = result && CheckFareIndex(index, trip_columns_);
+            }
+            else if constexpr (std::decay_t<decltype(index)>::kKind == IndexKind::kRouteGraph)
+            {
+                result = result && index.GetEdgeCount() == indexes_.template Get<RouteFares>().KeyCount();
+            }
+        });
 
-        for (auto const &flight_detail : flight_database_)
+        return result;
+    }
+
+    template <typename Schema>
+    bool BasicFlightTripDatabase<Schema>::ApplyMutation(const TripMutation &mutation) noexcept
+    {
+        switch (mutation.kind)
         {
-            average_cost += flight_detail.second.GetAirFare();
+        case MutationKind::kAddTrip:
+            return InsertTrip(mutation.flight_number, mutation.origin_city, mutation.destination_city,
+                              mutation.flight_operator, mutation.fare);
+        case MutationKind::kRemoveTrip:
+            return RemoveTrip(mutation.flight_number);
+        case MutationKind::kUpdateFare:
+            return UpdateFareByTrip(mutation.flight_number, mutation.fare);
         }
 
-        return average_cost / flight_database_.size();
+        return false;
     }
 
-    std::optional<FlightData> FlightTripDatabase::FindFlightsByNumber(const std::string &flight_number) const noexcept
+    template <typename Schema>
+    std::optional<typename BasicFlightTripDatabase<Schema>::TripView> BasicFlightTripDatabase<Schema>::ViewFlightByNumber(
+        std::string_view flight_number) const noexcept
     {
-        auto flight_data_iterator = flight_database_.find(flight_number);
-        return (flight_data_iterator != flight_database_.cend()) ? std::make_optional(flight_data_iterator->second) : std::nullopt;
+        OperationScope scope{stats_, StatsOperation::kFindByNumber};
+        TripId const trip{FindLiveTrip(flight_number)};
+        scope.AddProbes(1U);
+        scope.AddRows((trip != kInvalidInternId) ? 1U : 0U);
+
+        return (trip != kInvalidInternId) ? std::make_optional(TripView{*this, trip}) : std::nullopt;
     }
 
+    template <typename Schema>
+    IndexStatistics BasicFlightTripDatabase<Schema>::GetIndexStatistics() const noexcept
+    {
+        IndexStatistics statistics{};
+
+        indexes_.ForEach([&statistics](auto const &index) {
+            if constexpr (std::decay_t<decltype(index)>::kKind == IndexKind::kSortedPostings)
+            {
+                statistics.dead_entries += index.GetDeadEntryCount();
+                statistics.live_entries += index.GetEntryCount() - index.GetDeadEntryCount();
+            }
+        });
+        statistics.compactions = compactions_;
+
+        return statistics;
+    }
+
+    template <typename Schema>
+    std::size_t BasicFlightTripDatabase<Schema>::CompactIndexes() noexcept
+    {
+        std::size_t removed{0U};
+
+        indexes_.ForEach([this, &removed](auto &index) {
+            if constexpr (std::decay_t<decltype(index)>::kKind == IndexKind::kSortedPostings)
+            {
+                removed += index.Compact(
+                    [this, &index](InternId key, TripId trip) { return index.IsCurrent(trip_columns_, key, trip); });
+            }
+        });
+        ++compactions_;
+
+        return removed;
+    }
+
+    template <typename Schema>
+    std::optional<FlightData> BasicFlightTripDatabase<Schema>::FindFlightsByNumber(std::string_view flight_number) const noexcept
+    {
+        OperationScope scope{stats_, StatsOperation::kFindByNumber};
+        TripId const trip{FindLiveTrip(flight_number)};
+        scope.AddProbes(1U);
+        scope.AddRows((trip != kInvalidInternId) ? 1U : 0U);
+
+        return (trip != kInvalidInternId) ? std::make_optional(MakeFlightData(trip)) : std::nullopt;
+    }
+
+    template class BasicFlightTripDatabase<FullTripSchema>;
+    template class BasicFlightTripDatabase<MinimalTripSchema>;
+
 } // namespace flight_management
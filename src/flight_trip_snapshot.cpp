@@ -0,0 +1,235 @@
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+#include <tuple>
+
+#include "flight_trip_database.h"
+#include "mapped_flight_trip_database.h"
+#include "snapshot_format.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+/**
+ * Lays sections out back to back behind the header, each padded to the
+ * snapshot alignment, and writes the result through a rename.
+ */
+class SnapshotBuilder
+{
+public:
+    template <typename Values>
+    void AddSection(SnapshotSection section, const Values &values) noexcept
+    {
+        using Type = typename Values::value_type;
+
+        std::size_t const size{values.size() * sizeof(Type)};
+
+        header_.sections[section] = SnapshotSectionEntry{sizeof(SnapshotHeader) + payload_.size(), size};
+        payload_.resize(payload_.size() + (size + kSnapshotAlignment - 1U) / kSnapshotAlignment * kSnapshotAlignment);
+
+        if (size != 0U)
+        {
+            std::memcpy(payload_.data() + header_.sections[section].offset - sizeof(SnapshotHeader), values.data(),
+                        size);
+        }
+    }
+
+    void AddStringTable(SnapshotSection offsets_section, SnapshotSection blob_section, SnapshotSection order_section,
+                        const StringInterner &strings) noexcept
+    {
+        std::vector<std::uint32_t> offsets{0U};
+        std::vector<char> blob{};
+
+        for (InternId id = 0U; id < strings.Size(); ++id)
+        {
+            std::string_view const value{strings.Get(id)};
+            blob.insert(blob.end(), value.cbegin(), value.cend());
+            offsets.push_back(static_cast<std::uint32_t>(blob.size()));
+        }
+
+        std::vector<InternId> order(strings.Size());
+        std::iota(order.begin(), order.end(), 0U);
+        std::sort(order.begin(), order.end(),
+                  [&strings](InternId lhs, InternId rhs) { return strings.Get(lhs) < strings.Get(rhs); });
+
+        AddSection(offsets_section, offsets);
+        AddSection(blob_section, blob);
+        AddSection(order_section, order);
+    }
+
+    bool Write(const std::string &path, std::uint64_t trip_count, std::uint64_t fare_sum) noexcept
+    {
+        std::memcpy(header_.magic, kSnapshotMagic, sizeof(kSnapshotMagic));
+        header_.version = kSnapshotVersion;
+        header_.byte_order = kSnapshotByteOrder;
+        header_.file_size = sizeof(SnapshotHeader) + payload_.size();
+        header_.trip_count = trip_count;
+        header_.fare_sum = fare_sum;
+        header_.checksum = SnapshotChecksum(header_, reinterpret_cast<const std::uint64_t *>(payload_.data()),
+                                            payload_.size() / sizeof(std::uint64_t));
+
+        std::string const temporary_path{path + ".tmp"};
+        int const descriptor{::open(temporary_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644)};
+        if (descriptor < 0)
+        {
+            return false;
+        }
+
+        bool result{WriteAll(descriptor, reinterpret_cast<const char *>(&header_), sizeof(header_)) &&
+                    WriteAll(descriptor, reinterpret_cast<const char *>(payload_.data()), payload_.size()) &&
+                    ::fsync(descriptor) == 0};
+
+        result = (::close(descriptor) == 0) && result;
+        result = result && std::rename(temporary_path.c_str(), path.c_str()) == 0;
+
+        if (!result)
+        {
+            std::remove(temporary_path.c_str());
+        }
+
+        return result;
+    }
+
+private:
+    static bool WriteAll(int descriptor, const char *data, std::size_t size) noexcept
+    {
+        while (size != 0U)
+        {
+            ssize_t const written{::write(descriptor, data, size)};
+            if (written <= 0)
+            {
+                return false;
+            }
+
+            data += written;
+            size -= static_cast<std::size_t>(written);
+        }
+
+        return true;
+    }
+
+    static_assert(sizeof(SnapshotHeader) % kSnapshotAlignment == 0U, "sections must start aligned");
+
+    SnapshotHeader header_{};
+    std::vector<unsigned char> payload_{};
+};
+
+/**
+ * CSR layout of trip ids grouped by key: offsets has key_count + 1 entries.
+ */
+void BuildPostings(const std::vector<std::pair<InternId, TripId>> &sorted_entries, std::size_t key_count,
+                   std::vector<std::uint32_t> &offsets, std::vector<TripId> &trips) noexcept
+{
+    offsets.assign(key_count + 1U, 0U);
+    trips.clear();
+    trips.reserve(sorted_entries.size());
+
+    for (auto const &entry : sorted_entries)
+    {
+        ++offsets[entry.first + 1U];
+        trips.push_back(entry.second);
+    }
+
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+}
+
+} // namespace
+
+template <typename Schema>
+bool BasicFlightTripDatabase<Schema>::SaveSnapshot(const std::string &path) const noexcept
+{
+    SnapshotBuilder builder{};
+
+    builder.AddStringTable(kFlightNumberOffsets, kFlightNumberBlob, kFlightNumberOrder, flight_numbers_);
+    builder.AddStringTable(kCityOffsets, kCityBlob, kCityOrder, cities_);
+    builder.AddStringTable(kOperatorOffsets, kOperatorBlob, kOperatorOrder, operators_);
+
+    // Rows exist for every interned flight number, even one never stored.
+    std::size_t const row_count{flight_numbers_.Size()};
+    auto column = [row_count](auto values, auto fill) {
+        values.resize(row_count, fill);
+        return values;
+    };
+
+    builder.AddSection(kOriginColumn, column(trip_columns_.GetOriginColumn(), kInvalidInternId));
+    builder.AddSection(kDestinationColumn, column(trip_columns_.GetDestinationColumn(), kInvalidInternId));
+    builder.AddSection(kOperatorColumn, column(trip_columns_.GetOperatorColumn(), kInvalidInternId));
+    builder.AddSection(kFareColumn, column(trip_columns_.GetFareColumn(), 0U));
+    builder.AddSection(kLiveColumn, column(trip_columns_.GetLiveColumn(), std::uint8_t{0U}));
+
+    std::vector<std::pair<InternId, TripId>> origin_entries{};
+    std::vector<std::tuple<RouteKey, std::uint32_t, TripId>> route_entries{};
+    std::vector<std::pair<InternId, FareEntry>> operator_entries{};
+
+    for (TripId trip = 0U; trip < trip_columns_.Size(); ++trip)
+    {
+        if (trip_columns_.IsLive(trip))
+        {
+            origin_entries.emplace_back(trip_columns_.GetOrigin(trip), trip);
+            route_entries.emplace_back(RouteKeyOf::Of(trip_columns_, trip), trip_columns_.GetAirFare(trip), trip);
+            operator_entries.emplace_back(trip_columns_.GetOperator(trip), FareEntry{trip_columns_.GetAirFare(trip), trip});
+        }
+    }
+
+    std::vector<std::uint32_t> offsets{};
+    std::vector<TripId> trips{};
+
+    std::sort(origin_entries.begin(), origin_entries.end());
+    BuildPostings(origin_entries, cities_.Size(), offsets, trips);
+    builder.AddSection(kOriginPostingOffsets, offsets);
+    builder.AddSection(kOriginPostings, trips);
+
+    std::sort(operator_entries.begin(), operator_entries.end());
+    std::vector<std::pair<InternId, TripId>> operator_postings{};
+    operator_postings.reserve(operator_entries.size());
+    for (auto const &entry : operator_entries)
+    {
+        operator_postings.emplace_back(entry.first, entry.second.second);
+    }
+    BuildPostings(operator_postings, operators_.Size(), offsets, trips);
+    builder.AddSection(kOperatorFareOffsets, offsets);
+    builder.AddSection(kOperatorFareTrips, trips);
+
+    std::sort(route_entries.begin(), route_entries.end());
+    std::vector<RouteKey> route_keys{};
+    offsets.clear();
+    trips.clear();
+    for (auto const &entry : route_entries)
+    {
+        if (route_keys.empty() || route_keys.back() != std::get<0>(entry))
+        {
+            route_keys.push_back(std::get<0>(entry));
+            offsets.push_back(static_cast<std::uint32_t>(trips.size()));
+        }
+        trips.push_back(std::get<2>(entry));
+    }
+    offsets.push_back(static_cast<std::uint32_t>(trips.size()));
+    builder.AddSection(kRouteKeys, route_keys);
+    builder.AddSection(kRouteOffsets, offsets);
+    builder.AddSection(kRouteTrips, trips);
+
+    return builder.Write(path, aggregates_.GetTripCount(), aggregates_.GetFareSum());
+}
+
+template <typename Schema>
+std::unique_ptr<MappedFlightTripDatabase> BasicFlightTripDatabase<Schema>::OpenSnapshot(const std::string &path) noexcept
+{
+    return MappedFlightTripDatabase::Open(path);
+}
+
+// The class itself is instantiated with the rest of its members in flight_trip_database.cpp.
+template bool BasicFlightTripDatabase<FullTripSchema>::SaveSnapshot(const std::string &path) const noexcept;
+template bool BasicFlightTripDatabase<MinimalTripSchema>::SaveSnapshot(const std::string &path) const noexcept;
+template std::unique_ptr<MappedFlightTripDatabase> BasicFlightTripDatabase<FullTripSchema>::OpenSnapshot(
+    const std::string &path) noexcept;
+template std::unique_ptr<MappedFlightTripDatabase> BasicFlightTripDatabase<MinimalTripSchema>::OpenSnapshot(
+    const std::string &path) noexcept;
+
+} // namespace flight_management
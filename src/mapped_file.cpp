@@ -0,0 +1,126 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <utility>
+
+#include "mapped_file.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+int ToAdvice(AccessPattern access) noexcept
+{
+    switch (access)
+    {
+    case AccessPattern::kSequential:
+        return MADV_SEQUENTIAL;
+    case AccessPattern::kRandom:
+        return MADV_RANDOM;
+    case AccessPattern::kNormal:
+        break;
+    }
+
+    return MADV_NORMAL;
+}
+
+} // namespace
+
+MappedFile::MappedFile(const std::string &path, AccessPattern access) noexcept
+{
+    int const descriptor{::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+    if (descriptor < 0)
+    {
+        return;
+    }
+
+    struct stat status
+    {
+    };
+
+    if (::fstat(descriptor, &status) == 0)
+    {
+        size_ = static_cast<std::size_t>(status.st_size);
+
+        if (size_ == 0U)
+        {
+            open_ = true;
+        }
+        else
+        {
+            void *const mapping{::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, descriptor, 0)};
+
+            if (mapping != MAP_FAILED)
+            {
+                data_ = mapping;
+                open_ = true;
+                ::madvise(data_, size_, ToAdvice(access));
+            }
+        }
+    }
+
+    ::close(descriptor);
+}
+
+MappedFile::~MappedFile() noexcept
+{
+    Unmap();
+}
+
+MappedFile::MappedFile(MappedFile &&other) noexcept
+    : data_{std::exchange(other.data_, nullptr)},
+      size_{std::exchange(other.size_, 0U)},
+      open_{std::exchange(other.open_, false)}
+{
+}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+{
+    if (this != &other)
+    {
+        Unmap();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0U);
+        open_ = std::exchange(other.open_, false);
+    }
+
+    return *this;
+}
+
+bool MappedFile::IsOpen() const noexcept
+{
+    return open_;
+}
+
+const char *MappedFile::Data() const noexcept
+{
+    return static_cast<const char *>(data_);
+}
+
+std::size_t MappedFile::Size() const noexcept
+{
+    return (data_ != nullptr) ? size_ : 0U;
+}
+
+std::string_view MappedFile::Contents() const noexcept
+{
+    return std::string_view{Data(), Size()};
+}
+
+void MappedFile::Unmap() noexcept
+{
+    if (data_ != nullptr)
+    {
+        ::munmap(data_, size_);
+        data_ = nullptr;
+    }
+
+    size_ = 0U;
+    open_ = false;
+}
+
+} // namespace flight_management
@@ -0,0 +1,308 @@
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+#include "mapped_flight_trip_database.h"
+#include "trip_record.h"
+
+namespace flight_management
+{
+
+std::unique_ptr<MappedFlightTripDatabase> MappedFlightTripDatabase::Open(const std::string &path,
+                                                                        bool verify_checksum) noexcept
+{
+    // Scanned once by the checksum, then probed at random by lookups: no sequential advice.
+    MappedFile file{path, AccessPattern::kNormal};
+
+    if (!file.IsOpen() || file.Size() < sizeof(SnapshotHeader))
+    {
+        return nullptr;
+    }
+
+    auto const *header{reinterpret_cast<const SnapshotHeader *>(file.Data())};
+
+    if (std::memcmp(header->magic, kSnapshotMagic, sizeof(kSnapshotMagic)) != 0 ||
+        header->version != kSnapshotVersion || header->byte_order != kSnapshotByteOrder ||
+        header->file_size != file.Size() || (file.Size() - sizeof(SnapshotHeader)) % kSnapshotAlignment != 0U)
+    {
+        return nullptr;
+    }
+
+    for (auto const &section : header->sections)
+    {
+        if (section.offset % kSnapshotAlignment != 0U || section.offset < sizeof(SnapshotHeader) ||
+            section.offset > file.Size() || section.size > file.Size() - section.offset)
+        {
+            return nullptr;
+        }
+    }
+
+    if (verify_checksum &&
+        header->checksum != SnapshotChecksum(*header,
+                                             reinterpret_cast<const std::uint64_t *>(file.Data() + sizeof(SnapshotHeader)),
+                                             (file.Size() - sizeof(SnapshotHeader)) / sizeof(std::uint64_t)))
+    {
+        return nullptr;
+    }
+
+    std::unique_ptr<MappedFlightTripDatabase> database{new MappedFlightTripDatabase{std::move(file)}};
+
+    std::size_t const rows{database->SectionLength(kFareColumn, sizeof(std::uint32_t))};
+    std::size_t const cities{database->SectionLength(kCityOrder, sizeof(InternId))};
+    std::size_t const operators{database->SectionLength(kOperatorOrder, sizeof(InternId))};
+    std::size_t const routes{database->SectionLength(kRouteKeys, sizeof(RouteKey))};
+
+    bool const consistent{
+        database->SectionLength(kFlightNumberOrder, sizeof(InternId)) == rows &&
+        database->SectionLength(kFlightNumberOffsets, sizeof(std::uint32_t)) == rows + 1U &&
+        database->SectionLength(kCityOffsets, sizeof(std::uint32_t)) == cities + 1U &&
+        database->SectionLength(kOperatorOffsets, sizeof(std::uint32_t)) == operators + 1U &&
+        database->SectionLength(kOriginColumn, sizeof(InternId)) == rows &&
+        database->SectionLength(kDestinationColumn, sizeof(InternId)) == rows &&
+        database->SectionLength(kOperatorColumn, sizeof(InternId)) == rows &&
+        database->SectionLength(kLiveColumn, sizeof(std::uint8_t)) == rows &&
+        database->SectionLength(kOriginPostingOffsets, sizeof(std::uint32_t)) == cities + 1U &&
+        database->SectionLength(kOperatorFareOffsets, sizeof(std::uint32_t)) == operators + 1U &&
+        database->SectionLength(kRouteOffsets, sizeof(std::uint32_t)) == routes + 1U};
+
+    // Every CSR offsets array must never decrease and must end inside the section it indexes.
+    auto const offsets_fit{[&database](SnapshotSection offsets, SnapshotSection target, std::size_t element_size) {
+        const std::uint32_t *const first{database->Section<std::uint32_t>(offsets)};
+        const std::uint32_t *const last{first + database->SectionLength(offsets, sizeof(std::uint32_t))};
+
+        return first != last && std::is_sorted(first, last) &&
+               *(last - 1) <= database->SectionLength(target, element_size);
+    }};
+
+    bool const bounded{consistent && offsets_fit(kFlightNumberOffsets, kFlightNumberBlob, sizeof(char)) &&
+                       offsets_fit(kCityOffsets, kCityBlob, sizeof(char)) &&
+                       offsets_fit(kOperatorOffsets, kOperatorBlob, sizeof(char)) &&
+                       offsets_fit(kOriginPostingOffsets, kOriginPostings, sizeof(TripId)) &&
+                       offsets_fit(kRouteOffsets, kRouteTrips, sizeof(TripId)) &&
+                       offsets_fit(kOperatorFareOffsets, kOperatorFareTrips, sizeof(TripId))};
+
+    return bounded ? std::move(database) : nullptr;
+}
+
+MappedFlightTripDatabase::MappedFlightTripDatabase(MappedFile &&file) noexcept
+    : file_{std::move(file)},
+      header_{reinterpret_cast<const SnapshotHeader *>(file_.Data())}
+{
+}
+
+std::size_t MappedFlightTripDatabase::SectionLength(SnapshotSection section, std::size_t element_size) const noexcept
+{
+    return header_->sections[section].size / element_size;
+}
+
+std::string_view MappedFlightTripDatabase::GetString(SnapshotSection offsets, SnapshotSection blob,
+                                                     InternId id) const noexcept
+{
+    const std::uint32_t *const string_offsets{Section<std::uint32_t>(offsets)};
+
+    return std::string_view{Section<char>(blob) + string_offsets[id], string_offsets[id + 1U] - string_offsets[id]};
+}
+
+InternId MappedFlightTripDatabase::FindString(SnapshotSection offsets, SnapshotSection blob, SnapshotSection order,
+                                              std::string_view value) const noexcept
+{
+    const InternId *const first{Section<InternId>(order)};
+    const InternId *const last{first + SectionLength(order, sizeof(InternId))};
+
+    const InternId *const found{std::lower_bound(first, last, value, [this, offsets, blob](InternId id, std::string_view key) {
+        return GetString(offsets, blob, id) < key;
+    })};
+
+    return (found != last && GetString(offsets, blob, *found) == value) ? *found : kInvalidInternId;
+}
+
+TripId MappedFlightTripDatabase::FindLiveTrip(std::string_view flight_number) const noexcept
+{
+    TripId const trip{FindString(kFlightNumberOffsets, kFlightNumberBlob, kFlightNumberOrder, flight_number)};
+
+    return (trip != kInvalidInternId && Section<std::uint8_t>(kLiveColumn)[trip] != 0U) ? trip : kInvalidInternId;
+}
+
+FlightData MappedFlightTripDatabase::MakeFlightData(TripId trip) const noexcept
+{
+    return FlightData{GetString(kFlightNumberOffsets, kFlightNumberBlob, trip),
+                      GetString(kCityOffsets, kCityBlob, Section<InternId>(kOriginColumn)[trip]),
+                      GetString(kCityOffsets, kCityBlob, Section<InternId>(kDestinationColumn)[trip]),
+                      GetString(kOperatorOffsets, kOperatorBlob, Section<InternId>(kOperatorColumn)[trip]),
+                      Section<std::uint32_t>(kFareColumn)[trip]};
+}
+
+std::vector<FlightData> MappedFlightTripDatabase::FindFlightsByOrigin(std::string_view origin_city) const noexcept
+{
+    if (materialized_)
+    {
+        return materialized_->FindFlightsByOriginCity(origin_city);
+    }
+
+    std::vector<FlightData> flight_data{};
+
+    InternId const origin_id{FindString(kCityOffsets, kCityBlob, kCityOrder, origin_city)};
+    if (origin_id == kInvalidInternId)
+    {
+        return flight_data;
+    }
+
+    const std::uint32_t *const offsets{Section<std::uint32_t>(kOriginPostingOffsets)};
+    const TripId *const trips{Section<TripId>(kOriginPostings)};
+
+    flight_data.reserve(offsets[origin_id + 1U] - offsets[origin_id]);
+
+    for (std::uint32_t index = offsets[origin_id]; index < offsets[origin_id + 1U]; ++index)
+    {
+        flight_data.emplace_back(MakeFlightData(trips[index]));
+    }
+
+    return flight_data;
+}
+
+std::uint32_t MappedFlightTripDatabase::FindMaxFare(std::string_view flight_operator) const noexcept
+{
+    if (materialized_)
+    {
+        return materialized_->FindMaxFareByOperator(flight_operator);
+    }
+
+    InternId const operator_id{FindString(kOperatorOffsets, kOperatorBlob, kOperatorOrder, flight_operator)};
+    if (operator_id == kInvalidInternId)
+    {
+        return 0U;
+    }
+
+    const std::uint32_t *const offsets{Section<std::uint32_t>(kOperatorFareOffsets)};
+
+    return (offsets[operator_id] != offsets[operator_id + 1U])
+               ? Section<std::uint32_t>(kFareColumn)[Section<TripId>(kOperatorFareTrips)[offsets[operator_id + 1U] - 1U]]
+               : 0U;
+}
+
+std::uint32_t MappedFlightTripDatabase::FindMinFare(std::string_view origin_city,
+                                                    std::string_view destination_city) const noexcept
+{
+    if (materialized_)
+    {
+        return materialized_->FindMinFareBetweenCities(origin_city, destination_city);
+    }
+
+    InternId const origin_id{FindString(kCityOffsets, kCityBlob, kCityOrder, origin_city)};
+    InternId const destination_id{FindString(kCityOffsets, kCityBlob, kCityOrder, destination_city)};
+    if (origin_id == kInvalidInternId || destination_id == kInvalidInternId)
+    {
+        return UINT_MAX;
+    }
+
+    const RouteKey *const first{Section<RouteKey>(kRouteKeys)};
+    const RouteKey *const last{first + SectionLength(kRouteKeys, sizeof(RouteKey))};
+    const RouteKey *const route{std::lower_bound(first, last, MakeRouteKey(origin_id, destination_id))};
+
+    if (route == last || *route != MakeRouteKey(origin_id, destination_id))
+    {
+        return UINT_MAX;
+    }
+
+    TripId const cheapest{Section<TripId>(kRouteTrips)[Section<std::uint32_t>(kRouteOffsets)[route - first]]};
+
+    return Section<std::uint32_t>(kFareColumn)[cheapest];
+}
+
+bool MappedFlightTripDatabase::IsTripInDatabase(std::string_view flight_number) const noexcept
+{
+    return materialized_ ? materialized_->IsTripInDatabase(flight_number)
+                         : FindLiveTrip(flight_number) != kInvalidInternId;
+}
+
+bool MappedFlightTripDatabase::RemoveTrip(std::string_view flight_number) noexcept
+{
+    if (!materialized_ && FindLiveTrip(flight_number) == kInvalidInternId)
+    {
+        return false;
+    }
+
+    return Materialize().RemoveTrip(flight_number);
+}
+
+bool MappedFlightTripDatabase::UpdateFareByTrip(std::string_view flight_number, std::uint32_t fare) noexcept
+{
+    if (!materialized_)
+    {
+        TripId const trip{FindLiveTrip(flight_number)};
+
+        if (trip == kInvalidInternId || Section<std::uint32_t>(kFareColumn)[trip] == fare)
+        {
+            return trip != kInvalidInternId;
+        }
+    }
+
+    return Materialize().UpdateFareByTrip(flight_number, fare);
+}
+
+std::uint32_t MappedFlightTripDatabase::FindAverageCostOfAllTrips() const noexcept
+{
+    if (materialized_)
+    {
+        return materialized_->FindAverageCostOfAllTrips();
+    }
+
+    return (header_->trip_count != 0U) ? static_cast<std::uint32_t>(header_->fare_sum / header_->trip_count) : 0U;
+}
+
+std::optional<FlightData> MappedFlightTripDatabase::FindFlightsByNumber(std::string_view flight_number) const noexcept
+{
+    if (materialized_)
+    {
+        return materialized_->FindFlightsByNumber(flight_number);
+    }
+
+    TripId const trip{FindLiveTrip(flight_number)};
+    return (trip != kInvalidInternId) ? std::make_optional(MakeFlightData(trip)) : std::nullopt;
+}
+
+bool MappedFlightTripDatabase::IsMaterialized() const noexcept
+{
+    return materialized_ != nullptr;
+}
+
+std::unique_ptr<FlightTripDatabase> MappedFlightTripDatabase::Release() noexcept
+{
+    Materialize();
+
+    return std::move(materialized_);
+}
+
+FlightTripDatabase &MappedFlightTripDatabase::Materialize() noexcept
+{
+    if (!materialized_)
+    {
+        std::vector<TripRecordView> records{};
+        records.reserve(header_->trip_count);
+
+        const std::uint8_t *const live{Section<std::uint8_t>(kLiveColumn)};
+
+        for (TripId trip = 0U; trip < SectionLength(kLiveColumn, sizeof(std::uint8_t)); ++trip)
+        {
+            if (live[trip] != 0U)
+            {
+                records.push_back(TripRecordView{
+                    GetString(kFlightNumberOffsets, kFlightNumberBlob, trip),
+                    GetString(kCityOffsets, kCityBlob, Section<InternId>(kOriginColumn)[trip]),
+                    GetString(kCityOffsets, kCityBlob, Section<InternId>(kDestinationColumn)[trip]),
+                    GetString(kOperatorOffsets, kOperatorBlob, Section<InternId>(kOperatorColumn)[trip]),
+                    Section<std::uint32_t>(kFareColumn)[trip]});
+            }
+        }
+
+        materialized_ = std::make_unique<FlightTripDatabase>();
+        materialized_->BulkLoad(records);
+
+        header_ = nullptr;
+        file_ = MappedFile{};
+    }
+
+    return *materialized_;
+}
+
+} // namespace flight_management
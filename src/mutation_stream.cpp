@@ -0,0 +1,198 @@
+#include <thread>
+
+#include "mutation_stream.h"
+
+namespace flight_management
+{
+
+MutationSubscription::MutationSubscription(MutationStream &stream, std::size_t consumer) noexcept
+    : stream_{&stream},
+      consumer_{consumer}
+{
+}
+
+MutationSubscription::MutationSubscription(MutationSubscription &&other) noexcept
+    : stream_{other.stream_},
+      consumer_{other.consumer_}
+{
+    other.stream_ = nullptr;
+}
+
+MutationSubscription &MutationSubscription::operator=(MutationSubscription &&other) noexcept
+{
+    if (this != &other)
+    {
+        if (stream_ != nullptr)
+        {
+            stream_->Release(consumer_);
+        }
+
+        stream_ = other.stream_;
+        consumer_ = other.consumer_;
+        other.stream_ = nullptr;
+    }
+
+    return *this;
+}
+
+MutationSubscription::~MutationSubscription() noexcept
+{
+    if (stream_ != nullptr)
+    {
+        stream_->Release(consumer_);
+    }
+}
+
+std::size_t MutationSubscription::Poll(std::vector<TripMutation> &batch, std::size_t max_count) noexcept
+{
+    return Consume(max_count, [&batch](const TripMutation &mutation) { batch.push_back(mutation); });
+}
+
+bool MutationSubscription::IsOverrun() const noexcept
+{
+    return stream_->consumers_[consumer_].state.load(std::memory_order_acquire) == MutationStream::kDetached;
+}
+
+void MutationSubscription::Resync() noexcept
+{
+    if (IsOverrun())
+    {
+        stream_->Attach(consumer_);
+    }
+}
+
+std::size_t MutationSubscription::GetLag() const noexcept
+{
+    std::uint64_t const state{stream_->consumers_[consumer_].state.load(std::memory_order_acquire)};
+    if (state == MutationStream::kDetached)
+    {
+        return 0U;
+    }
+
+    return static_cast<std::size_t>(stream_->head_.load(std::memory_order_acquire) - (state >> 1U));
+}
+
+MutationStream::MutationStream(std::size_t capacity) noexcept
+    : slots_{},
+      mask_{0U}
+{
+    std::size_t size{2U};
+    while (size < capacity)
+    {
+        size <<= 1U;
+    }
+
+    slots_.resize(size);
+    mask_ = size - 1U;
+}
+
+void MutationStream::Publish(MutationKind kind, std::string_view flight_number, std::string_view origin_city,
+                             std::string_view destination_city, std::string_view flight_operator,
+                             std::uint32_t fare) noexcept
+{
+    std::uint64_t const position{head_.load(std::memory_order_relaxed)};
+
+    // A consumer attached since the last scan may already own any slot from its start.
+    if (position - oldest_ >= slots_.size() || attachments_.load(std::memory_order_seq_cst) != seen_attachments_)
+    {
+        WaitForSlot(position);
+    }
+
+    // Assigned in place, so the strings reuse the capacity the slot already has.
+    TripMutation &slot{slots_[position & mask_]};
+    slot.kind = kind;
+    slot.flight_number.assign(flight_number);
+    slot.origin_city.assign(origin_city);
+    slot.destination_city.assign(destination_city);
+    slot.flight_operator.assign(flight_operator);
+    slot.fare = fare;
+
+    head_.store(position + 1U, std::memory_order_seq_cst);
+}
+
+void MutationStream::Publish(const TripMutation &mutation) noexcept
+{
+    Publish(mutation.kind, mutation.flight_number, mutation.origin_city, mutation.destination_city,
+            mutation.flight_operator, mutation.fare);
+}
+
+std::optional<MutationSubscription> MutationStream::Subscribe(OverflowPolicy policy) noexcept
+{
+    for (std::size_t consumer = 0U; consumer < kMaxConsumers; ++consumer)
+    {
+        // Reserved as kDetached, which the producer skips, until Attach gives it a position.
+        std::uint64_t expected{kFree};
+        if (consumers_[consumer].state.compare_exchange_strong(expected, kDetached, std::memory_order_acq_rel))
+        {
+            consumers_[consumer].policy.store(policy, std::memory_order_relaxed);
+            Attach(consumer);
+
+            return MutationSubscription{*this, consumer};
+        }
+    }
+
+    return std::nullopt;
+}
+
+void MutationStream::Attach(std::size_t consumer) noexcept
+{
+    auto &state{consumers_[consumer].state};
+
+    for (;;)
+    {
+        std::uint64_t const position{head_.load(std::memory_order_seq_cst)};
+        state.store(position << 1U, std::memory_order_seq_cst);
+        attachments_.fetch_add(1U, std::memory_order_seq_cst);
+
+        // Every later Publish sees the new attachment and rescans. Only a producer
+        // that lapped position before that could have overwritten it, so retry then.
+        if (head_.load(std::memory_order_seq_cst) - position < slots_.size())
+        {
+            return;
+        }
+    }
+}
+
+void MutationStream::Release(std::size_t consumer) noexcept
+{
+    consumers_[consumer].state.store(kFree, std::memory_order_release);
+}
+
+void MutationStream::WaitForSlot(std::uint64_t position) noexcept
+{
+    for (;;)
+    {
+        seen_attachments_ = attachments_.load(std::memory_order_seq_cst);
+        std::uint64_t oldest{position};
+
+        for (auto &consumer : consumers_)
+        {
+            std::uint64_t state{consumer.state.load(std::memory_order_acquire)};
+            if (state == kFree || state == kDetached)
+            {
+                continue;
+            }
+
+            // A busy consumer is mid-batch on its slots; it is detached on a later pass if still behind.
+            std::uint64_t const start{state >> 1U};
+            if (position - start >= slots_.size() && (state & kBusy) == 0U &&
+                consumer.policy.load(std::memory_order_relaxed) == OverflowPolicy::kDetach &&
+                consumer.state.compare_exchange_strong(state, kDetached, std::memory_order_acq_rel))
+            {
+                continue;
+            }
+
+            oldest = std::min(oldest, start);
+        }
+
+        oldest_ = oldest;
+        if (position - oldest < slots_.size())
+        {
+            return;
+        }
+
+        std::this_thread::yield();
+    }
+}
+
+} // namespace flight_management
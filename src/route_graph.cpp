@@ -0,0 +1,320 @@
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include "route_graph.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+// Fold the overflow and dead edges back in once they reach a quarter of the arrays.
+constexpr std::size_t kRebuildMinEdges{64U};
+constexpr std::size_t kRebuildRatio{4U};
+
+constexpr std::uint64_t kUnreached{std::numeric_limits<std::uint64_t>::max()};
+
+} // namespace
+
+/**
+ * One hop-bounded search from an origin. Every city keeps only its latest
+ * label, stamped with the round that set it; a label that is improved
+ * moves to a change log and the new one links back to it. The label a
+ * city had after any earlier round is found by following those links,
+ * so memory grows with the improvements made, not rounds times cities.
+ */
+class RouteGraph::Search
+{
+public:
+    Search(const RouteGraph &graph, InternId origin, std::size_t max_legs) noexcept : origin_{origin}
+    {
+        if (origin >= graph.city_count_)
+        {
+            return;
+        }
+
+        labels_.assign(graph.city_count_, Label{kUnreached, kInvalidInternId, kInvalidInternId, 0U, kNoChange});
+        labels_[origin].fare = 0U;
+
+        std::vector<InternId> frontier{origin};
+        std::vector<std::uint64_t> frontier_fares{};
+        std::vector<InternId> next_frontier{};
+        std::vector<std::uint8_t> queued(graph.city_count_, 0U);
+
+        for (std::size_t leg = 1U; leg <= max_legs && !frontier.empty(); ++leg)
+        {
+            auto const round{static_cast<std::uint32_t>(leg)};
+
+            // Fares as the previous round left them, so a round adds at most one leg.
+            frontier_fares.clear();
+            for (InternId city : frontier)
+            {
+                frontier_fares.push_back(labels_[city].fare);
+            }
+
+            for (std::size_t index = 0U; index < frontier.size(); ++index)
+            {
+                InternId const city{frontier[index]};
+                std::uint64_t const fare{frontier_fares[index]};
+
+                graph.ForEachEdge(city, [&](const RouteEdge &edge) {
+                    std::uint64_t const candidate{fare + edge.fare};
+                    Label &label{labels_[edge.destination]};
+                    if (candidate < label.fare)
+                    {
+                        // The first improvement this round logs the label the earlier rounds left.
+                        std::uint32_t replaced{label.replaced};
+                        if (label.round != round)
+                        {
+                            replaced = static_cast<std::uint32_t>(changes_.size());
+                            changes_.push_back(label);
+                        }
+
+                        label = Label{candidate, city, edge.trip, round, replaced};
+                        if (queued[edge.destination] == 0U)
+                        {
+                            queued[edge.destination] = 1U;
+                            next_frontier.push_back(edge.destination);
+                        }
+                    }
+                });
+            }
+
+            for (InternId city : next_frontier)
+            {
+                queued[city] = 0U;
+            }
+            frontier.swap(next_frontier);
+            next_frontier.clear();
+        }
+    }
+
+    std::optional<RoutePath> PathTo(InternId destination) const noexcept
+    {
+        if (destination >= labels_.size() || destination == origin_ || labels_[destination].fare == kUnreached)
+        {
+            return std::nullopt;
+        }
+
+        RoutePath path{labels_[destination].fare, {}};
+
+        // Each leg was relaxed from its previous city as the round before left it.
+        for (Label label{labels_[destination]}; label.trip != kInvalidInternId;
+             label = LabelAfter(label.previous, label.round - 1U))
+        {
+            path.legs.push_back(label.trip);
+        }
+        std::reverse(path.legs.begin(), path.legs.end());
+
+        return path;
+    }
+
+private:
+    static constexpr std::uint32_t kNoChange{std::numeric_limits<std::uint32_t>::max()};
+
+    struct Label
+    {
+        std::uint64_t fare;
+        InternId previous;
+        TripId trip;
+        std::uint32_t round;
+        std::uint32_t replaced;
+    };
+
+    Label LabelAfter(InternId city, std::uint32_t round) const noexcept
+    {
+        Label label{labels_[city]};
+        while (label.round > round)
+        {
+            label = changes_[label.replaced];
+        }
+
+        return label;
+    }
+
+    InternId origin_;
+    std::vector<Label> labels_{};
+    std::vector<Label> changes_{};
+};
+
+void RouteGraph::SetEdge(InternId origin, InternId destination, std::optional<FareEntry> cheapest) noexcept
+{
+    city_count_ = std::max<std::size_t>(city_count_, std::max(origin, destination) + 1U);
+
+    if (!SetArrayEdge(origin, destination, cheapest))
+    {
+        SetOverflowEdge(origin, destination, cheapest);
+    }
+
+    std::size_t const pending{dead_edges_ + overflow_edges_};
+    if (pending >= kRebuildMinEdges && pending * kRebuildRatio >= edges_.size())
+    {
+        Rebuild();
+    }
+}
+
+bool RouteGraph::SetArrayEdge(InternId origin, InternId destination, std::optional<FareEntry> cheapest) noexcept
+{
+    if (origin + 1U >= offsets_.size())
+    {
+        return false;
+    }
+
+    auto const last{edges_.begin() + offsets_[origin + 1U]};
+    auto const edge{std::lower_bound(edges_.begin() + offsets_[origin], last, destination,
+                                     [](const RouteEdge &candidate, InternId city) {
+                                         return candidate.destination < city;
+                                     })};
+
+    if (edge == last || edge->destination != destination)
+    {
+        return false;
+    }
+
+    bool const was_dead{edge->trip == kInvalidInternId};
+
+    if (cheapest)
+    {
+        edge->fare = cheapest->first;
+        edge->trip = cheapest->second;
+        dead_edges_ -= was_dead ? 1U : 0U;
+    }
+    else if (!was_dead)
+    {
+        edge->trip = kInvalidInternId;
+        ++dead_edges_;
+    }
+
+    return true;
+}
+
+void RouteGraph::SetOverflowEdge(InternId origin, InternId destination, std::optional<FareEntry> cheapest) noexcept
+{
+    auto const overflow{overflow_.find(origin)};
+
+    if (overflow != overflow_.end())
+    {
+        auto &edges{overflow->second};
+        auto const edge{std::find_if(edges.begin(), edges.end(), [destination](const RouteEdge &candidate) {
+            return candidate.destination == destination;
+        })};
+
+        if (edge != edges.end())
+        {
+            if (cheapest)
+            {
+                edge->fare = cheapest->first;
+                edge->trip = cheapest->second;
+            }
+            else
+            {
+                edges.erase(edge);
+                --overflow_edges_;
+                if (edges.empty())
+                {
+                    overflow_.erase(overflow);
+                }
+            }
+
+            return;
+        }
+    }
+
+    if (cheapest)
+    {
+        overflow_[origin].push_back(RouteEdge{destination, cheapest->first, cheapest->second});
+        ++overflow_edges_;
+    }
+}
+
+void RouteGraph::Rebuild() noexcept
+{
+    std::vector<std::pair<InternId, RouteEdge>> live{};
+    live.reserve(GetEdgeCount());
+
+    for (InternId origin = 0U; origin + 1U < offsets_.size(); ++origin)
+    {
+        for (std::uint32_t edge = offsets_[origin]; edge < offsets_[origin + 1U]; ++edge)
+        {
+            if (edges_[edge].trip != kInvalidInternId)
+            {
+                live.emplace_back(origin, edges_[edge]);
+            }
+        }
+    }
+
+    for (auto const &overflow : overflow_)
+    {
+        for (auto const &edge : overflow.second)
+        {
+            live.emplace_back(overflow.first, edge);
+        }
+    }
+
+    std::sort(live.begin(), live.end(), [](auto const &lhs, auto const &rhs) {
+        return std::make_pair(lhs.first, lhs.second.destination) < std::make_pair(rhs.first, rhs.second.destination);
+    });
+
+    offsets_.assign(city_count_ + 1U, 0U);
+    edges_.clear();
+    edges_.reserve(live.size());
+
+    for (auto const &edge : live)
+    {
+        ++offsets_[edge.first + 1U];
+        edges_.push_back(edge.second);
+    }
+    std::partial_sum(offsets_.begin(), offsets_.end(), offsets_.begin());
+
+    overflow_.clear();
+    dead_edges_ = 0U;
+    overflow_edges_ = 0U;
+}
+
+std::optional<RoutePath> RouteGraph::FindCheapestPath(InternId origin, InternId destination,
+                                                      std::size_t max_legs) const noexcept
+{
+    return Search{*this, origin, max_legs}.PathTo(destination);
+}
+
+std::vector<std::optional<RoutePath>> RouteGraph::FindCheapestPaths(
+    const std::vector<std::pair<InternId, InternId>> &queries, std::size_t max_legs,
+    WorkStealingThreadPool &pool) const noexcept
+{
+    std::vector<std::size_t> order(queries.size());
+    std::iota(order.begin(), order.end(), 0U);
+    std::sort(order.begin(), order.end(),
+              [&queries](std::size_t lhs, std::size_t rhs) { return queries[lhs].first < queries[rhs].first; });
+
+    // Each group is the run of queries sharing one origin.
+    std::vector<std::size_t> groups{};
+    for (std::size_t index = 0U; index < order.size(); ++index)
+    {
+        if (index == 0U || queries[order[index]].first != queries[order[index - 1U]].first)
+        {
+            groups.push_back(index);
+        }
+    }
+    groups.push_back(order.size());
+
+    std::vector<std::optional<RoutePath>> paths(queries.size());
+
+    // One search per group; groups write disjoint result slots.
+    pool.ParallelFor(groups.size() - 1U, 1U, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t group = begin; group < end; ++group)
+        {
+            Search const search{*this, queries[order[groups[group]]].first, max_legs};
+
+            for (std::size_t index = groups[group]; index < groups[group + 1U]; ++index)
+            {
+                paths[order[index]] = search.PathTo(queries[order[index]].second);
+            }
+        }
+    });
+
+    return paths;
+}
+
+} // namespace flight_management
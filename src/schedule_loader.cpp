@@ -0,0 +1,161 @@
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+
+#include "mapped_file.h"
+#include "schedule_loader.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+constexpr std::string_view kHeaderPrefix{"flight_number"};
+
+std::string_view NextField(std::string_view &line) noexcept
+{
+    auto const separator{line.find(',')};
+    std::string_view const field{line.substr(0U, separator)};
+
+    line = (separator == std::string_view::npos) ? std::string_view{} : line.substr(separator + 1U);
+
+    return field;
+}
+
+} // namespace
+
+ScheduleLoader::ScheduleLoader(std::size_t parser_threads) noexcept
+    : parser_threads_{std::max<std::size_t>(parser_threads, 1U)},
+      pool_{std::make_unique<WorkStealingThreadPool>(parser_threads_ - 1U)}
+{
+}
+
+bool ScheduleLoader::ParseCsvLine(std::string_view line, TripRecordView &record) noexcept
+{
+    if (!line.empty() && line.back() == '\r')
+    {
+        line.remove_suffix(1U);
+    }
+
+    record.flight_number = NextField(line);
+    record.origin_city = NextField(line);
+    record.destination_city = NextField(line);
+    record.flight_operator = NextField(line);
+
+    std::string_view const fare{line};
+    auto const parsed{std::from_chars(fare.data(), fare.data() + fare.size(), record.fare)};
+
+    return !record.flight_number.empty() && !record.origin_city.empty() && !record.destination_city.empty() &&
+           !record.flight_operator.empty() && !fare.empty() && parsed.ec == std::errc{} &&
+           parsed.ptr == fare.data() + fare.size();
+}
+
+std::size_t ScheduleLoader::ParseChunk(std::string_view chunk, std::vector<TripRecordView> &records) noexcept
+{
+    std::size_t rejected{0U};
+
+    while (!chunk.empty())
+    {
+        auto const end_of_line{chunk.find('\n')};
+        std::string_view const line{chunk.substr(0U, end_of_line)};
+        chunk = (end_of_line == std::string_view::npos) ? std::string_view{} : chunk.substr(end_of_line + 1U);
+
+        if (line.empty() || line == "\r")
+        {
+            continue;
+        }
+
+        TripRecordView record{};
+
+        if (ParseCsvLine(line, record))
+        {
+            records.push_back(record);
+        }
+        else
+        {
+            ++rejected;
+        }
+    }
+
+    return rejected;
+}
+
+LoadStatistics ScheduleLoader::LoadCsv(std::string_view contents, FlightTripDatabase &database) const noexcept
+{
+    auto const start{std::chrono::steady_clock::now()};
+
+    if (contents.substr(0U, kHeaderPrefix.size()) == kHeaderPrefix)
+    {
+        auto const end_of_header{contents.find('\n')};
+        contents = (end_of_header == std::string_view::npos) ? std::string_view{} : contents.substr(end_of_header + 1U);
+    }
+
+    // Chunk boundaries are moved forward to the next line start.
+    std::vector<std::string_view> chunks{};
+    std::size_t const chunk_size{contents.size() / parser_threads_ + 1U};
+
+    for (std::size_t begin = 0U; begin < contents.size();)
+    {
+        std::size_t end{contents.find('\n', std::min(begin + chunk_size, contents.size()) - 1U)};
+        end = (end == std::string_view::npos) ? contents.size() : end + 1U;
+
+        chunks.push_back(contents.substr(begin, end - begin));
+        begin = end;
+    }
+
+    std::vector<std::vector<TripRecordView>> parsed(chunks.size());
+    std::vector<std::size_t> rejected(chunks.size(), 0U);
+
+    pool_->ParallelFor(chunks.size(), 1U, [&chunks, &parsed, &rejected](std::size_t begin, std::size_t end) {
+        for (std::size_t index = begin; index < end; ++index)
+        {
+            rejected[index] = ParseChunk(chunks[index], parsed[index]);
+        }
+    });
+
+    std::vector<TripRecordView> records{};
+    LoadStatistics statistics{};
+
+    if (parsed.size() == 1U)
+    {
+        records = std::move(parsed.front());
+    }
+    else
+    {
+        for (auto const &chunk_records : parsed)
+        {
+            records.insert(records.end(), chunk_records.cbegin(), chunk_records.cend());
+        }
+    }
+
+    for (std::size_t const chunk_rejected : rejected)
+    {
+        statistics.rows_rejected += chunk_rejected;
+    }
+
+    statistics.rows_loaded = database.BulkLoad(records);
+    statistics.rows_rejected += records.size() - statistics.rows_loaded;
+    statistics.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    return statistics;
+}
+
+std::optional<LoadStatistics> ScheduleLoader::LoadCsvFile(const std::string &path,
+                                                          FlightTripDatabase &database) const noexcept
+{
+    auto const start{std::chrono::steady_clock::now()};
+
+    MappedFile const file{path, AccessPattern::kSequential};
+    if (!file.IsOpen())
+    {
+        return std::nullopt;
+    }
+
+    LoadStatistics statistics{LoadCsv(file.Contents(), database)};
+    statistics.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    return statistics;
+}
+
+} // namespace flight_management
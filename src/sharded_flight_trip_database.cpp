@@ -0,0 +1,86 @@
+#include <functional>
+#include <utility>
+
+#include "sharded_flight_trip_database.h"
+
+namespace flight_management
+{
+
+ShardedFlightTripDatabase::ShardedFlightTripDatabase(std::size_t shard_count) noexcept
+{
+    shards_.reserve(std::max<std::size_t>(shard_count, 1U));
+
+    for (std::size_t index = 0U; index < std::max<std::size_t>(shard_count, 1U); ++index)
+    {
+        shards_.push_back(std::make_unique<Shard>());
+    }
+
+    pool_ = std::make_unique<WorkStealingThreadPool>(shards_.size() - 1U);
+}
+
+ShardedFlightTripDatabase::Shard &ShardedFlightTripDatabase::ShardOf(std::string_view flight_number) noexcept
+{
+    return *shards_[std::hash<std::string_view>{}(flight_number) % shards_.size()];
+}
+
+const ShardedFlightTripDatabase::Shard &ShardedFlightTripDatabase::ShardOf(std::string_view flight_number) const noexcept
+{
+    return *shards_[std::hash<std::string_view>{}(flight_number) % shards_.size()];
+}
+
+bool ShardedFlightTripDatabase::IsTripInDatabase(std::string_view flight_number) const noexcept
+{
+    const Shard &shard{ShardOf(flight_number)};
+    std::shared_lock<std::shared_mutex> lock{shard.mutex};
+
+    return shard.database.IsTripInDatabase(flight_number);
+}
+
+bool ShardedFlightTripDatabase::RemoveTrip(std::string_view flight_number) noexcept
+{
+    Shard &shard{ShardOf(flight_number)};
+    std::unique_lock<std::shared_mutex> lock{shard.mutex};
+
+    return shard.database.RemoveTrip(flight_number);
+}
+
+bool ShardedFlightTripDatabase::UpdateFareByTrip(std::string_view flight_number, std::uint32_t fare) noexcept
+{
+    Shard &shard{ShardOf(flight_number)};
+    std::unique_lock<std::shared_mutex> lock{shard.mutex};
+
+    return shard.database.UpdateFareByTrip(flight_number, fare);
+}
+
+std::uint32_t ShardedFlightTripDatabase::FindAverageCostOfAllTrips() const noexcept
+{
+    auto const partials{Gather([](const FlightTripDatabase &database) {
+        return std::make_pair(database.GetTotalFare(), database.GetTripCount());
+    })};
+
+    std::uint64_t total_fare{0U};
+    std::size_t trip_count{0U};
+
+    for (auto const &partial : partials)
+    {
+        total_fare += partial.first;
+        trip_count += partial.second;
+    }
+
+    return (trip_count != 0U) ? static_cast<std::uint32_t>(total_fare / trip_count) : 0U;
+}
+
+std::optional<FlightData> ShardedFlightTripDatabase::FindFlightsByNumber(std::string_view flight_number) const noexcept
+{
+    const Shard &shard{ShardOf(flight_number)};
+    std::shared_lock<std::shared_mutex> lock{shard.mutex};
+
+    return shard.database.FindFlightsByNumber(flight_number);
+}
+
+std::size_t ShardedFlightTripDatabase::GetShardCount() const noexcept
+{
+    return shards_.size();
+}
+
+} // namespace flight_management
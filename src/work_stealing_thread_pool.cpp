@@ -0,0 +1,195 @@
+#include <algorithm>
+
+#include "work_stealing_thread_pool.h"
+
+namespace flight_management
+{
+
+WorkStealingThreadPool::WorkStealingThreadPool(std::size_t thread_count) noexcept
+{
+    queues_.reserve(thread_count + 1U);
+
+    for (std::size_t queue = 0U; queue <= thread_count; ++queue)
+    {
+        queues_.push_back(std::make_unique<Queue>());
+    }
+
+    threads_.reserve(thread_count);
+
+    for (std::size_t worker = 0U; worker < thread_count; ++worker)
+    {
+        threads_.emplace_back([this, worker] { WorkerLoop(worker); });
+    }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock{wake_mutex_};
+        stopping_ = true;
+    }
+    wake_.notify_all();
+
+    for (auto &thread : threads_)
+    {
+        thread.join();
+    }
+}
+
+void WorkStealingThreadPool::ParallelFor(std::size_t count, std::size_t grain,
+                                         const std::function<void(std::size_t, std::size_t)> &body) noexcept
+{
+    grain = std::max<std::size_t>(grain, 1U);
+    std::size_t const chunks{(count + grain - 1U) / grain};
+
+    if (threads_.empty() || chunks <= 1U)
+    {
+        for (std::size_t begin = 0U; begin < count; begin += grain)
+        {
+            body(begin, std::min(begin + grain, count));
+        }
+        return;
+    }
+
+    struct Completion
+    {
+        std::atomic<std::size_t> remaining;
+        std::mutex mutex{};
+        std::condition_variable done{};
+    } completion{chunks};
+
+    // Chunks are dealt round-robin over the workers' deques and the caller's.
+    for (std::size_t chunk = 0U; chunk < chunks; ++chunk)
+    {
+        std::size_t const begin{chunk * grain};
+        std::size_t const end{std::min(begin + grain, count)};
+
+        Push(chunk % queues_.size(), [&body, &completion, begin, end] {
+            body(begin, end);
+
+            // Counted down under the mutex: the caller takes it before returning, so
+            // completion outlives this notify even if the caller saw the count reach 0.
+            std::lock_guard<std::mutex> lock{completion.mutex};
+            if (completion.remaining.fetch_sub(1U, std::memory_order_acq_rel) == 1U)
+            {
+                completion.done.notify_all();
+            }
+        });
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{wake_mutex_};
+    }
+    wake_.notify_all();
+
+    std::size_t const caller{queues_.size() - 1U};
+    while (completion.remaining.load(std::memory_order_acquire) != 0U && TryRunOne(caller))
+    {
+    }
+
+    std::unique_lock<std::mutex> lock{completion.mutex};
+    completion.done.wait(lock, [&completion] { return completion.remaining.load(std::memory_order_acquire) == 0U; });
+}
+
+void WorkStealingThreadPool::Post(std::function<void()> task) noexcept
+{
+    if (threads_.empty())
+    {
+        task();
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{posted_.mutex};
+        posted_.tasks.push_back(std::move(task));
+    }
+    queued_.fetch_add(1U, std::memory_order_release);
+
+    {
+        std::lock_guard<std::mutex> lock{wake_mutex_};
+    }
+    wake_.notify_one();
+}
+
+std::size_t WorkStealingThreadPool::GetThreadCount() const noexcept
+{
+    return threads_.size();
+}
+
+void WorkStealingThreadPool::Push(std::size_t queue, Task task) noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock{queues_[queue]->mutex};
+        queues_[queue]->tasks.push_back(std::move(task));
+    }
+    queued_.fetch_add(1U, std::memory_order_release);
+}
+
+bool WorkStealingThreadPool::TryRunOne(std::size_t self) noexcept
+{
+    Task task{};
+
+    // Own deque from the back, then the others from the front.
+    for (std::size_t offset = 0U; offset < queues_.size() && !task; ++offset)
+    {
+        Queue &queue{*queues_[(self + offset) % queues_.size()]};
+        std::lock_guard<std::mutex> lock{queue.mutex};
+
+        if (!queue.tasks.empty())
+        {
+            if (offset == 0U)
+            {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            }
+            else
+            {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+        }
+    }
+
+    // Posted tasks go to workers only, after every ParallelFor chunk.
+    if (!task && self + 1U < queues_.size())
+    {
+        std::lock_guard<std::mutex> lock{posted_.mutex};
+
+        if (!posted_.tasks.empty())
+        {
+            task = std::move(posted_.tasks.front());
+            posted_.tasks.pop_front();
+        }
+    }
+
+    if (!task)
+    {
+        return false;
+    }
+
+    queued_.fetch_sub(1U, std::memory_order_acq_rel);
+    task();
+
+    return true;
+}
+
+void WorkStealingThreadPool::WorkerLoop(std::size_t self) noexcept
+{
+    while (true)
+    {
+        if (TryRunOne(self))
+        {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock{wake_mutex_};
+        wake_.wait(lock, [this] { return stopping_ || queued_.load(std::memory_order_acquire) != 0U; });
+
+        if (stopping_ && queued_.load(std::memory_order_acquire) == 0U)
+        {
+            return;
+        }
+    }
+}
+
+} // namespace flight_management
@@ -0,0 +1,349 @@
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <array>
+#include <cstring>
+#include <limits>
+
+#include "mapped_file.h"
+#include "write_ahead_log.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+constexpr std::size_t kFrameSize{2U * sizeof(std::uint32_t)};
+constexpr std::size_t kMinimumBodySize{sizeof(std::uint64_t) + sizeof(std::uint8_t) + sizeof(std::uint32_t) +
+                                       4U * sizeof(std::uint32_t)};
+
+std::uint32_t Crc32(const char *data, std::size_t size) noexcept
+{
+    static const std::array<std::uint32_t, 256U> table{[]() {
+        std::array<std::uint32_t, 256U> entries{};
+        for (std::uint32_t index = 0U; index < entries.size(); ++index)
+        {
+            std::uint32_t value{index};
+            for (int bit = 0; bit < 8; ++bit)
+            {
+                value = (value & 1U) ? (0xEDB88320U ^ (value >> 1U)) : (value >> 1U);
+            }
+            entries[index] = value;
+        }
+        return entries;
+    }()};
+
+    std::uint32_t crc{0xFFFFFFFFU};
+
+    for (std::size_t index = 0U; index < size; ++index)
+    {
+        crc = table[(crc ^ static_cast<unsigned char>(data[index])) & 0xFFU] ^ (crc >> 8U);
+    }
+
+    return crc ^ 0xFFFFFFFFU;
+}
+
+template <typename Type>
+void Put(std::vector<char> &buffer, Type value) noexcept
+{
+    char bytes[sizeof(Type)];
+    std::memcpy(bytes, &value, sizeof(Type));
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(Type));
+}
+
+void PutString(std::vector<char> &buffer, std::string_view value) noexcept
+{
+    Put(buffer, static_cast<std::uint32_t>(value.size()));
+    buffer.insert(buffer.end(), value.cbegin(), value.cend());
+}
+
+/**
+ * Reads fields front to back and turns sticky-invalid on overrun.
+ */
+class BodyReader
+{
+public:
+    BodyReader(const char *data, std::size_t size) noexcept
+        : data_{data},
+          remaining_{size}
+    {
+    }
+
+    template <typename Type>
+    Type Get() noexcept
+    {
+        Type value{};
+
+        if (remaining_ >= sizeof(Type))
+        {
+            std::memcpy(&value, data_, sizeof(Type));
+            data_ += sizeof(Type);
+            remaining_ -= sizeof(Type);
+        }
+        else
+        {
+            valid_ = false;
+        }
+
+        return value;
+    }
+
+    std::string GetString() noexcept
+    {
+        auto const size{Get<std::uint32_t>()};
+
+        if (!valid_ || remaining_ < size)
+        {
+            valid_ = false;
+            return {};
+        }
+
+        std::string value{data_, size};
+        data_ += size;
+        remaining_ -= size;
+
+        return value;
+    }
+
+    bool IsComplete() const noexcept
+    {
+        return valid_ && remaining_ == 0U;
+    }
+
+private:
+    const char *data_;
+    std::size_t remaining_;
+    bool valid_{true};
+};
+
+bool WriteAll(int descriptor, const char *data, std::size_t size) noexcept
+{
+    while (size != 0U)
+    {
+        ssize_t const written{::write(descriptor, data, size)};
+        if (written <= 0)
+        {
+            return false;
+        }
+
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+
+    return true;
+}
+
+/**
+ * Makes a newly created log's directory entry durable.
+ */
+bool SyncParentDirectory(const std::string &path) noexcept
+{
+    std::size_t const slash{path.rfind('/')};
+    std::string const directory{(slash == std::string::npos) ? "." : (slash == 0U) ? "/" : path.substr(0U, slash)};
+
+    int const descriptor{::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC)};
+    if (descriptor < 0)
+    {
+        return false;
+    }
+
+    bool const synced{::fsync(descriptor) == 0};
+    ::close(descriptor);
+
+    return synced;
+}
+
+} // namespace
+
+WalReplayResult WriteAheadLog::Replay(const std::string &path, const Visitor &visit) noexcept
+{
+    WalReplayResult result{};
+
+    MappedFile const file{path, AccessPattern::kSequential};
+    if (!file.IsOpen())
+    {
+        return result;
+    }
+
+    const char *const data{file.Data()};
+    std::size_t const size{file.Size()};
+    std::size_t position{0U};
+
+    while (position + kFrameSize <= size)
+    {
+        std::uint32_t length{0U};
+        std::uint32_t crc{0U};
+        std::memcpy(&length, data + position, sizeof(length));
+        std::memcpy(&crc, data + position + sizeof(length), sizeof(crc));
+
+        if (length < kMinimumBodySize || length > size - position - kFrameSize)
+        {
+            break;
+        }
+
+        const char *const body{data + position + kFrameSize};
+        if (Crc32(body, length) != crc)
+        {
+            break;
+        }
+
+        BodyReader reader{body, length};
+        auto const sequence{reader.Get<std::uint64_t>()};
+        auto const kind{reader.Get<std::uint8_t>()};
+
+        TripMutation mutation{};
+        mutation.kind = static_cast<MutationKind>(kind);
+        mutation.fare = reader.Get<std::uint32_t>();
+        mutation.flight_number = reader.GetString();
+        mutation.origin_city = reader.GetString();
+        mutation.destination_city = reader.GetString();
+        mutation.flight_operator = reader.GetString();
+
+        if (!reader.IsComplete() || kind > static_cast<std::uint8_t>(MutationKind::kUpdateFare) ||
+            (result.records != 0U && sequence != result.last_sequence + 1U))
+        {
+            break;
+        }
+
+        visit(mutation);
+
+        ++result.records;
+        result.last_sequence = sequence;
+        position += kFrameSize + length;
+    }
+
+    result.valid_bytes = position;
+    result.torn_tail = position != size;
+
+    return result;
+}
+
+std::unique_ptr<WriteAheadLog> WriteAheadLog::Open(const std::string &path, WalOptions options,
+                                                   const WalReplayResult &recovered) noexcept
+{
+    int const descriptor{::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644)};
+    if (descriptor < 0)
+    {
+        return nullptr;
+    }
+
+    if (::ftruncate(descriptor, static_cast<off_t>(recovered.valid_bytes)) != 0 || ::fsync(descriptor) != 0 ||
+        !SyncParentDirectory(path))
+    {
+        ::close(descriptor);
+        return nullptr;
+    }
+
+    return std::unique_ptr<WriteAheadLog>{new WriteAheadLog{descriptor, options, recovered.last_sequence}};
+}
+
+WriteAheadLog::WriteAheadLog(int descriptor, WalOptions options, std::uint64_t last_sequence) noexcept
+    : descriptor_{descriptor},
+      options_{options},
+      last_sequence_{last_sequence}
+{
+    pending_.reserve(options_.buffer_bytes);
+}
+
+WriteAheadLog::~WriteAheadLog() noexcept
+{
+    Commit();
+    ::close(descriptor_);
+}
+
+bool WriteAheadLog::Append(MutationKind kind, const TripRecordView &record) noexcept
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+
+    if (failed_)
+    {
+        return false;
+    }
+
+    std::size_t const strings{record.flight_number.size() + record.origin_city.size() +
+                              record.destination_city.size() + record.flight_operator.size()};
+    if (strings > std::numeric_limits<std::uint32_t>::max() - kMinimumBodySize)
+    {
+        return false;
+    }
+
+    std::size_t const frame{pending_.size()};
+    pending_.resize(frame + kFrameSize);
+
+    Put(pending_, ++last_sequence_);
+    Put(pending_, static_cast<std::uint8_t>(kind));
+    Put(pending_, record.fare);
+    PutString(pending_, record.flight_number);
+    PutString(pending_, record.origin_city);
+    PutString(pending_, record.destination_city);
+    PutString(pending_, record.flight_operator);
+
+    auto const length{static_cast<std::uint32_t>(pending_.size() - frame - kFrameSize)};
+    std::uint32_t const crc{Crc32(pending_.data() + frame + kFrameSize, length)};
+    std::memcpy(pending_.data() + frame, &length, sizeof(length));
+    std::memcpy(pending_.data() + frame + sizeof(length), &crc, sizeof(crc));
+    ++pending_records_;
+
+    switch (options_.durability)
+    {
+    case Durability::kEveryWrite:
+        return FlushLocked(true);
+    case Durability::kGroupCommit:
+        return (pending_records_ >= options_.group_commit_records) ? FlushLocked(true) : true;
+    case Durability::kNone:
+        return (pending_.size() >= options_.buffer_bytes) ? FlushLocked(false) : true;
+    }
+
+    return true;
+}
+
+bool WriteAheadLog::Append(const TripMutation &mutation) noexcept
+{
+    return Append(mutation.kind, TripRecordView{mutation.flight_number, mutation.origin_city,
+                                                mutation.destination_city, mutation.flight_operator, mutation.fare});
+}
+
+bool WriteAheadLog::Commit() noexcept
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+
+    return FlushLocked(options_.durability != Durability::kNone);
+}
+
+bool WriteAheadLog::Reset() noexcept
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+
+    pending_.clear();
+    pending_records_ = 0U;
+    last_sequence_ = 0U;
+    failed_ = ::ftruncate(descriptor_, 0) != 0 || ::fsync(descriptor_) != 0;
+
+    return !failed_;
+}
+
+std::uint64_t WriteAheadLog::GetLastSequence() const noexcept
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+
+    return last_sequence_;
+}
+
+bool WriteAheadLog::FlushLocked(bool sync) noexcept
+{
+    if (failed_)
+    {
+        return false;
+    }
+
+    bool const written{pending_.empty() || WriteAll(descriptor_, pending_.data(), pending_.size())};
+
+    pending_.clear();
+    pending_records_ = 0U;
+    failed_ = !written || (sync && ::fdatasync(descriptor_) != 0);
+
+    return !failed_;
+}
+
+} // namespace flight_management
@@ -0,0 +1,137 @@
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "async_flight_trip_database.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+void LoadHub(ConcurrentFlightTripDatabase &database, std::size_t trip_count)
+{
+	std::vector<TripMutation> batch{};
+	for (std::size_t index = 0U; index < trip_count; ++index)
+	{
+		batch.push_back(TripMutation::AddTrip("HUB-" + std::to_string(index), "Pune", "Delhi", "Air India",
+											  1000U + static_cast<std::uint32_t>(index)));
+	}
+	batch.push_back(TripMutation::AddTrip("6E-202", "Mumbai", "Delhi", "IndiGo", 4200U));
+	database.Publish(batch);
+}
+
+// Drains stream, recording each chunk's size; cancels context after cancel_after chunks.
+Task<std::vector<std::size_t>> ChunkSizes(ChunkStream<FlightData> stream, QueryContext context,
+										  std::size_t cancel_after)
+{
+	std::vector<std::size_t> sizes{};
+
+	while (auto chunk{co_await stream.Next()})
+	{
+		sizes.push_back(chunk->size());
+		if (sizes.size() == cancel_after)
+		{
+			context.Cancel();
+		}
+	}
+
+	co_return sizes;
+}
+
+} // namespace
+
+TEST(AsyncFlightTripDatabaseTests, TestPointQueriesRunOnThePool)
+{
+	ConcurrentFlightTripDatabase database{};
+	LoadHub(database, 10U);
+	WorkStealingThreadPool pool{2U};
+	AsyncFlightTripDatabase async{database, pool};
+
+	auto const flight{SyncWait(async.FindFlightsByNumber("6E-202"))};
+	EXPECT_EQ(QueryStatus::kOk, flight.status);
+	ASSERT_TRUE(flight.value.has_value());
+	EXPECT_EQ("IndiGo", flight.value->GetOperator());
+
+	EXPECT_EQ(1000U, SyncWait(async.FindMinFareBetweenCities("Pune", "Delhi")).value);
+	EXPECT_EQ(UINT_MAX, SyncWait(async.FindMinFareBetweenCities("Pune", "Goa")).value);
+	EXPECT_EQ(1009U, SyncWait(async.FindMaxFareByOperator("Air India")).value);
+	EXPECT_EQ(database.FindAverageCostOfAllTrips(), SyncWait(async.FindAverageCostOfAllTrips()).value);
+	EXPECT_EQ(10U, SyncWait(async.FindFlightsByOriginCity("Pune")).value.size());
+}
+
+TEST(AsyncFlightTripDatabaseTests, TestScansStreamInChunks)
+{
+	ConcurrentFlightTripDatabase database{};
+	LoadHub(database, 2500U);
+	WorkStealingThreadPool pool{2U};
+	AsyncFlightTripDatabase async{database, pool, 1000U};
+
+	QueryContext const context{};
+	std::vector<std::size_t> const expected{1000U, 1000U, 500U};
+	EXPECT_EQ(expected, SyncWait(ChunkSizes(async.StreamFlightsByOriginCity("Pune", context), context, 0U)));
+	EXPECT_TRUE(SyncWait(ChunkSizes(async.StreamFlightsByOriginCity("Goa", context), context, 0U)).empty());
+
+	auto const flights{SyncWait(async.FindFlightsByOriginCity("Pune"))};
+	EXPECT_EQ(QueryStatus::kOk, flights.status);
+	EXPECT_EQ(2500U, flights.value.size());
+}
+
+TEST(AsyncFlightTripDatabaseTests, TestCancellationAndDeadlines)
+{
+	ConcurrentFlightTripDatabase database{};
+	LoadHub(database, 2500U);
+	WorkStealingThreadPool pool{1U};
+	AsyncFlightTripDatabase async{database, pool, 1000U};
+
+	QueryContext const cancelled{};
+	cancelled.Cancel();
+	auto const fare{SyncWait(async.FindMinFareBetweenCities("Pune", "Delhi", cancelled))};
+	EXPECT_EQ(QueryStatus::kCancelled, fare.status);
+	EXPECT_EQ(UINT_MAX, fare.value);
+
+	auto const expired{SyncWait(async.FindFlightsByOriginCity("Pune", QueryContext::WithTimeout(std::chrono::seconds{0})))};
+	EXPECT_EQ(QueryStatus::kDeadlineExceeded, expired.status);
+	EXPECT_TRUE(expired.value.empty());
+
+	// Cancelled by the consumer after the first chunk: the scan stops at its next check.
+	QueryContext const context{};
+	EXPECT_EQ(std::vector<std::size_t>{1000U},
+			  SyncWait(ChunkSizes(async.StreamFlightsByOriginCity("Pune", context), context, 1U)));
+}
+
+TEST(AsyncFlightTripDatabaseTests, TestSpawnedRequestsCompleteOnWorkers)
+{
+	ConcurrentFlightTripDatabase database{};
+	LoadHub(database, 100U);
+
+	for (std::size_t threads : {0U, 3U})
+	{
+		WorkStealingThreadPool pool{threads};
+		AsyncFlightTripDatabase async{database, pool, 16U};
+		std::atomic<std::size_t> rows{0U};
+		std::atomic<std::size_t> completed{0U};
+
+		for (int request = 0; request < 50; ++request)
+		{
+			Spawn(async.FindFlightsByOriginCity("Pune"), [&rows, &completed](AsyncResult<std::vector<FlightData>> result) {
+				rows.fetch_add(result.value.size());
+				completed.fetch_add(1U);
+			});
+		}
+
+		while (completed.load() != 50U)
+		{
+			std::this_thread::yield();
+		}
+		EXPECT_EQ(5000U, rows.load());
+	}
+}
+
+} // namespace flight_management
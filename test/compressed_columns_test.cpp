@@ -0,0 +1,141 @@
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "compressed_columns.h"
+
+namespace flight_management
+{
+
+TEST(CompressedColumnsTests, TestPackedBlocksRoundTripAtEveryWidth)
+{
+	std::mt19937 random{7U};
+
+	for (std::uint32_t width = 0U; width <= 32U; ++width)
+	{
+		std::vector<std::uint32_t> values(kPackedBlockSize);
+		for (auto &value : values)
+		{
+			value = static_cast<std::uint32_t>(random()) & PackedMask(width);
+		}
+
+		std::vector<std::uint32_t> words(PackedBlockWords(width));
+		PackBlock(values.data(), width, words.data());
+
+		std::vector<std::uint32_t> unpacked(kPackedBlockSize);
+		UnpackBlock(words.data(), width, 5U, unpacked.data());
+
+		for (std::size_t index = 0U; index < kPackedBlockSize; ++index)
+		{
+			ASSERT_EQ(values[index] + 5U, unpacked[index]) << "width " << width << " index " << index;
+			ASSERT_EQ(values[index], UnpackValue(words.data(), width, index));
+		}
+	}
+}
+
+TEST(CompressedColumnsTests, TestColumnScansMatchTheValues)
+{
+	std::vector<std::uint32_t> fares{};
+	for (std::uint32_t row = 0U; row < 1000U; ++row)
+	{
+		fares.push_back(1000U + (row * 7919U) % 9000U);
+	}
+	fares[300] = 0U;
+	fares[777] = UINT32_MAX;
+
+	CompressedColumn const column{fares.data(), fares.size()};
+
+	ASSERT_EQ(fares.size(), column.Size());
+	for (std::size_t row = 0U; row < fares.size(); ++row)
+	{
+		ASSERT_EQ(fares[row], column.Get(row));
+	}
+	EXPECT_EQ(std::accumulate(fares.begin(), fares.end(), std::uint64_t{0U}), column.Sum());
+	EXPECT_LT(column.GetByteSize(), fares.size() * sizeof(std::uint32_t));
+
+	// Dense runs unpack whole blocks, lone rows are read singly; both must agree with Get.
+	std::vector<std::uint32_t> rows{};
+	for (std::uint32_t row = 0U; row < 1000U; row += (row < 400U) ? 1U : 97U)
+	{
+		rows.push_back(row);
+	}
+	std::vector<std::uint32_t> gathered(rows.size());
+	column.Gather(rows.data(), rows.size(), gathered.data());
+	for (std::size_t index = 0U; index < rows.size(); ++index)
+	{
+		ASSERT_EQ(fares[rows[index]], gathered[index]) << "row " << rows[index];
+	}
+
+	CompressedColumn const empty{};
+	EXPECT_EQ(0U, empty.Sum());
+	empty.Gather(rows.data(), 0U, gathered.data());
+}
+
+TEST(CompressedColumnsTests, TestPostingsDecodeAndIntersect)
+{
+	std::vector<TripId> dense(1000U);
+	std::iota(dense.begin(), dense.end(), 0U);
+	std::vector<TripId> sparse{3U, 500U, 501U, 999U, 5000U};
+	std::vector<TripId> far{100000U, 4000000000U};
+
+	CompressedPostings postings{};
+	postings.Append(dense.data(), dense.size());
+	postings.Append(sparse.data(), sparse.size());
+	postings.Append(nullptr, 0U);
+	postings.Append(far.data(), far.size());
+
+	ASSERT_EQ(4U, postings.GetKeyCount());
+	EXPECT_EQ(1000U, postings.GetEntryCount(0U));
+	EXPECT_EQ(0U, postings.GetEntryCount(2U));
+	EXPECT_EQ(0U, postings.GetEntryCount(7U));
+
+	std::vector<TripId> decoded{};
+	postings.ForEach(3U, [&decoded](TripId trip) { decoded.push_back(trip); });
+	EXPECT_EQ(far, decoded);
+
+	std::vector<TripId> common{};
+	IntersectPostings(postings, 0U, postings, 1U, [&common](TripId trip) { common.push_back(trip); });
+	EXPECT_EQ((std::vector<TripId>{3U, 500U, 501U, 999U}), common);
+
+	common.clear();
+	IntersectPostings(postings, 1U, postings, 2U, [&common](TripId trip) { common.push_back(trip); });
+	IntersectPostings(postings, 0U, postings, 3U, [&common](TripId trip) { common.push_back(trip); });
+	EXPECT_TRUE(common.empty());
+}
+
+TEST(CompressedColumnsTests, TestIntersectionMatchesUncompressedLists)
+{
+	std::mt19937 random{11U};
+	std::vector<TripId> lhs{};
+	std::vector<TripId> rhs{};
+
+	for (TripId trip = 0U; trip < 200000U; ++trip)
+	{
+		if (random() % 3U == 0U)
+		{
+			lhs.push_back(trip);
+		}
+		if (random() % 50U == 0U)
+		{
+			rhs.push_back(trip);
+		}
+	}
+
+	CompressedPostings postings{};
+	postings.Append(lhs.data(), lhs.size());
+	postings.Append(rhs.data(), rhs.size());
+
+	std::vector<TripId> expected{};
+	std::set_intersection(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::back_inserter(expected));
+
+	std::vector<TripId> common{};
+	IntersectPostings(postings, 0U, postings, 1U, [&common](TripId trip) { common.push_back(trip); });
+	EXPECT_EQ(expected, common);
+	EXPECT_LT(postings.GetByteSize(), (lhs.size() + rhs.size()) * sizeof(TripId) / 2U);
+}
+
+} // namespace flight_management
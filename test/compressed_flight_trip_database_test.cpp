@@ -0,0 +1,126 @@
+#include "gtest/gtest.h"
+
+#include <climits>
+#include <string>
+
+#include "compressed_flight_trip_database.h"
+
+namespace flight_management
+{
+
+class CompressedFlightTripDatabaseTests : public ::testing::Test
+{
+public:
+	void SetUp() override
+	{
+		database_.AddTrip("AI-855", "Delhi", "Pune", "Air India", 2345);
+		database_.AddTrip("AI-856", "Pune", "Delhi", "Air India", 7646);
+		database_.AddTrip("SJ-356", "Delhi", "Pune", "Spice", 1000);
+		database_.AddTrip("IG-856", "Delhi", "Chennai", "Indigo", 4699);
+		database_.AddTrip("IG-857", "Delhi", "Chennai", "Indigo", 4100);
+		database_.RemoveTrip("IG-857");
+		database_.AddTrip("SJ-357", "Delhi", "Pune", "Spice", 900);
+		database_.RemoveTrip("SJ-357");
+		database_.AddTrip("SJ-357", "Mumbai", "Pune", "Spice", 950);
+	}
+
+protected:
+	FlightTripDatabase database_{};
+};
+
+TEST_F(CompressedFlightTripDatabaseTests, TestQueriesMatchTheLiveDatabase)
+{
+	CompressedFlightTripDatabase const compressed{database_};
+
+	EXPECT_EQ(database_.GetTripCount(), compressed.GetTripCount());
+	EXPECT_TRUE(compressed.IsTripInDatabase("AI-855"));
+	EXPECT_FALSE(compressed.IsTripInDatabase("IG-857"));
+	EXPECT_FALSE(compressed.IsTripInDatabase("XX-000"));
+	EXPECT_TRUE(FlightData("SJ-357", "Mumbai", "Pune", "Spice", 950) == compressed.FindFlightsByNumber("SJ-357"));
+	EXPECT_EQ(std::nullopt, compressed.FindFlightsByNumber("IG-857"));
+
+	auto const expected{database_.FindFlightsByOriginCity("Delhi")};
+	auto const flights{compressed.FindFlightsByOriginCity("Delhi")};
+	ASSERT_EQ(expected.size(), flights.size());
+	EXPECT_TRUE(std::equal(expected.begin(), expected.end(), flights.begin()));
+	EXPECT_TRUE(compressed.FindFlightsByOriginCity("Goa").empty());
+
+	auto const by_destination{compressed.FindFlightsByDestinationCity("Pune")};
+	ASSERT_EQ(3U, by_destination.size());
+	EXPECT_TRUE(FlightData("AI-855", "Delhi", "Pune", "Air India", 2345) == by_destination[0]);
+	EXPECT_TRUE(FlightData("SJ-356", "Delhi", "Pune", "Spice", 1000) == by_destination[1]);
+	EXPECT_TRUE(FlightData("SJ-357", "Mumbai", "Pune", "Spice", 950) == by_destination[2]);
+	EXPECT_TRUE(compressed.FindFlightsByDestinationCity("Goa").empty());
+
+	auto const by_operator{compressed.FindFlightsByOperator("Indigo")};
+	ASSERT_EQ(1U, by_operator.size());
+	EXPECT_TRUE(FlightData("IG-856", "Delhi", "Chennai", "Indigo", 4699) == by_operator[0]);
+	EXPECT_TRUE(compressed.FindFlightsByOperator("Vistara").empty());
+
+	EXPECT_EQ(1000U, compressed.FindMinFareBetweenCities("Delhi", "Pune"));
+	EXPECT_EQ(950U, compressed.FindMinFareBetweenCities("Mumbai", "Pune"));
+	EXPECT_EQ(UINT_MAX, compressed.FindMinFareBetweenCities("Chennai", "Delhi"));
+	EXPECT_EQ(UINT_MAX, compressed.FindMinFareBetweenCities("Goa", "Delhi"));
+	EXPECT_EQ(7646U, compressed.FindMaxFareByOperator("Air India"));
+	EXPECT_EQ(4699U, compressed.FindMaxFareByOperator("Indigo"));
+	EXPECT_EQ(0U, compressed.FindMaxFareByOperator("Vistara"));
+	EXPECT_EQ(database_.FindAverageCostOfAllTrips(), compressed.FindAverageCostOfAllTrips());
+}
+
+TEST_F(CompressedFlightTripDatabaseTests, TestLargeScheduleCompressesAndAgrees)
+{
+	FlightTripDatabase database{};
+	char const *const cities[]{"Delhi", "Pune", "Mumbai", "Chennai", "Goa", "Kolkata"};
+	char const *const operators[]{"Air India", "Spice", "Indigo"};
+
+	for (std::uint32_t trip = 0U; trip < 20000U; ++trip)
+	{
+		database.AddTrip("FL-" + std::to_string(trip), cities[trip % 6U], cities[(trip / 6U) % 6U],
+						 operators[trip % 3U], 1000U + (trip * 7919U) % 9000U);
+	}
+	for (std::uint32_t trip = 0U; trip < 20000U; trip += 7U)
+	{
+		database.RemoveTrip("FL-" + std::to_string(trip));
+	}
+
+	CompressedFlightTripDatabase const compressed{database};
+
+	// The live database has no destination or operator lookup, so count them off the origin lists.
+	auto const count_flights{[&database, &cities](auto &&matches) {
+		std::size_t count{0U};
+		for (char const *const origin : cities)
+		{
+			for (auto const &flight : database.FindFlightsByOriginCity(origin))
+			{
+				count += matches(flight) ? 1U : 0U;
+			}
+		}
+		return count;
+	}};
+
+	EXPECT_EQ(database.FindAverageCostOfAllTrips(), compressed.FindAverageCostOfAllTrips());
+	for (char const *const origin : cities)
+	{
+		EXPECT_EQ(database.FindFlightsByOriginCity(origin).size(), compressed.FindFlightsByOriginCity(origin).size());
+		EXPECT_EQ(count_flights([origin](const FlightData &flight) { return flight.GetDestinationCity() == origin; }),
+				  compressed.FindFlightsByDestinationCity(origin).size());
+		for (char const *const destination : cities)
+		{
+			EXPECT_EQ(database.FindMinFareBetweenCities(origin, destination),
+					  compressed.FindMinFareBetweenCities(origin, destination));
+		}
+	}
+	for (char const *const flight_operator : operators)
+	{
+		EXPECT_EQ(database.FindMaxFareByOperator(flight_operator), compressed.FindMaxFareByOperator(flight_operator));
+		EXPECT_EQ(count_flights([flight_operator](const FlightData &flight) {
+					  return flight.GetOperator() == flight_operator;
+				  }),
+				  compressed.FindFlightsByOperator(flight_operator).size());
+	}
+
+	// Five 32-bit columns and three full postings would be 32 bytes a trip.
+	EXPECT_LT(compressed.GetStorageBytes(), 10U * 20000U);
+}
+
+} // namespace flight_management
@@ -0,0 +1,130 @@
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "concurrent_flight_trip_database.h"
+
+namespace flight_management
+{
+
+TEST(ConcurrentFlightTripDatabaseTests, TestMutationsArePublished)
+{
+	ConcurrentFlightTripDatabase database{};
+
+	EXPECT_TRUE(database.AddTrip("AI-855", "Pune", "Delhi", "Air India", 4500));
+	EXPECT_FALSE(database.AddTrip("AI-855", "Pune", "Delhi", "Air India", 4500));
+	EXPECT_TRUE(database.UpdateFareByTrip("AI-855", 3900));
+
+	EXPECT_EQ(3900U, database.FindFlightsByNumber("AI-855").value().GetAirFare());
+	EXPECT_EQ(3900U, database.FindMinFareBetweenCities("Pune", "Delhi"));
+	EXPECT_EQ(3900U, database.FindMaxFareByOperator("Air India"));
+	EXPECT_EQ(1U, database.FindFlightsByOriginCity("Pune").size());
+
+	EXPECT_TRUE(database.RemoveTrip("AI-855"));
+	EXPECT_FALSE(database.IsTripInDatabase("AI-855"));
+	EXPECT_EQ(0U, database.FindAverageCostOfAllTrips());
+}
+
+TEST(ConcurrentFlightTripDatabaseTests, TestSnapshotIsIsolatedFromLaterBatches)
+{
+	ConcurrentFlightTripDatabase database{};
+	database.AddTrip("AI-855", "Pune", "Delhi", "Air India", 4500);
+
+	auto const snapshot{database.GetSnapshot()};
+
+	std::vector<TripMutation> batch{TripMutation::UpdateFare("AI-855", 1000),
+									TripMutation::AddTrip("SJ-356", "Pune", "Delhi", "Spice", 800)};
+	EXPECT_EQ(2U, database.Publish(batch));
+
+	EXPECT_EQ(4500U, snapshot->FindMinFareBetweenCities("Pune", "Delhi"));
+	EXPECT_FALSE(snapshot->IsTripInDatabase("SJ-356"));
+	EXPECT_EQ(800U, database.FindMinFareBetweenCities("Pune", "Delhi"));
+
+	database.UpdateFareByTrip("SJ-356", 2000);
+	EXPECT_EQ(1000U, database.FindMinFareBetweenCities("Pune", "Delhi"));
+	EXPECT_TRUE(database.GetSnapshot()->CheckAggregateConsistency());
+}
+
+TEST(ConcurrentFlightTripDatabaseTests, TestReadersSeeWholeBatches)
+{
+	ConcurrentFlightTripDatabase database{};
+	database.AddTrip("AI-855", "Pune", "Delhi", "Air India", 5000);
+	database.AddTrip("SJ-356", "Delhi", "Pune", "Spice", 5000);
+
+	std::atomic<bool> done{false};
+	std::atomic<std::size_t> torn_reads{0U};
+
+	std::vector<std::thread> readers{};
+	for (std::size_t reader = 0U; reader < 4U; ++reader)
+	{
+		readers.emplace_back([&database, &done, &torn_reads]() {
+			while (!done.load())
+			{
+				auto const snapshot{database.GetSnapshot()};
+				std::uint32_t const total{snapshot->FindMinFareBetweenCities("Pune", "Delhi") +
+										  snapshot->FindMinFareBetweenCities("Delhi", "Pune")};
+				if (total != 10000U || !snapshot->CheckAggregateConsistency())
+				{
+					++torn_reads;
+				}
+			}
+		});
+	}
+
+	for (std::uint32_t fare = 0U; fare < 2000U; ++fare)
+	{
+		database.Publish({TripMutation::UpdateFare("AI-855", 4000U + fare % 2000U),
+						  TripMutation::UpdateFare("SJ-356", 6000U - fare % 2000U)});
+	}
+
+	done = true;
+	for (auto &reader : readers)
+	{
+		reader.join();
+	}
+
+	EXPECT_EQ(0U, torn_reads.load());
+}
+
+TEST(ConcurrentFlightTripDatabaseTests, TestPinnedSnapshotIsNotCopiedPerBatch)
+{
+	ConcurrentFlightTripDatabase database{};
+	database.AddTrip("AI-855", "Pune", "Delhi", "Air India", 4500);
+
+	auto pinned{database.GetSnapshot()};
+
+	for (std::uint32_t fare = 1U; fare <= 100U; ++fare)
+	{
+		database.UpdateFareByTrip("AI-855", fare);
+		database.AddTrip("FL-" + std::to_string(fare), "Delhi", "Pune", "Spice", 1000U + fare);
+	}
+
+	// The pinned snapshot cost one extra copy, not one per batch.
+	EXPECT_EQ(3U, database.GetVersionCount());
+	EXPECT_EQ(4500U, pinned->FindMinFareBetweenCities("Pune", "Delhi"));
+	EXPECT_FALSE(pinned->IsTripInDatabase("FL-1"));
+
+	// Released, it is replayed up to date and reused instead of copied.
+	pinned.reset();
+	database.RemoveTrip("FL-1");
+	database.UpdateFareByTrip("AI-855", 7);
+	database.RemoveTrip("FL-2");
+
+	EXPECT_EQ(2U, database.GetVersionCount());
+	auto const snapshot{database.GetSnapshot()};
+	EXPECT_EQ(7U, snapshot->FindMinFareBetweenCities("Pune", "Delhi"));
+	EXPECT_FALSE(snapshot->IsTripInDatabase("FL-2"));
+	EXPECT_EQ(98U, snapshot->FindFlightsByOriginCity("Delhi").size());
+	EXPECT_TRUE(snapshot->CheckAggregateConsistency());
+
+	// The standby, replayed from the pending batches, agrees with the snapshot.
+	database.UpdateFareByTrip("FL-3", 3);
+	EXPECT_EQ(3U, database.FindMinFareBetweenCities("Delhi", "Pune"));
+	EXPECT_EQ(98U, database.FindFlightsByOriginCity("Delhi").size());
+	EXPECT_TRUE(database.GetSnapshot()->CheckAggregateConsistency());
+}
+
+} // namespace flight_management
@@ -0,0 +1,158 @@
+#include "gtest/gtest.h"
+
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+
+#include "database_stats.h"
+#include "flight_trip_database.h"
+#include "latency_histogram.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+OperationStats const &Operation(const DatabaseStats &stats, StatsOperation operation)
+{
+	return stats.operations[static_cast<std::size_t>(operation)];
+}
+
+} // namespace
+
+TEST(LatencyHistogramTests, TestBucketsKeepSixteenthPrecision)
+{
+	for (std::uint64_t value : {0ULL, 1ULL, 15ULL, 16ULL, 17ULL, 1000ULL, 123456789ULL, 1ULL << 40U})
+	{
+		std::size_t const bucket{LatencyHistogram::BucketOf(value)};
+		EXPECT_LT(bucket, LatencyHistogram::kBucketCount);
+		EXPECT_GE(LatencyHistogram::HighestOf(bucket), value);
+		EXPECT_LE(LatencyHistogram::HighestOf(bucket) - value, value / LatencyHistogram::kSubBuckets);
+	}
+
+	EXPECT_EQ(LatencyHistogram::kBucketCount - 1U, LatencyHistogram::BucketOf(UINT64_MAX));
+	EXPECT_EQ(UINT64_MAX, LatencyHistogram::HighestOf(LatencyHistogram::kBucketCount - 1U));
+}
+
+TEST(LatencyHistogramTests, TestQuantiles)
+{
+	LatencyHistogram histogram{};
+	EXPECT_EQ(0U, histogram.ValueAtQuantile(0.5));
+
+	for (std::uint64_t value = 1U; value <= 1000U; ++value)
+	{
+		histogram.Record(value * 1000U);
+	}
+
+	EXPECT_EQ(1000U, histogram.GetCount());
+	EXPECT_EQ(500500000U, histogram.GetSum());
+	EXPECT_EQ(1000000U, histogram.GetMax());
+	EXPECT_NEAR(500000.0, static_cast<double>(histogram.ValueAtQuantile(0.5)), 500000.0 / 16.0);
+	EXPECT_NEAR(990000.0, static_cast<double>(histogram.ValueAtQuantile(0.99)), 990000.0 / 16.0);
+	EXPECT_EQ(1000000U, histogram.ValueAtQuantile(1.0));
+}
+
+TEST(CountingMemoryResourceTests, TestCountsAndForwards)
+{
+	CountingMemoryResource resource{std::pmr::new_delete_resource()};
+
+	{
+		std::pmr::vector<int> values{&resource};
+		values.reserve(100U);
+		EXPECT_EQ(1U, resource.GetAllocations());
+		EXPECT_EQ(100U * sizeof(int), resource.GetOutstandingBytes());
+	}
+
+	EXPECT_EQ(1U, resource.GetAllocations());
+	EXPECT_EQ(0U, resource.GetOutstandingBytes());
+	EXPECT_EQ(std::pmr::new_delete_resource(), resource.GetUpstream());
+}
+
+TEST(DatabaseStatsTests, TestStatsFollowTheBuildFlag)
+{
+	FlightTripDatabase database{};
+	database.AddTrip("AI-101", "Pune", "Delhi", "Air India", 5000U);
+	database.AddTrip("6E-202", "Pune", "Delhi", "IndiGo", 4200U);
+	database.AddTrip("AI-101", "Pune", "Delhi", "Air India", 5000U);
+	database.FindFlightsByNumber("AI-101");
+	database.FindFlightsByNumber("XX-000");
+	database.FindFlightsByOriginCity("Pune");
+	database.FindMinFareBetweenCities("Pune", "Delhi");
+	database.RemoveTrip("6E-202");
+
+	DatabaseStats const stats{database.GetStats()};
+	EXPECT_EQ(kStatsEnabled, stats.enabled);
+	EXPECT_EQ(database.GetIndexStatistics().live_entries, stats.index_entries.live_entries);
+	EXPECT_EQ(database.GetIndexStatistics().dead_entries, stats.index_entries.dead_entries);
+
+	if constexpr (kStatsEnabled)
+	{
+		EXPECT_EQ(3U, Operation(stats, StatsOperation::kAddTrip).count);
+		EXPECT_EQ(2U, Operation(stats, StatsOperation::kAddTrip).result_rows);
+		EXPECT_EQ(2U, Operation(stats, StatsOperation::kFindByNumber).count);
+		EXPECT_EQ(1U, Operation(stats, StatsOperation::kFindByNumber).result_rows);
+		EXPECT_EQ(2U, Operation(stats, StatsOperation::kFindByOriginCity).result_rows);
+		EXPECT_EQ(1U, Operation(stats, StatsOperation::kMinFareBetweenCities).count);
+		EXPECT_EQ(1U, Operation(stats, StatsOperation::kRemoveTrip).count);
+		EXPECT_EQ(0U, Operation(stats, StatsOperation::kBulkLoad).count);
+		EXPECT_GT(Operation(stats, StatsOperation::kAddTrip).index_probes, 0U);
+		EXPECT_GE(Operation(stats, StatsOperation::kAddTrip).max_nanoseconds,
+				  Operation(stats, StatsOperation::kAddTrip).p50_nanoseconds);
+		EXPECT_GT(stats.allocations, 0U);
+		EXPECT_GT(stats.storage_bytes, 0U);
+		EXPECT_GT(stats.index_bytes, 0U);
+	}
+	else
+	{
+		for (auto const &operation : stats.operations)
+		{
+			EXPECT_EQ(0U, operation.count);
+		}
+		EXPECT_EQ(0U, stats.allocations);
+		EXPECT_TRUE(std::is_empty_v<StatsHandle>);
+		EXPECT_TRUE(std::is_empty_v<OperationScope>);
+	}
+}
+
+TEST(DatabaseStatsTests, TestCopiesStartWithEmptyStats)
+{
+	FlightTripDatabase database{};
+	database.AddTrip("AI-101", "Pune", "Delhi", "Air India", 5000U);
+
+	FlightTripDatabase const copy{database};
+	EXPECT_EQ(0U, Operation(copy.GetStats(), StatsOperation::kAddTrip).count);
+	EXPECT_EQ(std::pmr::get_default_resource(), copy.GetMemoryResource());
+	EXPECT_EQ(5000U, copy.FindMinFareBetweenCities("Pune", "Delhi"));
+	EXPECT_TRUE(copy.CheckAggregateConsistency());
+
+	if constexpr (kStatsEnabled)
+	{
+		EXPECT_GT(copy.GetStats().storage_bytes, 0U);
+	}
+}
+
+TEST(DatabaseStatsTests, TestPrometheusFormat)
+{
+	DatabaseStats stats{};
+	stats.operations[static_cast<std::size_t>(StatsOperation::kFindByNumber)].count = 7U;
+	stats.operations[static_cast<std::size_t>(StatsOperation::kFindByNumber)].total_nanoseconds = 3500000000U;
+	stats.operations[static_cast<std::size_t>(StatsOperation::kFindByNumber)].result_rows = 5U;
+	stats.allocations = 42U;
+	stats.index_entries.dead_entries = 3U;
+
+	std::string const text{FormatPrometheus(stats, "fm")};
+
+	EXPECT_NE(std::string::npos, text.find("# TYPE fm_operation_latency_seconds summary\n"));
+	EXPECT_NE(std::string::npos, text.find("fm_operation_latency_seconds_count{operation=\"find_by_number\"} 7\n"));
+	EXPECT_NE(std::string::npos, text.find("fm_operation_latency_seconds_sum{operation=\"find_by_number\"} 3.5\n"));
+	EXPECT_NE(std::string::npos,
+			  text.find("fm_operation_latency_seconds{operation=\"add_trip\",quantile=\"0.99\"} 0\n"));
+	EXPECT_NE(std::string::npos, text.find("fm_result_rows_total{operation=\"find_by_number\"} 5\n"));
+	EXPECT_NE(std::string::npos, text.find("# TYPE fm_allocations_total counter\nfm_allocations_total 42\n"));
+	EXPECT_NE(std::string::npos, text.find("fm_memory_bytes{area=\"indexes\"} 0\n"));
+	EXPECT_NE(std::string::npos, text.find("fm_index_entries{state=\"dead\"} 3\n"));
+	EXPECT_EQ("execute_batch", StatsOperationName(StatsOperation::kExecuteBatch));
+}
+
+} // namespace flight_management
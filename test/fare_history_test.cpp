@@ -0,0 +1,249 @@
+#include "gtest/gtest.h"
+
+#include <climits>
+#include <string>
+#include <vector>
+
+#include "fare_history.h"
+#include "flight_trip_database.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+TripState Live(InternId origin, InternId destination, InternId flight_operator, std::uint32_t fare)
+{
+	return TripState{origin, destination, flight_operator, fare, true};
+}
+
+bool SameState(const TripState &lhs, const TripState &rhs)
+{
+	return lhs.live == rhs.live && (!lhs.live || (lhs.origin == rhs.origin && lhs.destination == rhs.destination &&
+												  lhs.flight_operator == rhs.flight_operator && lhs.fare == rhs.fare));
+}
+
+} // namespace
+
+TEST(FareHistoryTests, TestStateAtWalksBackThroughChanges)
+{
+	FareHistory history{};
+	history.RecordInsert(0U);                     // v1
+	history.RecordFareChange(0U, 5000U, 4500U);   // v2
+	history.RecordFareChange(0U, 4500U, 4500U);   // no change, no version
+	history.RecordFareChange(0U, 4500U, 6000U);   // v3
+	history.RecordRemoval(0U, Live(1U, 2U, 3U, 6000U)); // v4
+	history.RecordInsert(0U);                     // v5, back on another route
+	history.RecordFareChange(0U, 100U, 90U);      // v6
+
+	TripState const current{Live(7U, 8U, 9U, 90U)};
+	EXPECT_EQ(6U, history.GetVersion());
+
+	EXPECT_FALSE(history.StateAt(0U, current, 0U).live);
+	EXPECT_TRUE(SameState(Live(1U, 2U, 3U, 5000U), history.StateAt(0U, current, 1U)));
+	EXPECT_TRUE(SameState(Live(1U, 2U, 3U, 4500U), history.StateAt(0U, current, 2U)));
+	EXPECT_TRUE(SameState(Live(1U, 2U, 3U, 6000U), history.StateAt(0U, current, 3U)));
+	EXPECT_FALSE(history.StateAt(0U, current, 4U).live);
+	EXPECT_TRUE(SameState(Live(7U, 8U, 9U, 100U), history.StateAt(0U, current, 5U)));
+	EXPECT_TRUE(SameState(current, history.StateAt(0U, current, 6U)));
+
+	std::vector<TripId> displaced{};
+	history.ForEachDisplaced([&displaced](TripId trip) { displaced.push_back(trip); });
+	EXPECT_EQ(std::vector<TripId>{0U}, displaced);
+}
+
+TEST(FareHistoryTests, TestInsertOnlyTripsTakeNoLogBytes)
+{
+	FareHistory history{};
+	history.RecordBulkInsert({0U, 1U, 2U});
+	history.RecordInsert(3U);
+
+	EXPECT_EQ(2U, history.GetVersion());
+	EXPECT_EQ(0U, history.GetLogBytes());
+	EXPECT_FALSE(history.StateAt(3U, Live(1U, 2U, 3U, 10U), 1U).live);
+	EXPECT_TRUE(history.StateAt(2U, Live(1U, 2U, 3U, 10U), 1U).live);
+	EXPECT_TRUE(history.StateAt(9U, Live(1U, 2U, 3U, 10U), 0U).live);
+}
+
+TEST(FareHistoryTests, TestCollectDropsVersionsOutsideTheRetentionWindow)
+{
+	FareHistory history{};
+	history.SetRetention(10U);
+	history.RecordInsert(0U);
+
+	std::uint32_t fare{1000U};
+	for (int change = 0; change < 100; ++change)
+	{
+		history.RecordFareChange(0U, fare, fare + 1U);
+		++fare;
+	}
+	history.RecordRemoval(1U, Live(1U, 2U, 3U, 7U));
+
+	std::size_t const before{history.GetLogBytes()};
+	EXPECT_GT(history.Collect(), 0U);
+	EXPECT_LT(history.GetLogBytes(), before);
+	EXPECT_EQ(history.GetVersion() - 10U, history.GetOldestVersion());
+
+	TripState const current{Live(1U, 2U, 3U, fare)};
+	EXPECT_EQ(fare - 9U, history.StateAt(0U, current, history.GetOldestVersion() - 1U).fare);
+	EXPECT_EQ(fare - 9U, history.StateAt(0U, current, history.GetOldestVersion()).fare);
+	EXPECT_EQ(fare - 1U, history.StateAt(0U, current, history.GetVersion() - 2U).fare);
+	EXPECT_TRUE(history.StateAt(1U, TripState{}, history.GetVersion() - 1U).live);
+}
+
+TEST(FareHistoryTests, TestPointInTimeQueries)
+{
+	FlightTripDatabase database{};
+	database.AddTrip("AI-101", "Pune", "Delhi", "Air India", 5000U);
+	database.AddTrip("6E-202", "Pune", "Delhi", "IndiGo", 4200U);
+	database.AddTrip("SG-303", "Pune", "Mumbai", "SpiceJet", 3100U);
+	FareVersion const loaded{database.GetFareVersion()};
+
+	database.UpdateFareByTrip("AI-101", 3900U);
+	FareVersion const discounted{database.GetFareVersion()};
+
+	database.RemoveTrip("6E-202");
+	database.RemoveTrip("SG-303");
+	database.AddTrip("SG-303", "Delhi", "Goa", "SpiceJet", 2800U);
+	database.UpdateFaresByOperator("Air India", 10);
+
+	EXPECT_EQ(4290U, database.FindMinFareBetweenCities("Pune", "Delhi"));
+	EXPECT_EQ(4200U, database.FindMinFareBetweenCities("Pune", "Delhi", loaded));
+	EXPECT_EQ(3900U, database.FindMinFareBetweenCities("Pune", "Delhi", discounted));
+	EXPECT_EQ(UINT_MAX, database.FindMinFareBetweenCities("Pune", "Delhi", 0U));
+	EXPECT_EQ("6E-202", database.FindCheapestFlightBetweenCities("Pune", "Delhi", loaded)->GetFlightNumber());
+
+	EXPECT_EQ(3100U, database.FindMinFareBetweenCities("Pune", "Mumbai", discounted));
+	EXPECT_EQ(UINT_MAX, database.FindMinFareBetweenCities("Pune", "Mumbai"));
+	EXPECT_EQ(UINT_MAX, database.FindMinFareBetweenCities("Delhi", "Goa", discounted));
+
+	auto const sg303{database.FindFlightsByNumber("SG-303", loaded)};
+	ASSERT_TRUE(sg303.has_value());
+	EXPECT_EQ("Mumbai", sg303->GetDestinationCity());
+	EXPECT_EQ("Goa", database.FindFlightsByNumber("SG-303", database.GetFareVersion())->GetDestinationCity());
+	EXPECT_FALSE(database.FindFlightsByNumber("6E-202", database.GetFareVersion()).has_value());
+	EXPECT_FALSE(database.FindFlightsByNumber("XX-000", loaded).has_value());
+
+	EXPECT_EQ(3U, database.FindFlightsByOriginCity("Pune", loaded).size());
+	EXPECT_EQ(1U, database.FindFlightsByOriginCity("Pune", database.GetFareVersion()).size());
+	EXPECT_EQ(5000U, database.FindMaxFareByOperator("Air India", loaded));
+	EXPECT_EQ(4290U, database.FindMaxFareByOperator("Air India", database.GetFareVersion()));
+	EXPECT_EQ(4200U, database.FindMaxFareByOperator("IndiGo", discounted));
+	EXPECT_EQ(0U, database.FindMaxFareByOperator("IndiGo", database.GetFareVersion()));
+}
+
+TEST(FareHistoryTests, TestVersionedReadsMatchRecordedAnswers)
+{
+	FlightTripDatabase database{};
+	database.SetFareHistoryRetention(400U);
+
+	std::vector<std::string> const cities{"Pune", "Delhi", "Mumbai", "Goa"};
+	std::vector<std::string> const operators{"Air India", "IndiGo", "SpiceJet"};
+
+	struct Recorded
+	{
+		FareVersion version;
+		std::vector<std::uint32_t> min_fares;
+		std::vector<std::uint32_t> max_fares;
+		std::size_t pune_flights;
+	};
+
+	auto record = [&]() {
+		Recorded recorded{database.GetFareVersion(), {}, {}, database.FindFlightsByOriginCity("Pune").size()};
+		for (auto const &origin : cities)
+		{
+			for (auto const &destination : cities)
+			{
+				recorded.min_fares.push_back(database.FindMinFareBetweenCities(origin, destination));
+			}
+		}
+		for (auto const &flight_operator : operators)
+		{
+			recorded.max_fares.push_back(database.FindMaxFareByOperator(flight_operator));
+		}
+		return recorded;
+	};
+
+	auto matches = [&](const Recorded &recorded) {
+		std::size_t route{0U};
+		bool result{database.FindFlightsByOriginCity("Pune", recorded.version).size() == recorded.pune_flights};
+		for (auto const &origin : cities)
+		{
+			for (auto const &destination : cities)
+			{
+				result = result && database.FindMinFareBetweenCities(origin, destination, recorded.version) ==
+									   recorded.min_fares[route++];
+			}
+		}
+		for (std::size_t index = 0U; index < operators.size(); ++index)
+		{
+			result = result && database.FindMaxFareByOperator(operators[index], recorded.version) ==
+								   recorded.max_fares[index];
+		}
+		return result;
+	};
+
+	std::vector<Recorded> recorded{};
+	std::uint32_t state{2463534242U};
+
+	for (int step = 0; step < 600; ++step)
+	{
+		state ^= state << 13U;
+		state ^= state >> 17U;
+		state ^= state << 5U;
+
+		std::string const flight_number{"FL-" + std::to_string(state % 40U)};
+		switch ((state >> 8U) % 4U)
+		{
+		case 0U:
+			database.RemoveTrip(flight_number);
+			break;
+		case 1U:
+			database.UpdateFaresByOperator(operators[(state >> 12U) % operators.size()], -5);
+			break;
+		default:
+			if (!database.UpdateFareByTrip(flight_number, 1000U + (state >> 16U) % 5000U))
+			{
+				database.AddTrip(flight_number, cities[(state >> 4U) % cities.size()],
+								 cities[(state >> 6U) % cities.size()], operators[(state >> 10U) % operators.size()],
+								 1000U + (state >> 12U) % 5000U);
+			}
+			break;
+		}
+
+		if (step % 20 == 0)
+		{
+			recorded.push_back(record());
+		}
+	}
+
+	database.CollectFareHistory();
+
+	std::size_t checked{0U};
+	for (auto const &answers : recorded)
+	{
+		if (answers.version >= database.GetOldestFareVersion())
+		{
+			EXPECT_TRUE(matches(answers)) << "at version " << answers.version;
+			++checked;
+		}
+	}
+	EXPECT_GT(checked, 5U);
+	EXPECT_LT(checked, recorded.size());
+	EXPECT_TRUE(matches(record()));
+	EXPECT_TRUE(database.CheckAggregateConsistency());
+}
+
+TEST(FareHistoryTests, TestSchemasWithoutHistoryReportNoVersions)
+{
+	MinimalFlightTripDatabase database{};
+	database.AddTrip("AI-101", "Pune", "Delhi", "Air India", 5000U);
+	database.UpdateFareByTrip("AI-101", 4000U);
+
+	EXPECT_EQ(0U, database.GetFareVersion());
+	EXPECT_EQ(0U, database.CollectFareHistory());
+	static_assert(!MinimalTripSchema::kHas<FareHistoryIndex>);
+}
+
+} // namespace flight_management
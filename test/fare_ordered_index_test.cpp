@@ -0,0 +1,39 @@
+#include "gtest/gtest.h"
+
+#include "fare_ordered_index.h"
+
+namespace flight_management
+{
+
+TEST(FareOrderedIndexTests, TestMinAndMaxTrackRemovals)
+{
+	FareOrderedIndex<InternId> index{};
+
+	EXPECT_TRUE(index.Add(7U, 4500U, 1U));
+	EXPECT_TRUE(index.Add(7U, 1200U, 2U));
+	EXPECT_TRUE(index.Add(7U, 9900U, 3U));
+	EXPECT_FALSE(index.Add(7U, 9900U, 3U));
+
+	EXPECT_EQ(FareEntry(1200U, 2U), index.FindMin(7U).value());
+	EXPECT_EQ(FareEntry(9900U, 3U), index.FindMax(7U).value());
+
+	EXPECT_TRUE(index.Remove(7U, 1200U, 2U));
+	EXPECT_FALSE(index.Remove(7U, 1200U, 2U));
+	EXPECT_EQ(FareEntry(4500U, 1U), index.FindMin(7U).value());
+
+	EXPECT_TRUE(index.UpdateFare(7U, 9900U, 100U, 3U));
+	EXPECT_EQ(FareEntry(100U, 3U), index.FindMin(7U).value());
+	EXPECT_EQ(FareEntry(4500U, 1U), index.FindMax(7U).value());
+}
+
+TEST(FareOrderedIndexTests, TestMissingKey)
+{
+	FareOrderedIndex<RouteKey> index{};
+	index.Add(MakeRouteKey(1U, 2U), 4500U, 1U);
+	index.Remove(MakeRouteKey(1U, 2U), 4500U, 1U);
+
+	EXPECT_EQ(std::nullopt, index.FindMin(MakeRouteKey(1U, 2U)));
+	EXPECT_EQ(std::nullopt, index.FindMax(MakeRouteKey(2U, 1U)));
+}
+
+} // namespace flight_management
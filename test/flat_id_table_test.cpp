@@ -0,0 +1,79 @@
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+#include "flat_id_table.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+// Every id hashes alike, so all of them share one probe sequence and tag.
+std::size_t CollidingHash(InternId)
+{
+	return 0x55U;
+}
+
+} // namespace
+
+TEST(FlatIdTableTests, TestFindAfterGrowth)
+{
+	std::vector<std::string> keys{};
+	FlatIdTable table{};
+	auto const hash_of = [&keys](InternId id) { return std::hash<std::string>{}(keys[id]); };
+
+	for (InternId id = 0U; id < 10000U; ++id)
+	{
+		keys.push_back("FL-" + std::to_string(id));
+		table.Insert(hash_of(id), id, hash_of);
+	}
+
+	EXPECT_EQ(10000U, table.Size());
+	EXPECT_LE(table.Size() * 8U, table.GetCapacity() * 7U);
+
+	for (InternId id = 0U; id < keys.size(); ++id)
+	{
+		std::string const &key{keys[id]};
+		ASSERT_EQ(id, table.Find(std::hash<std::string>{}(key), [&keys, &key](InternId other) {
+			return keys[other] == key;
+		}));
+	}
+
+	std::string const missing{"XX-000"};
+	EXPECT_EQ(kInvalidInternId, table.Find(std::hash<std::string>{}(missing), [&keys, &missing](InternId other) {
+		return keys[other] == missing;
+	}));
+}
+
+TEST(FlatIdTableTests, TestCollidingHashesProbeAcrossGroups)
+{
+	FlatIdTable table{};
+	for (InternId id = 0U; id < 100U; ++id)
+	{
+		table.Insert(CollidingHash(id), id, CollidingHash);
+	}
+
+	for (InternId id = 0U; id < 100U; ++id)
+	{
+		EXPECT_EQ(id, table.Find(CollidingHash(id), [id](InternId other) { return other == id; }));
+	}
+	EXPECT_EQ(kInvalidInternId, table.Find(0x55U, [](InternId other) { return other == 100U; }));
+}
+
+TEST(FlatIdTableTests, TestEmptyAndCleared)
+{
+	FlatIdTable table{};
+	EXPECT_EQ(kInvalidInternId, table.Find(42U, [](InternId) { return true; }));
+
+	table.Insert(42U, 0U, [](InternId) { return std::size_t{42U}; });
+	EXPECT_EQ(0U, table.Find(42U, [](InternId) { return true; }));
+
+	table.Clear();
+	EXPECT_EQ(0U, table.Size());
+	EXPECT_EQ(kInvalidInternId, table.Find(42U, [](InternId) { return true; }));
+}
+
+} // namespace flight_management
@@ -1,7 +1,9 @@
 #include "gtest/gtest.h"
 
+#include <cstdint>
 #include <vector>
 #include <optional>
+#include <string>
 
 #include "flight_trip_database.h"
 
@@ -62,7 +64,17 @@ public:
 		return database_->FindMinFareBetweenCities(origin, destination);
 	}
 
-private:
+	bool AggregatesConsistent() const noexcept
+	{
+		return database_->CheckAggregateConsistency();
+	}
+
+	std::optional<FlightData> CheapestFlight(const std::string &origin, const std::string &destination) const noexcept
+	{
+		return database_->FindCheapestFlightBetweenCities(origin, destination);
+	}
+
+protected:
 	std::unique_ptr<flight_management::FlightTripDatabase> database_;
 };
 
@@ -140,6 +152,22 @@ TEST_F(FlightTripDataBaseTests, TestDisplayDatabase)
 	Display();
 }
 
+TEST_F(FlightTripDataBaseTests, TestDisplayDatabaseSortedByFlightNumber)
+{
+	Add("SJ-356", "Delhi", "Mumbai", "Spice", 1000);
+	Add("AI-855", "Mumbai", "Delhi", "Air India", 4500);
+
+	testing::internal::CaptureStdout();
+	database_->DisplayAllTrips();
+	std::string const row_order{testing::internal::GetCapturedStdout()};
+	EXPECT_LT(row_order.find("SJ-356"), row_order.find("AI-855"));
+
+	testing::internal::CaptureStdout();
+	database_->DisplayAllTrips(TripOrder::kByFlightNumber);
+	std::string const sorted{testing::internal::GetCapturedStdout()};
+	EXPECT_LT(sorted.find("AI-855"), sorted.find("SJ-356"));
+}
+
 TEST_F(FlightTripDataBaseTests, TestFindFlightsByOriginCity)
 {
 	const std::string origin_city{"Delhi"};
@@ -266,4 +294,360 @@ TEST_F(FlightTripDataBaseTests, TestFindMinFareBetweenCities)
 	EXPECT_TRUE(minimum_fare == min_cost_from_database);
 }
 
+TEST_F(FlightTripDataBaseTests, TestReAddRemovedTrip)
+{
+	Add("AI-855", "Mumbai", "Delhi", "Air India", 4500);
+	EXPECT_TRUE(Remove("AI-855"));
+	EXPECT_TRUE(FindFlights("Mumbai").empty());
+
+	EXPECT_TRUE(Add("AI-855", "Pune", "Chennai", "Air India", 3900));
+	EXPECT_TRUE(FindFlights("Mumbai").empty());
+	EXPECT_EQ(1U, FindFlights("Pune").size());
+	EXPECT_EQ(3900U, Find("AI-855").value().GetAirFare());
+}
+
+TEST_F(FlightTripDataBaseTests, TestOperatorIsNotIndexedAsOriginCity)
+{
+	Add("AI-855", "Mumbai", "Delhi", "Air India", 4500);
+
+	EXPECT_TRUE(FindFlights("Air India").empty());
+	EXPECT_EQ(4500U, MaxFareByOperator("Air India"));
+}
+
+TEST_F(FlightTripDataBaseTests, TestFindMinFareBetweenCitiesAfterReAdd)
+{
+	Add("AI-855", "Delhi", "Pune", "Air India", 1000);
+	Add("AI-856", "Delhi", "Mumbai", "Air India", 2000);
+	Remove("AI-855");
+	Add("AI-855", "Delhi", "Pune", "Air India", 1500);
+
+	EXPECT_EQ(1500U, MinFareBetweenCities("Delhi", "Pune"));
+}
+
+TEST_F(FlightTripDataBaseTests, TestFindMinFareBetweenCitiesAfterRemovingMinimum)
+{
+	Add("AI-855", "Delhi", "Pune", "Air India", 2345);
+	Add("SJ-356", "Delhi", "Pune", "Spice", 1000);
+	Add("IG-856", "Delhi", "Pune", "Indigo", 4699);
+
+	EXPECT_EQ(1000U, MinFareBetweenCities("Delhi", "Pune"));
+
+	Remove("SJ-356");
+	EXPECT_EQ(2345U, MinFareBetweenCities("Delhi", "Pune"));
+
+	Remove("AI-855");
+	Remove("IG-856");
+	EXPECT_EQ(UINT_MAX, MinFareBetweenCities("Delhi", "Pune"));
+}
+
+TEST_F(FlightTripDataBaseTests, TestFindMinFareBetweenCitiesAfterUpdate)
+{
+	Add("AI-855", "Delhi", "Pune", "Air India", 2345);
+	Add("SJ-356", "Delhi", "Pune", "Spice", 1000);
+
+	Update("SJ-356", 3000);
+	EXPECT_EQ(2345U, MinFareBetweenCities("Delhi", "Pune"));
+
+	Update("AI-855", 900);
+	EXPECT_EQ(900U, MinFareBetweenCities("Delhi", "Pune"));
+	EXPECT_EQ(UINT_MAX, MinFareBetweenCities("Pune", "Delhi"));
+}
+
+TEST_F(FlightTripDataBaseTests, TestFindCheapestFlightBetweenCities)
+{
+	FlightData cheapest{"SJ-356", "Delhi", "Pune", "Spice", 1000};
+
+	Add("AI-855", "Delhi", "Pune", "Air India", 2345);
+	Add("SJ-356", "Delhi", "Pune", "Spice", 1000);
+
+	EXPECT_TRUE(cheapest == CheapestFlight("Delhi", "Pune"));
+	EXPECT_TRUE(std::nullopt == CheapestFlight("Pune", "Delhi"));
+	EXPECT_TRUE(std::nullopt == CheapestFlight("Delhi", "Goa"));
+}
+
+TEST_F(FlightTripDataBaseTests, TestFindAverageCostOfAllTripsDoesNotOverflow)
+{
+	const std::uint32_t expensive_fare{3000000000U};
+
+	Add("AI-855", "Pune", "Delhi", "Air India", expensive_fare);
+	Add("AI-856", "Pune", "Delhi", "Air India", expensive_fare);
+
+	EXPECT_EQ(expensive_fare, AverageCost());
+	EXPECT_TRUE(AggregatesConsistent());
+}
+
+TEST_F(FlightTripDataBaseTests, TestFindAverageCostOfEmptyDatabase)
+{
+	EXPECT_EQ(0U, AverageCost());
+
+	Add("AI-855", "Pune", "Delhi", "Air India", 4500);
+	Remove("AI-855");
+	EXPECT_EQ(0U, AverageCost());
+}
+
+TEST_F(FlightTripDataBaseTests, TestFindMaxFareByOperatorAfterRemoveAndUpdate)
+{
+	Add("AI-855", "Pune", "Delhi", "Air India", 2345);
+	Add("AI-856", "Pune", "Delhi", "Air India", 9900);
+	Add("AI-857", "Banglore", "Delhi", "Air India", 7646);
+
+	Remove("AI-856");
+	EXPECT_EQ(7646U, MaxFareByOperator("Air India"));
+
+	Update("AI-855", 8000);
+	EXPECT_EQ(8000U, MaxFareByOperator("Air India"));
+	EXPECT_EQ(0U, MaxFareByOperator("Spice"));
+}
+
+TEST_F(FlightTripDataBaseTests, TestAggregatesConsistentUnderChurn)
+{
+	const std::vector<std::string> cities{"Pune", "Delhi", "Mumbai", "Chennai"};
+	const std::vector<std::string> operators{"Air India", "Spice", "Indigo"};
+
+	for (std::uint32_t index = 0U; index < 200U; ++index)
+	{
+		const std::string flight_number{"FL-" + std::to_string(index % 50U)};
+
+		switch (index % 3U)
+		{
+		case 0U:
+			Add(flight_number, cities[index % 4U], cities[(index + 1U) % 4U], operators[index % 3U], 1000U + index * 7U);
+			break;
+		case 1U:
+			Update(flight_number, 500U + index * 13U);
+			break;
+		default:
+			Remove(flight_number);
+			break;
+		}
+
+		ASSERT_TRUE(AggregatesConsistent());
+	}
+}
+
+TEST_F(FlightTripDataBaseTests, TestUpdateFaresByOperatorPercentage)
+{
+	Add("AI-855", "Delhi", "Pune", "Air India", 5000);
+	Add("AI-856", "Pune", "Delhi", "Air India", 9900);
+	Add("SJ-356", "Delhi", "Pune", "Spice", 4800);
+
+	EXPECT_EQ(2U, database_->UpdateFaresByOperator("Air India", -10));
+
+	EXPECT_EQ(4500U, Find("AI-855").value().GetAirFare());
+	EXPECT_EQ(8910U, MaxFareByOperator("Air India"));
+	EXPECT_EQ(4500U, MinFareBetweenCities("Delhi", "Pune"));
+	EXPECT_EQ(4800U, Find("SJ-356").value().GetAirFare());
+	EXPECT_TRUE(AggregatesConsistent());
+
+	EXPECT_EQ(0U, database_->UpdateFaresByOperator("Indigo", -10));
+	EXPECT_EQ(2U, database_->UpdateFaresByOperator("Air India", FarePercentage{-100}));
+	EXPECT_EQ(0U, MinFareBetweenCities("Delhi", "Pune"));
+}
+
+TEST_F(FlightTripDataBaseTests, TestUpdateFaresByOperatorExtremePercentages)
+{
+	Add("AI-855", "Delhi", "Pune", "Air India", 5000);
+	Add("AI-856", "Pune", "Delhi", "Air India", 1);
+
+	EXPECT_EQ(2U, database_->UpdateFaresByOperator("Air India", FarePercentage{INT32_MAX}));
+	EXPECT_EQ(UINT32_MAX, Find("AI-855").value().GetAirFare());
+	EXPECT_EQ(21474837U, Find("AI-856").value().GetAirFare());
+	EXPECT_TRUE(AggregatesConsistent());
+
+	EXPECT_EQ(UINT32_MAX, FarePercentage{INT32_MAX}(UINT32_MAX));
+	EXPECT_EQ(0U, FarePercentage{INT32_MIN}(UINT32_MAX));
+	EXPECT_EQ(0U, FarePercentage{-150}(5000));
+	EXPECT_EQ(899U, FarePercentage{-10}(999));
+	EXPECT_EQ(0U, FarePercentage{-1}(1));
+
+	EXPECT_EQ(2U, database_->UpdateFaresByOperator("Air India", FarePercentage{INT32_MIN}));
+	EXPECT_EQ(0U, MaxFareByOperator("Air India"));
+	EXPECT_TRUE(AggregatesConsistent());
+}
+
+TEST_F(FlightTripDataBaseTests, TestUpdateFaresByOperatorFunctor)
+{
+	Add("AI-855", "Delhi", "Pune", "Air India", 5000);
+	Add("AI-856", "Pune", "Delhi", "Air India", 9900);
+	Remove("AI-856");
+
+	EXPECT_EQ(1U, database_->UpdateFaresByOperator("Air India", [](std::uint32_t fare) { return fare + 250U; }));
+	EXPECT_EQ(5250U, Find("AI-855").value().GetAirFare());
+	EXPECT_EQ(5250U, AverageCost());
+	EXPECT_TRUE(AggregatesConsistent());
+}
+
+TEST_F(FlightTripDataBaseTests, TestUpdateFaresByOperators)
+{
+	Add("AI-855", "Delhi", "Pune", "Air India", 5000);
+	Add("SJ-356", "Delhi", "Pune", "Spice", 4000);
+	Add("IG-856", "Delhi", "Pune", "Indigo", 4600);
+	Remove("IG-856");
+
+	std::vector<std::pair<std::string, FarePercentage>> adjustments{
+		{"Air India", FarePercentage{-10}}, {"Spice", FarePercentage{25}}, {"Indigo", FarePercentage{-50}},
+		{"Vistara", FarePercentage{-50}}};
+
+	EXPECT_EQ(2U, database_->UpdateFaresByOperators(adjustments));
+	EXPECT_EQ(4500U, Find("AI-855").value().GetAirFare());
+	EXPECT_EQ(5000U, MaxFareByOperator("Spice"));
+	EXPECT_EQ(4500U, MinFareBetweenCities("Delhi", "Pune"));
+	EXPECT_TRUE(AggregatesConsistent());
+}
+
+TEST_F(FlightTripDataBaseTests, TestRemoveLeavesTombstonesUntilCompaction)
+{
+	Add("AI-855", "Mumbai", "Delhi", "Air India", 4500);
+	Add("AI-856", "Mumbai", "Pune", "Air India", 3000);
+	EXPECT_EQ(6U, database_->GetIndexStatistics().live_entries);
+
+	Remove("AI-855");
+	IndexStatistics statistics{database_->GetIndexStatistics()};
+	EXPECT_EQ(3U, statistics.live_entries);
+	EXPECT_EQ(3U, statistics.dead_entries);
+	EXPECT_EQ(1U, FindFlights("Mumbai").size());
+	EXPECT_EQ(1U, database_->UpdateFaresByOperator("Air India", 10));
+
+	// Re-adding under a new origin revives the destination and operator entries only.
+	Add("AI-855", "Pune", "Delhi", "Air India", 4000);
+	statistics = database_->GetIndexStatistics();
+	EXPECT_EQ(6U, statistics.live_entries);
+	EXPECT_EQ(1U, statistics.dead_entries);
+	EXPECT_EQ(1U, FindFlights("Mumbai").size());
+
+	EXPECT_EQ(1U, database_->CompactIndexes());
+	statistics = database_->GetIndexStatistics();
+	EXPECT_EQ(6U, statistics.live_entries);
+	EXPECT_EQ(0U, statistics.dead_entries);
+	EXPECT_EQ(1U, statistics.compactions);
+	EXPECT_EQ(1U, FindFlights("Pune").size());
+}
+
+TEST_F(FlightTripDataBaseTests, TestChurnTriggersCompaction)
+{
+	for (std::uint32_t day = 0U; day < 4U; ++day)
+	{
+		for (std::uint32_t index = 0U; index < 1000U; ++index)
+		{
+			Add("FL-" + std::to_string(index), day % 2U ? "Pune" : "Delhi", "Mumbai", "Indigo", 1000U + index);
+		}
+		for (std::uint32_t index = 0U; index < 1000U; ++index)
+		{
+			Remove("FL-" + std::to_string(index));
+		}
+	}
+
+	IndexStatistics const statistics{database_->GetIndexStatistics()};
+	EXPECT_GT(statistics.compactions, 0U);
+	EXPECT_LT(statistics.dead_entries, 3000U);
+	EXPECT_EQ(0U, statistics.live_entries);
+	EXPECT_TRUE(FindFlights("Delhi").empty());
+	EXPECT_TRUE(AggregatesConsistent());
+}
+
+TEST_F(FlightTripDataBaseTests, TestViewFlightsByOriginCity)
+{
+	Add("AI-855", "Delhi", "Pune", "Air India", 2345);
+	Add("SJ-356", "Delhi", "Mumbai", "Spice", 1000);
+	Add("IG-856", "Pune", "Delhi", "Indigo", 4699);
+	Add("IG-857", "Delhi", "Chennai", "Indigo", 4100);
+	Remove("IG-857");
+
+	auto const expected{FindFlights("Delhi")};
+	std::vector<FlightData> viewed{};
+	for (TripView const trip : database_->ViewFlightsByOriginCity("Delhi"))
+	{
+		EXPECT_EQ("Delhi", trip.GetOriginCity());
+		viewed.push_back(trip.ToFlightData());
+	}
+
+	ASSERT_EQ(2U, viewed.size());
+	EXPECT_TRUE(std::equal(expected.begin(), expected.end(), viewed.begin()));
+	EXPECT_TRUE(database_->ViewFlightsByOriginCity("Goa").empty());
+	EXPECT_TRUE(database_->ViewFlightsByOriginCity("Chennai").empty());
+}
+
+TEST_F(FlightTripDataBaseTests, TestViewFlightByNumber)
+{
+	Add("AI-855", "Delhi", "Pune", "Air India", 2345);
+
+	auto const trip{database_->ViewFlightByNumber("AI-855")};
+	ASSERT_TRUE(trip.has_value());
+	EXPECT_EQ("AI-855", trip->GetFlightNumber());
+	EXPECT_EQ("Pune", trip->GetDestinationCity());
+	EXPECT_EQ("Air India", trip->GetOperator());
+	EXPECT_EQ(2345U, trip->GetAirFare());
+
+	Update("AI-855", 2000);
+	EXPECT_EQ(2000U, trip->GetAirFare());
+	EXPECT_FALSE(database_->ViewFlightByNumber("SJ-356").has_value());
+}
+
+TEST_F(FlightTripDataBaseTests, TestFindFlightsByOriginInFareRange)
+{
+	Add("AI-855", "Delhi", "Pune", "Air India", 2345);
+	Add("SJ-356", "Delhi", "Mumbai", "Spice", 1000);
+	Add("IG-856", "Pune", "Delhi", "Indigo", 1500);
+	Add("IG-857", "Delhi", "Chennai", "Indigo", 4100);
+	Add("IG-858", "Delhi", "Goa", "Indigo", 3000);
+
+	auto const flights{database_->FindFlightsByOriginInFareRange("Delhi", 1000, 3000)};
+	ASSERT_EQ(3U, flights.size());
+	EXPECT_EQ("SJ-356", flights[0].GetFlightNumber());
+	EXPECT_EQ("AI-855", flights[1].GetFlightNumber());
+	EXPECT_EQ("IG-858", flights[2].GetFlightNumber());
+
+	Update("IG-857", 1200);
+	Remove("SJ-356");
+	auto const updated{database_->FindFlightsByOriginInFareRange("Delhi", 0, 2000)};
+	ASSERT_EQ(1U, updated.size());
+	EXPECT_EQ("IG-857", updated[0].GetFlightNumber());
+	EXPECT_EQ(1200U, updated[0].GetAirFare());
+
+	EXPECT_TRUE(database_->FindFlightsByOriginInFareRange("Delhi", 5000, 9000).empty());
+	EXPECT_TRUE(database_->FindFlightsByOriginInFareRange("Goa", 0, 9000).empty());
+	EXPECT_TRUE(AggregatesConsistent());
+}
+
+TEST_F(FlightTripDataBaseTests, TestFindTopKCheapest)
+{
+	Add("AI-855", "Delhi", "Pune", "Air India", 2345);
+	Add("SJ-356", "Delhi", "Mumbai", "Spice", 1000);
+	Add("IG-856", "Pune", "Delhi", "Indigo", 1500);
+	Add("IG-857", "Delhi", "Chennai", "Indigo", 4100);
+	Add("IG-858", "Delhi", "Goa", "Indigo", 3000);
+
+	auto const cheapest{database_->FindTopKCheapest("Delhi", 2)};
+	ASSERT_EQ(2U, cheapest.size());
+	EXPECT_EQ("SJ-356", cheapest[0].GetFlightNumber());
+	EXPECT_EQ("AI-855", cheapest[1].GetFlightNumber());
+	EXPECT_EQ(4U, database_->FindTopKCheapest("Delhi", 10).size());
+	EXPECT_TRUE(database_->FindTopKCheapest("Delhi", 0).empty());
+
+	EXPECT_EQ(3U, database_->UpdateFaresByOperator("Indigo", -50));
+	auto const by_operator{database_->FindTopKCheapestByOperator("Indigo", 2)};
+	ASSERT_EQ(2U, by_operator.size());
+	EXPECT_EQ("IG-856", by_operator[0].GetFlightNumber());
+	EXPECT_EQ(750U, by_operator[0].GetAirFare());
+	EXPECT_EQ("IG-858", by_operator[1].GetFlightNumber());
+	EXPECT_EQ(1500U, by_operator[1].GetAirFare());
+	EXPECT_TRUE(database_->FindTopKCheapestByOperator("Vistara", 3).empty());
+	EXPECT_TRUE(AggregatesConsistent());
+}
+
+TEST(FlightDataTests, TestMoveAssignment)
+{
+	FlightData flight{"AI-855", "Delhi", "Pune", "Air India", 2345};
+	FlightData other{};
+
+	other = std::move(flight);
+	EXPECT_EQ("AI-855", other.GetFlightNumber());
+	EXPECT_EQ("Pune", other.GetDestinationCity());
+
+	std::vector<FlightData> flights{};
+	flights.push_back(other);
+	flights.insert(flights.begin(), FlightData{"SJ-356", "Delhi", "Mumbai", "Spice", 1000});
+	EXPECT_EQ("SJ-356", flights.front().GetFlightNumber());
+}
+
 } // namespace flight_management
@@ -0,0 +1,147 @@
+#include "gtest/gtest.h"
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "mapped_flight_trip_database.h"
+
+namespace flight_management
+{
+
+class MappedFlightTripDatabaseTests : public ::testing::Test
+{
+public:
+	void SetUp() override
+	{
+		path_ = ::testing::TempDir() + "mapped_flight_trip_database_test.snapshot";
+
+		database_.AddTrip("AI-855", "Delhi", "Pune", "Air India", 2345);
+		database_.AddTrip("AI-856", "Pune", "Delhi", "Air India", 7646);
+		database_.AddTrip("SJ-356", "Delhi", "Pune", "Spice", 1000);
+		database_.AddTrip("IG-856", "Delhi", "Chennai", "Indigo", 4699);
+		database_.AddTrip("IG-857", "Delhi", "Chennai", "Indigo", 4100);
+		database_.RemoveTrip("IG-857");
+	}
+
+	void TearDown() override
+	{
+		std::remove(path_.c_str());
+	}
+
+protected:
+	std::string path_{};
+	FlightTripDatabase database_{};
+};
+
+TEST_F(MappedFlightTripDatabaseTests, TestQueriesServedFromMapping)
+{
+	ASSERT_TRUE(database_.SaveSnapshot(path_));
+
+	auto const snapshot{FlightTripDatabase::OpenSnapshot(path_)};
+	ASSERT_NE(nullptr, snapshot);
+
+	EXPECT_FALSE(snapshot->IsMaterialized());
+	EXPECT_TRUE(snapshot->IsTripInDatabase("AI-855"));
+	EXPECT_FALSE(snapshot->IsTripInDatabase("IG-857"));
+	EXPECT_FALSE(snapshot->IsTripInDatabase("XX-000"));
+	EXPECT_TRUE(FlightData("SJ-356", "Delhi", "Pune", "Spice", 1000) == snapshot->FindFlightsByNumber("SJ-356"));
+	EXPECT_EQ(std::nullopt, snapshot->FindFlightsByNumber("IG-857"));
+
+	auto const expected{database_.FindFlightsByOriginCity("Delhi")};
+	auto const flights{snapshot->FindFlightsByOriginCity("Delhi")};
+	ASSERT_EQ(expected.size(), flights.size());
+	EXPECT_TRUE(std::equal(expected.begin(), expected.end(), flights.begin()));
+
+	EXPECT_EQ(1000U, snapshot->FindMinFareBetweenCities("Delhi", "Pune"));
+	EXPECT_EQ(UINT_MAX, snapshot->FindMinFareBetweenCities("Chennai", "Delhi"));
+	EXPECT_EQ(7646U, snapshot->FindMaxFareByOperator("Air India"));
+	EXPECT_EQ(0U, snapshot->FindMaxFareByOperator("Vistara"));
+	EXPECT_EQ(database_.FindAverageCostOfAllTrips(), snapshot->FindAverageCostOfAllTrips());
+	EXPECT_FALSE(snapshot->IsMaterialized());
+}
+
+TEST_F(MappedFlightTripDatabaseTests, TestFirstMutationMaterializes)
+{
+	ASSERT_TRUE(database_.SaveSnapshot(path_));
+	auto const snapshot{FlightTripDatabase::OpenSnapshot(path_)};
+	ASSERT_NE(nullptr, snapshot);
+
+	// Misses and no-op updates are answered from the mapping.
+	EXPECT_FALSE(snapshot->RemoveTrip("XX-000"));
+	EXPECT_FALSE(snapshot->RemoveTrip("IG-857"));
+	EXPECT_FALSE(snapshot->UpdateFareByTrip("XX-000", 900));
+	EXPECT_TRUE(snapshot->UpdateFareByTrip("AI-855", 2345));
+	EXPECT_FALSE(snapshot->AddTrip("AI-856", "Pune", "Delhi", "Air India", 7646));
+	EXPECT_FALSE(snapshot->IsMaterialized());
+
+	EXPECT_TRUE(snapshot->UpdateFareByTrip("AI-855", 900));
+	EXPECT_TRUE(snapshot->IsMaterialized());
+	EXPECT_EQ(900U, snapshot->FindMinFareBetweenCities("Delhi", "Pune"));
+
+	EXPECT_TRUE(snapshot->AddTrip("IG-857", "Delhi", "Chennai", "Indigo", 4100));
+	EXPECT_TRUE(snapshot->RemoveTrip("IG-856"));
+	EXPECT_EQ(4100U, snapshot->FindMaxFareByOperator("Indigo"));
+	EXPECT_EQ(3U, snapshot->FindFlightsByOriginCity("Delhi").size());
+
+	auto const reopened{FlightTripDatabase::OpenSnapshot(path_)};
+	ASSERT_NE(nullptr, reopened);
+	EXPECT_EQ(2345U, reopened->FindFlightsByNumber("AI-855")->GetAirFare());
+}
+
+TEST_F(MappedFlightTripDatabaseTests, TestEmptyDatabaseSnapshot)
+{
+	ASSERT_TRUE(FlightTripDatabase{}.SaveSnapshot(path_));
+	auto const snapshot{FlightTripDatabase::OpenSnapshot(path_)};
+	ASSERT_NE(nullptr, snapshot);
+
+	EXPECT_EQ(0U, snapshot->FindAverageCostOfAllTrips());
+	EXPECT_TRUE(snapshot->FindFlightsByOriginCity("Delhi").empty());
+}
+
+TEST_F(MappedFlightTripDatabaseTests, TestRejectsCorruptOrMissingFiles)
+{
+	EXPECT_EQ(nullptr, FlightTripDatabase::OpenSnapshot(path_));
+
+	ASSERT_TRUE(database_.SaveSnapshot(path_));
+	{
+		std::fstream file{path_, std::ios::in | std::ios::out | std::ios::binary};
+		file.seekp(-4, std::ios::end);
+		file.put('\x7f');
+	}
+	EXPECT_EQ(nullptr, FlightTripDatabase::OpenSnapshot(path_));
+	EXPECT_NE(nullptr, MappedFlightTripDatabase::Open(path_, false));
+
+	// The header's aggregates are covered by the checksum too.
+	ASSERT_TRUE(database_.SaveSnapshot(path_));
+	{
+		std::fstream file{path_, std::ios::in | std::ios::out | std::ios::binary};
+		std::uint64_t const trip_count{1000000U};
+		file.seekp(offsetof(SnapshotHeader, trip_count));
+		file.write(reinterpret_cast<const char *>(&trip_count), sizeof(trip_count));
+	}
+	EXPECT_EQ(nullptr, FlightTripDatabase::OpenSnapshot(path_));
+
+	// An offsets array running past its section is refused even unchecksummed.
+	ASSERT_TRUE(database_.SaveSnapshot(path_));
+	{
+		std::fstream file{path_, std::ios::in | std::ios::out | std::ios::binary};
+		SnapshotHeader header{};
+		file.read(reinterpret_cast<char *>(&header), sizeof(header));
+		std::uint32_t const offset{UINT32_MAX};
+		file.seekp(static_cast<std::streamoff>(header.sections[kCityOffsets].offset + sizeof(std::uint32_t)));
+		file.write(reinterpret_cast<const char *>(&offset), sizeof(offset));
+	}
+	EXPECT_EQ(nullptr, MappedFlightTripDatabase::Open(path_, false));
+
+	{
+		std::ofstream file{path_, std::ios::binary | std::ios::trunc};
+		file << "FLTSNAP";
+	}
+	EXPECT_EQ(nullptr, FlightTripDatabase::OpenSnapshot(path_));
+}
+
+} // namespace flight_management
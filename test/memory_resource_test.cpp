@@ -0,0 +1,107 @@
+#include "gtest/gtest.h"
+
+#include <memory_resource>
+#include <string>
+
+#include "flight_trip_database.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+	std::size_t GetAllocations() const noexcept
+	{
+		return allocations_;
+	}
+
+	std::size_t GetOutstandingBytes() const noexcept
+	{
+		return outstanding_bytes_;
+	}
+
+private:
+	void *do_allocate(std::size_t bytes, std::size_t alignment) override
+	{
+		++allocations_;
+		outstanding_bytes_ += bytes;
+		return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+	}
+
+	void do_deallocate(void *memory, std::size_t bytes, std::size_t alignment) override
+	{
+		outstanding_bytes_ -= bytes;
+		std::pmr::new_delete_resource()->deallocate(memory, bytes, alignment);
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+	{
+		return this == &other;
+	}
+
+	std::size_t allocations_{0U};
+	std::size_t outstanding_bytes_{0U};
+};
+
+void AddTrips(FlightTripDatabase &database)
+{
+	for (std::uint32_t index = 0U; index < 100U; ++index)
+	{
+		database.AddTrip("FLIGHT-NUMBER-" + std::to_string(index), index % 2U ? "Thiruvananthapuram" : "Pune",
+						 "Visakhapatnam", "Air India Express Limited", 1000U + index);
+	}
+}
+
+} // namespace
+
+TEST(MemoryResourceTests, TestAllStorageComesFromTheResource)
+{
+	CountingResource resource{};
+	{
+		FlightTripDatabase database{&resource};
+		EXPECT_EQ(&resource, database.GetMemoryResource());
+
+		// Anything still reaching for the default resource would abort here.
+		std::pmr::memory_resource *const previous{std::pmr::set_default_resource(std::pmr::null_memory_resource())};
+		AddTrips(database);
+		database.RemoveTrip("FLIGHT-NUMBER-7");
+		database.UpdateFareByTrip("FLIGHT-NUMBER-8", 500U);
+		std::pmr::set_default_resource(previous);
+
+		EXPECT_LT(0U, resource.GetAllocations());
+		EXPECT_LT(0U, resource.GetOutstandingBytes());
+		EXPECT_EQ(500U, database.FindMinFareBetweenCities("Pune", "Visakhapatnam"));
+		EXPECT_TRUE(database.CheckAggregateConsistency());
+	}
+
+	EXPECT_EQ(0U, resource.GetOutstandingBytes());
+}
+
+TEST(MemoryResourceTests, TestMonotonicArena)
+{
+	std::unique_ptr<FlightTripDatabase> copy{};
+	{
+		auto database{FlightTripDatabase::WithMonotonicArena(1U << 12U)};
+		EXPECT_NE(std::pmr::get_default_resource(), database.GetMemoryResource());
+
+		AddTrips(database);
+		EXPECT_TRUE(database.RemoveTrip("FLIGHT-NUMBER-3"));
+		EXPECT_TRUE(database.AddTrip("FLIGHT-NUMBER-3", "Pune", "Delhi", "Spice", 700U));
+		EXPECT_EQ(700U, database.FindMinFareBetweenCities("Pune", "Delhi"));
+		EXPECT_EQ(1099U, database.FindMaxFareByOperator("Air India Express Limited"));
+		EXPECT_TRUE(database.CheckAggregateConsistency());
+
+		copy = std::make_unique<FlightTripDatabase>(database);
+	}
+
+	EXPECT_EQ(std::pmr::get_default_resource(), copy->GetMemoryResource());
+	EXPECT_EQ(100U, copy->GetTripCount());
+	EXPECT_TRUE(copy->IsTripInDatabase("FLIGHT-NUMBER-99"));
+	EXPECT_TRUE(copy->CheckAggregateConsistency());
+}
+
+} // namespace flight_management
@@ -0,0 +1,177 @@
+#include "gtest/gtest.h"
+
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "flight_trip_database.h"
+#include "mutation_stream.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+// A downstream fare cache kept in sync from the stream alone.
+void ApplyToCache(std::map<std::string, std::uint32_t> &cache, const TripMutation &mutation)
+{
+	switch (mutation.kind)
+	{
+	case MutationKind::kAddTrip:
+	case MutationKind::kUpdateFare:
+		cache[mutation.flight_number] = mutation.fare;
+		break;
+	case MutationKind::kRemoveTrip:
+		cache.erase(mutation.flight_number);
+		break;
+	}
+}
+
+} // namespace
+
+TEST(MutationStreamTests, TestDatabasePublishesEveryMutation)
+{
+	MutationStream stream{64U};
+	auto subscription{stream.Subscribe(OverflowPolicy::kBlock)};
+	ASSERT_TRUE(subscription.has_value());
+
+	FlightTripDatabase database{};
+	database.SetMutationStream(&stream);
+	database.AddTrip("AI-101", "Pune", "Delhi", "Air India", 5000U);
+	database.AddTrip("AI-101", "Pune", "Delhi", "Air India", 5000U);
+	database.AddTrip("6E-202", "Pune", "Mumbai", "IndiGo", 4200U);
+	database.BulkLoad({{"SG-303", "Delhi", "Goa", "SpiceJet", 3100U}, {"AI-404", "Goa", "Pune", "Air India", 2000U}});
+	database.UpdateFareByTrip("6E-202", 4000U);
+	database.UpdateFareByTrip("XX-000", 4000U);
+	database.RemoveTrip("SG-303");
+	database.UpdateFaresByOperator("Air India", 10);
+
+	std::vector<TripMutation> batch{};
+	EXPECT_EQ(8U, subscription->GetLag());
+	EXPECT_EQ(3U, subscription->Poll(batch, 3U));
+	EXPECT_EQ(5U, subscription->Poll(batch, 100U));
+	EXPECT_EQ(0U, subscription->GetLag());
+
+	ASSERT_EQ(8U, batch.size());
+	EXPECT_EQ(MutationKind::kAddTrip, batch[0].kind);
+	EXPECT_EQ("Delhi", batch[0].destination_city);
+	EXPECT_EQ("Air India", batch[0].flight_operator);
+	EXPECT_EQ(MutationKind::kUpdateFare, batch[4].kind);
+	EXPECT_EQ("6E-202", batch[4].flight_number);
+	EXPECT_EQ(MutationKind::kRemoveTrip, batch[5].kind);
+	EXPECT_EQ("SG-303", batch[5].flight_number);
+
+	std::map<std::string, std::uint32_t> cache{};
+	for (auto const &mutation : batch)
+	{
+		ApplyToCache(cache, mutation);
+	}
+
+	std::map<std::string, std::uint32_t> const expected{{"AI-101", 5500U}, {"6E-202", 4000U}, {"AI-404", 2200U}};
+	EXPECT_EQ(expected, cache);
+
+	database.SetMutationStream(nullptr);
+	database.RemoveTrip("AI-404");
+	EXPECT_EQ(8U, stream.GetPublishedCount());
+}
+
+TEST(MutationStreamTests, TestDetachedConsumerOverrunsAndResyncs)
+{
+	MutationStream stream{4U};
+	auto lagging{stream.Subscribe(OverflowPolicy::kDetach)};
+	ASSERT_TRUE(lagging.has_value());
+
+	for (std::uint32_t fare = 0U; fare < 4U; ++fare)
+	{
+		stream.Publish(TripMutation::UpdateFare("AI-101", fare));
+	}
+	EXPECT_FALSE(lagging->IsOverrun());
+	EXPECT_EQ(4U, lagging->GetLag());
+
+	stream.Publish(TripMutation::UpdateFare("AI-101", 4U));
+	EXPECT_TRUE(lagging->IsOverrun());
+	EXPECT_EQ(0U, lagging->Consume(10U, [](const TripMutation &) {}));
+
+	lagging->Resync();
+	EXPECT_FALSE(lagging->IsOverrun());
+	stream.Publish(TripMutation::UpdateFare("AI-101", 5U));
+
+	std::vector<TripMutation> batch{};
+	EXPECT_EQ(1U, lagging->Poll(batch, 10U));
+	EXPECT_EQ(5U, batch.front().fare);
+}
+
+TEST(MutationStreamTests, TestBlockingConsumersSeeEveryMutationInOrder)
+{
+	constexpr std::uint32_t kMutations{20000U};
+	constexpr std::size_t kConsumers{4U};
+
+	MutationStream stream{8U};
+	std::vector<MutationSubscription> subscriptions{};
+	for (std::size_t consumer = 0U; consumer < kConsumers; ++consumer)
+	{
+		subscriptions.push_back(*stream.Subscribe(OverflowPolicy::kBlock));
+	}
+
+	std::vector<char> in_order(kConsumers, 0);
+	std::vector<std::thread> threads{};
+
+	for (std::size_t consumer = 0U; consumer < kConsumers; ++consumer)
+	{
+		threads.emplace_back([&subscriptions, &in_order, consumer] {
+			std::uint32_t expected{0U};
+			bool result{true};
+
+			while (expected < kMutations)
+			{
+				auto const consumed{subscriptions[consumer].Consume(
+					1U + consumer, [&expected, &result](const TripMutation &mutation) {
+						result = result && mutation.fare == expected++ && mutation.flight_number == "AI-101";
+					})};
+				if (consumed == 0U)
+				{
+					std::this_thread::yield();
+				}
+			}
+			in_order[consumer] = result ? 1 : 0;
+		});
+	}
+
+	for (std::uint32_t fare = 0U; fare < kMutations; ++fare)
+	{
+		stream.Publish(TripMutation::UpdateFare("AI-101", fare));
+	}
+
+	for (auto &thread : threads)
+	{
+		thread.join();
+	}
+
+	EXPECT_EQ(std::vector<char>(kConsumers, 1), in_order);
+}
+
+TEST(MutationStreamTests, TestSubscriptionSlotsAreReleased)
+{
+	MutationStream stream{16U};
+	std::vector<MutationSubscription> subscriptions{};
+
+	for (std::size_t consumer = 0U; consumer < MutationStream::kMaxConsumers; ++consumer)
+	{
+		auto subscription{stream.Subscribe(OverflowPolicy::kDetach)};
+		ASSERT_TRUE(subscription.has_value());
+		subscriptions.push_back(std::move(*subscription));
+	}
+	EXPECT_FALSE(stream.Subscribe(OverflowPolicy::kDetach).has_value());
+
+	subscriptions.pop_back();
+	stream.Publish(TripMutation::RemoveTrip("AI-101"));
+
+	auto late{stream.Subscribe(OverflowPolicy::kBlock)};
+	ASSERT_TRUE(late.has_value());
+	EXPECT_EQ(0U, late->GetLag());
+	EXPECT_EQ(1U, subscriptions.front().GetLag());
+}
+
+} // namespace flight_management
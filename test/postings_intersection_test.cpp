@@ -0,0 +1,49 @@
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#include "common_data.h"
+#include "postings_intersection.h"
+
+namespace flight_management
+{
+
+std::vector<TripId> Intersect(const std::vector<TripId> &lhs, const std::vector<TripId> &rhs)
+{
+	std::vector<TripId> common{};
+	IntersectPostings(lhs, rhs, [&common](TripId trip) { common.push_back(trip); });
+	return common;
+}
+
+TEST(PostingsIntersectionTests, TestIntersectEmpty)
+{
+	EXPECT_TRUE(Intersect({}, {}).empty());
+	EXPECT_TRUE(Intersect({1U, 2U, 3U}, {}).empty());
+}
+
+TEST(PostingsIntersectionTests, TestIntersectSkewedLists)
+{
+	std::vector<TripId> longer{};
+	for (TripId trip = 0U; trip < 1000U; trip += 2U)
+	{
+		longer.push_back(trip);
+	}
+
+	std::vector<TripId> expected{0U, 2U, 998U};
+	EXPECT_EQ(expected, Intersect({0U, 1U, 2U, 501U, 998U, 999U}, longer));
+	EXPECT_EQ(expected, Intersect(longer, {0U, 1U, 2U, 501U, 998U, 999U}));
+}
+
+TEST(PostingsIntersectionTests, TestGallopLowerBound)
+{
+	std::vector<TripId> values{1U, 3U, 5U, 7U, 9U, 11U, 13U};
+	const TripId *first{values.data()};
+	const TripId *last{values.data() + values.size()};
+
+	EXPECT_EQ(first, GallopLowerBound(first, last, 0U));
+	EXPECT_EQ(first + 3, GallopLowerBound(first, last, 6U));
+	EXPECT_EQ(first + 6, GallopLowerBound(first, last, 13U));
+	EXPECT_EQ(last, GallopLowerBound(first, last, 14U));
+}
+
+} // namespace flight_management
@@ -0,0 +1,111 @@
+#include "gtest/gtest.h"
+
+#include <climits>
+#include <string>
+
+#include "flight_trip_database.h"
+#include "query_batch.h"
+#include "work_stealing_thread_pool.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+template <typename Database>
+void AddTrips(Database &database)
+{
+	database.AddTrip("AI-101", "Pune", "Delhi", "Air India", 5000U);
+	database.AddTrip("6E-202", "Pune", "Delhi", "IndiGo", 4200U);
+	database.AddTrip("SG-303", "Delhi", "Pune", "SpiceJet", 3900U);
+	database.AddTrip("AI-404", "Pune", "Mumbai", "Air India", 3100U);
+}
+
+QueryBatch MakeBatch()
+{
+	QueryBatch batch{};
+	batch.AddMinFareBetweenCities("Pune", "Delhi");
+	batch.AddMaxFareByOperator("Air India");
+	batch.AddMinFareBetweenCities("Delhi", "Pune");
+	batch.AddMinFareBetweenCities("Pune", "Delhi");
+	batch.AddMaxFareByOperator("Vistara");
+	batch.AddMinFareBetweenCities("Pune", "Goa");
+	batch.AddMinFareBetweenCities("Delhi", "Mumbai");
+	batch.AddMaxFareByOperator("Air India");
+	return batch;
+}
+
+} // namespace
+
+TEST(QueryBatchTests, TestResultsMatchSingleCalls)
+{
+	FlightTripDatabase database{};
+	AddTrips(database);
+	WorkStealingThreadPool pool{3U};
+
+	QueryBatch const batch{MakeBatch()};
+	std::vector<std::uint32_t> expected{};
+	for (std::size_t position = 0U; position < batch.Size(); ++position)
+	{
+		auto const &query{batch[position]};
+		expected.push_back(query.kind == QueryKind::kMinFareBetweenCities
+							   ? database.FindMinFareBetweenCities(query.first, query.second)
+							   : database.FindMaxFareByOperator(query.first));
+	}
+
+	EXPECT_EQ((std::vector<std::uint32_t>{4200U, 5000U, 3900U, 4200U, 0U, UINT_MAX, UINT_MAX, 5000U}), expected);
+	EXPECT_EQ(expected, database.ExecuteBatch(batch));
+	EXPECT_EQ(expected, database.ExecuteBatch(batch, pool));
+	EXPECT_EQ(6U, batch.GetDistinctQueries().size());
+	EXPECT_TRUE(database.ExecuteBatch(QueryBatch{}, pool).empty());
+}
+
+TEST(QueryBatchTests, TestRepeatedQueriesShareSlot)
+{
+	QueryBatch batch{};
+
+	EXPECT_EQ(0U, batch.AddMinFareBetweenCities("Pune", "Delhi"));
+	EXPECT_EQ(1U, batch.AddMinFareBetweenCities("Delhi", "Pune"));
+	EXPECT_EQ(2U, batch.AddMinFareBetweenCities("Pune", "Delhi"));
+	EXPECT_EQ(3U, batch.AddMaxFareByOperator("Pune"));
+	EXPECT_EQ(4U, batch.AddMinFareBetweenCities("PuneDelhi", ""));
+
+	EXPECT_EQ((std::vector<std::size_t>{0U, 1U, 0U, 2U, 3U}), batch.GetSlots());
+	EXPECT_EQ(5U, batch.Size());
+	EXPECT_EQ("Delhi", batch[2].second);
+
+	batch.Clear();
+	EXPECT_EQ(0U, batch.Size());
+	EXPECT_TRUE(batch.GetDistinctQueries().empty());
+}
+
+TEST(QueryBatchTests, TestLargeBatchOnPool)
+{
+	FlightTripDatabase database{};
+	QueryBatch batch{};
+
+	for (std::uint32_t trip = 0U; trip < 2000U; ++trip)
+	{
+		std::string const origin{"City-" + std::to_string(trip % 40U)};
+		std::string const destination{"City-" + std::to_string((trip * 7U + 1U) % 40U)};
+		std::string const flight_operator{"Operator-" + std::to_string(trip % 9U)};
+		database.AddTrip("FL-" + std::to_string(trip), origin, destination, flight_operator, 1000U + trip);
+		batch.AddMinFareBetweenCities(origin, destination);
+		batch.AddMaxFareByOperator(flight_operator);
+	}
+
+	WorkStealingThreadPool pool{4U};
+	EXPECT_EQ(database.ExecuteBatch(batch), database.ExecuteBatch(batch, pool));
+}
+
+TEST(QueryBatchTests, TestMinimalSchemaAnswersRouteQueriesOnly)
+{
+	MinimalFlightTripDatabase database{};
+	AddTrips(database);
+
+	auto const results{database.ExecuteBatch(MakeBatch())};
+	EXPECT_EQ((std::vector<std::uint32_t>{4200U, 0U, 3900U, 4200U, 0U, UINT_MAX, UINT_MAX, 0U}), results);
+}
+
+} // namespace flight_management
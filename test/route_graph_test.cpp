@@ -0,0 +1,211 @@
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "flight_trip_database.h"
+#include "route_graph.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+// Reference search: exhaustive hop-bounded relaxation over a dense fare matrix.
+std::vector<std::uint64_t> CheapestFares(const std::vector<std::vector<std::uint32_t>> &fares, InternId origin,
+										 std::size_t max_legs)
+{
+	constexpr std::uint64_t unreached{UINT64_MAX};
+	std::vector<std::uint64_t> best(fares.size(), unreached);
+	best[origin] = 0U;
+
+	for (std::size_t leg = 0U; leg < max_legs; ++leg)
+	{
+		auto next{best};
+		for (std::size_t from = 0U; from < fares.size(); ++from)
+		{
+			for (std::size_t to = 0U; to < fares.size(); ++to)
+			{
+				if (best[from] != unreached && fares[from][to] != UINT32_MAX)
+				{
+					next[to] = std::min(next[to], best[from] + fares[from][to]);
+				}
+			}
+		}
+		best = next;
+	}
+
+	return best;
+}
+
+} // namespace
+
+TEST(RouteGraphTests, TestHopLimit)
+{
+	RouteGraph graph{};
+	graph.SetEdge(0U, 3U, FareEntry{1000U, 10U});
+	graph.SetEdge(0U, 1U, FareEntry{200U, 11U});
+	graph.SetEdge(1U, 2U, FareEntry{200U, 12U});
+	graph.SetEdge(2U, 3U, FareEntry{200U, 13U});
+	graph.SetEdge(1U, 3U, FareEntry{700U, 14U});
+
+	auto const direct{graph.FindCheapestPath(0U, 3U, 1U)};
+	ASSERT_TRUE(direct.has_value());
+	EXPECT_EQ(1000U, direct->fare);
+	EXPECT_EQ(std::vector<TripId>{10U}, direct->legs);
+
+	auto const one_stop{graph.FindCheapestPath(0U, 3U, 2U)};
+	ASSERT_TRUE(one_stop.has_value());
+	EXPECT_EQ(900U, one_stop->fare);
+	EXPECT_EQ((std::vector<TripId>{11U, 14U}), one_stop->legs);
+
+	auto const two_stops{graph.FindCheapestPath(0U, 3U, 3U)};
+	ASSERT_TRUE(two_stops.has_value());
+	EXPECT_EQ(600U, two_stops->fare);
+	EXPECT_EQ((std::vector<TripId>{11U, 12U, 13U}), two_stops->legs);
+
+	EXPECT_FALSE(graph.FindCheapestPath(3U, 0U, 3U).has_value());
+	EXPECT_FALSE(graph.FindCheapestPath(0U, 0U, 3U).has_value());
+	EXPECT_FALSE(graph.FindCheapestPath(0U, 9U, 3U).has_value());
+
+	graph.SetEdge(1U, 2U, std::nullopt);
+	EXPECT_EQ(900U, graph.FindCheapestPath(0U, 3U, 3U)->fare);
+	EXPECT_EQ(4U, graph.GetEdgeCount());
+}
+
+TEST(RouteGraphTests, TestChurnMatchesReference)
+{
+	constexpr std::size_t cities{40U};
+	std::vector<std::vector<std::uint32_t>> fares(cities, std::vector<std::uint32_t>(cities, UINT32_MAX));
+	RouteGraph graph{};
+	std::mt19937 random{7U};
+
+	for (std::size_t step = 0U; step < 4000U; ++step)
+	{
+		auto const origin{static_cast<InternId>(random() % cities)};
+		auto const destination{static_cast<InternId>(random() % cities)};
+		if (origin == destination)
+		{
+			continue;
+		}
+
+		if (random() % 4U == 0U)
+		{
+			fares[origin][destination] = UINT32_MAX;
+			graph.SetEdge(origin, destination, std::nullopt);
+		}
+		else
+		{
+			fares[origin][destination] = 100U + static_cast<std::uint32_t>(random() % 5000U);
+			graph.SetEdge(origin, destination, FareEntry{fares[origin][destination], static_cast<TripId>(step)});
+		}
+
+		if (step % 500U == 0U)
+		{
+			for (std::size_t max_legs = 1U; max_legs <= 3U; ++max_legs)
+			{
+				auto const expected{CheapestFares(fares, 0U, max_legs)};
+				for (InternId destination_city = 1U; destination_city < cities; ++destination_city)
+				{
+					auto const path{graph.FindCheapestPath(0U, destination_city, max_legs)};
+					EXPECT_EQ(expected[destination_city], path ? path->fare : UINT64_MAX);
+					EXPECT_TRUE(!path || path->legs.size() <= max_legs);
+				}
+			}
+		}
+	}
+}
+
+TEST(RouteGraphTests, TestItineraryFollowsTrips)
+{
+	FlightTripDatabase database{};
+	database.AddTrip("AI-101", "Pune", "Kolkata", "Air India", 9000U);
+	database.AddTrip("6E-202", "Pune", "Delhi", "IndiGo", 3000U);
+	database.AddTrip("6E-203", "Pune", "Delhi", "IndiGo", 2500U);
+	database.AddTrip("SG-303", "Delhi", "Kolkata", "SpiceJet", 4000U);
+	database.AddTrip("UK-404", "Delhi", "Mumbai", "Vistara", 1000U);
+	database.AddTrip("UK-405", "Mumbai", "Kolkata", "Vistara", 1000U);
+
+	auto const direct{database.FindCheapestItinerary("Pune", "Kolkata", 0U)};
+	ASSERT_TRUE(direct.has_value());
+	EXPECT_EQ(9000U, direct->total_fare);
+	ASSERT_EQ(1U, direct->legs.size());
+	EXPECT_EQ("AI-101", direct->legs[0].GetFlightNumber());
+
+	auto const two_stops{database.FindCheapestItinerary("Pune", "Kolkata", 2U)};
+	ASSERT_TRUE(two_stops.has_value());
+	EXPECT_EQ(4500U, two_stops->total_fare);
+	ASSERT_EQ(3U, two_stops->legs.size());
+	EXPECT_EQ("6E-203", two_stops->legs[0].GetFlightNumber());
+	EXPECT_EQ("UK-404", two_stops->legs[1].GetFlightNumber());
+	EXPECT_EQ("UK-405", two_stops->legs[2].GetFlightNumber());
+
+	// SIZE_MAX stops means no limit rather than wrapping to zero legs.
+	WorkStealingThreadPool pool{1U};
+	EXPECT_EQ(4500U, database.FindCheapestItinerary("Pune", "Kolkata", SIZE_MAX)->total_fare);
+	auto const unlimited{database.FindCheapestItineraries(
+		std::vector<std::pair<std::string, std::string>>{{"Pune", "Kolkata"}}, SIZE_MAX, pool)};
+	ASSERT_TRUE(unlimited.front().has_value());
+	EXPECT_EQ(4500U, unlimited.front()->total_fare);
+
+	EXPECT_TRUE(database.RemoveTrip("6E-203"));
+	EXPECT_EQ(5000U, database.FindCheapestItinerary("Pune", "Kolkata", 2U)->total_fare);
+
+	EXPECT_TRUE(database.UpdateFareByTrip("SG-303", 500U));
+	auto const one_stop{database.FindCheapestItinerary("Pune", "Kolkata", 1U)};
+	ASSERT_TRUE(one_stop.has_value());
+	EXPECT_EQ(3500U, one_stop->total_fare);
+	EXPECT_EQ("SG-303", one_stop->legs[1].GetFlightNumber());
+
+	EXPECT_TRUE(database.RemoveTrip("6E-202"));
+	EXPECT_EQ(9000U, database.FindCheapestItinerary("Pune", "Kolkata", 2U)->total_fare);
+	EXPECT_FALSE(database.FindCheapestItinerary("Kolkata", "Pune", 2U).has_value());
+	EXPECT_FALSE(database.FindCheapestItinerary("Goa", "Pune", 2U).has_value());
+	EXPECT_TRUE(database.CheckAggregateConsistency());
+}
+
+TEST(RouteGraphTests, TestBatchMatchesSingleQueries)
+{
+	FlightTripDatabase database{};
+	std::mt19937 random{11U};
+	std::vector<std::string> cities{};
+	for (std::size_t city = 0U; city < 30U; ++city)
+	{
+		cities.push_back("City-" + std::to_string(city));
+	}
+
+	for (std::size_t trip = 0U; trip < 600U; ++trip)
+	{
+		database.AddTrip("FL-" + std::to_string(trip), cities[random() % cities.size()],
+						 cities[random() % cities.size()], "Air India", 500U + random() % 9000U);
+	}
+
+	std::vector<std::pair<std::string, std::string>> queries{};
+	for (std::size_t query = 0U; query < 200U; ++query)
+	{
+		queries.emplace_back(cities[random() % cities.size()], cities[random() % cities.size()]);
+	}
+	queries.emplace_back("Nowhere", cities[0]);
+
+	WorkStealingThreadPool pool{3U};
+	auto const itineraries{database.FindCheapestItineraries(queries, 2U, pool)};
+	ASSERT_EQ(queries.size(), itineraries.size());
+
+	for (std::size_t query = 0U; query < queries.size(); ++query)
+	{
+		auto const single{database.FindCheapestItinerary(queries[query].first, queries[query].second, 2U)};
+		ASSERT_EQ(single.has_value(), itineraries[query].has_value());
+		if (single)
+		{
+			EXPECT_EQ(single->total_fare, itineraries[query]->total_fare);
+		}
+	}
+	EXPECT_FALSE(itineraries.back().has_value());
+	EXPECT_TRUE(database.CheckAggregateConsistency());
+}
+
+} // namespace flight_management
@@ -0,0 +1,116 @@
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "schedule_loader.h"
+
+namespace flight_management
+{
+
+TEST(ScheduleLoaderTests, TestParseCsvLine)
+{
+	TripRecordView record{};
+
+	EXPECT_TRUE(ScheduleLoader::ParseCsvLine("AI-855,Pune,Delhi,Air India,4500\r", record));
+	EXPECT_EQ("AI-855", record.flight_number);
+	EXPECT_EQ("Air India", record.flight_operator);
+	EXPECT_EQ(4500U, record.fare);
+
+	EXPECT_FALSE(ScheduleLoader::ParseCsvLine("AI-855,Pune,Delhi,Air India", record));
+	EXPECT_FALSE(ScheduleLoader::ParseCsvLine("AI-855,Pune,Delhi,Air India,45x0", record));
+	EXPECT_FALSE(ScheduleLoader::ParseCsvLine("AI-855,,Delhi,Air India,4500", record));
+}
+
+TEST(ScheduleLoaderTests, TestLoadCsvCountsRejectedRows)
+{
+	FlightTripDatabase database{};
+	database.AddTrip("SJ-356", "Delhi", "Pune", "Spice", 1000);
+
+	const std::string contents{"flight_number,origin_city,destination_city,operator,fare\n"
+							   "AI-855,Delhi,Pune,Air India,2345\n"
+							   "\n"
+							   "AI-856,Pune,Delhi,Air India,not a fare\n"
+							   "SJ-356,Delhi,Pune,Spice,900\n"
+							   "AI-855,Delhi,Pune,Air India,100\n"
+							   "IG-856,Delhi,Pune,Indigo,4699"};
+
+	LoadStatistics statistics{ScheduleLoader{}.LoadCsv(contents, database)};
+
+	EXPECT_EQ(2U, statistics.rows_loaded);
+	EXPECT_EQ(3U, statistics.rows_rejected);
+	EXPECT_EQ(1000U, database.FindMinFareBetweenCities("Delhi", "Pune"));
+	EXPECT_EQ(4699U, database.FindMaxFareByOperator("Indigo"));
+	EXPECT_EQ(3U, database.FindFlightsByOriginCity("Delhi").size());
+	EXPECT_TRUE(database.CheckAggregateConsistency());
+}
+
+TEST(ScheduleLoaderTests, TestParallelLoadMatchesSerialLoad)
+{
+	std::string contents{};
+	for (std::uint32_t index = 0U; index < 1000U; ++index)
+	{
+		contents += "FL-" + std::to_string(index) + "," + ((index % 3U == 0U) ? "Pune" : "Delhi") + ",Mumbai," +
+					((index % 2U == 0U) ? "Air India" : "Spice") + "," + std::to_string(1000U + index) + "\n";
+	}
+
+	FlightTripDatabase serial{};
+	FlightTripDatabase parallel{};
+
+	EXPECT_EQ(1000U, ScheduleLoader{1U}.LoadCsv(contents, serial).rows_loaded);
+	EXPECT_EQ(1000U, ScheduleLoader{4U}.LoadCsv(contents, parallel).rows_loaded);
+
+	auto const serial_flights{serial.FindFlightsByOriginCity("Pune")};
+	auto const parallel_flights{parallel.FindFlightsByOriginCity("Pune")};
+	EXPECT_EQ(334U, parallel_flights.size());
+	EXPECT_TRUE(std::equal(serial_flights.begin(), serial_flights.end(), parallel_flights.begin()));
+	EXPECT_EQ(serial.FindAverageCostOfAllTrips(), parallel.FindAverageCostOfAllTrips());
+	EXPECT_TRUE(parallel.CheckAggregateConsistency());
+
+	// One loader's parser pool serves every load.
+	ScheduleLoader const loader{4U};
+	for (std::size_t load = 0U; load < 3U; ++load)
+	{
+		FlightTripDatabase reloaded{};
+		EXPECT_EQ(1000U, loader.LoadCsv(contents, reloaded).rows_loaded);
+		EXPECT_EQ(serial.FindAverageCostOfAllTrips(), reloaded.FindAverageCostOfAllTrips());
+	}
+}
+
+TEST(ScheduleLoaderTests, TestBulkLoadMergesWithExistingPostings)
+{
+	FlightTripDatabase database{};
+	database.AddTrip("AI-855", "Delhi", "Pune", "Air India", 2345);
+	database.AddTrip("AI-856", "Delhi", "Pune", "Air India", 3456);
+	database.RemoveTrip("AI-855");
+
+	std::vector<TripRecordView> records{{"AI-857", "Delhi", "Pune", "Air India", 5000},
+										{"AI-855", "Delhi", "Pune", "Air India", 1200}};
+
+	EXPECT_EQ(2U, database.BulkLoad(records));
+	EXPECT_EQ(3U, database.FindFlightsByOriginCity("Delhi").size());
+	EXPECT_EQ(1200U, database.FindMinFareBetweenCities("Delhi", "Pune"));
+	EXPECT_TRUE(database.CheckAggregateConsistency());
+}
+
+TEST(ScheduleLoaderTests, TestLoadCsvFile)
+{
+	const std::string path{::testing::TempDir() + "schedule_loader_test.csv"};
+	{
+		std::ofstream file{path};
+		file << "AI-855,Delhi,Pune,Air India,2345\nSJ-356,Delhi,Pune,Spice,1000\n";
+	}
+
+	FlightTripDatabase database{};
+	auto const statistics{ScheduleLoader{}.LoadCsvFile(path, database)};
+	std::remove(path.c_str());
+
+	ASSERT_TRUE(statistics.has_value());
+	EXPECT_EQ(2U, statistics->rows_loaded);
+	EXPECT_EQ(1000U, database.FindMinFareBetweenCities("Delhi", "Pune"));
+
+	EXPECT_FALSE(ScheduleLoader{}.LoadCsvFile(path, database).has_value());
+}
+
+} // namespace flight_management
@@ -0,0 +1,73 @@
+#include "gtest/gtest.h"
+
+#include <climits>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sharded_flight_trip_database.h"
+
+namespace flight_management
+{
+
+TEST(ShardedFlightTripDatabaseTests, TestSingleTripOperations)
+{
+	ShardedFlightTripDatabase database{4U};
+
+	EXPECT_EQ(4U, database.GetShardCount());
+	EXPECT_TRUE(database.AddTrip("AI-855", "Pune", "Delhi", "Air India", 4500));
+	EXPECT_FALSE(database.AddTrip("AI-855", "Pune", "Delhi", "Air India", 4500));
+	EXPECT_TRUE(database.UpdateFareByTrip("AI-855", 3900));
+	EXPECT_EQ(3900U, database.FindFlightsByNumber("AI-855").value().GetAirFare());
+	EXPECT_TRUE(database.RemoveTrip("AI-855"));
+	EXPECT_FALSE(database.IsTripInDatabase("AI-855"));
+	EXPECT_EQ(1U, ShardedFlightTripDatabase{0U}.GetShardCount());
+}
+
+TEST(ShardedFlightTripDatabaseTests, TestCrossShardQueriesMerge)
+{
+	ShardedFlightTripDatabase database{8U};
+	std::uint64_t total_fare{0U};
+
+	for (std::uint32_t index = 0U; index < 100U; ++index)
+	{
+		std::uint32_t const fare{1000U + index * 10U};
+		database.AddTrip("FL-" + std::to_string(index), (index % 2U == 0U) ? "Pune" : "Delhi", "Mumbai",
+						 (index % 4U == 0U) ? "Air India" : "Spice", fare);
+		total_fare += fare;
+	}
+
+	EXPECT_EQ(50U, database.FindFlightsByOriginCity("Pune").size());
+	EXPECT_EQ(1960U, database.FindMaxFareByOperator("Air India"));
+	EXPECT_EQ(1990U, database.FindMaxFareByOperator("Spice"));
+	EXPECT_EQ(1010U, database.FindMinFareBetweenCities("Delhi", "Mumbai"));
+	EXPECT_EQ(UINT_MAX, database.FindMinFareBetweenCities("Mumbai", "Pune"));
+	EXPECT_EQ(total_fare / 100U, database.FindAverageCostOfAllTrips());
+}
+
+TEST(ShardedFlightTripDatabaseTests, TestConcurrentWriters)
+{
+	ShardedFlightTripDatabase database{4U};
+	std::vector<std::thread> writers{};
+
+	for (std::uint32_t writer = 0U; writer < 4U; ++writer)
+	{
+		writers.emplace_back([&database, writer]() {
+			for (std::uint32_t index = 0U; index < 250U; ++index)
+			{
+				database.AddTrip("W" + std::to_string(writer) + "-" + std::to_string(index), "Pune", "Delhi",
+								 "Air India", 1000U + index);
+			}
+		});
+	}
+
+	for (auto &writer : writers)
+	{
+		writer.join();
+	}
+
+	EXPECT_EQ(1000U, database.FindFlightsByOriginCity("Pune").size());
+	EXPECT_EQ(1000U, database.FindMinFareBetweenCities("Pune", "Delhi"));
+}
+
+} // namespace flight_management
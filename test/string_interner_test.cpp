@@ -0,0 +1,44 @@
+#include "gtest/gtest.h"
+
+#include <string>
+
+#include "string_interner.h"
+
+namespace flight_management
+{
+
+TEST(StringInternerTests, TestInternAssignsDenseIds)
+{
+	StringInterner interner{};
+
+	EXPECT_EQ(0U, interner.Intern("Pune"));
+	EXPECT_EQ(1U, interner.Intern("Delhi"));
+	EXPECT_EQ(0U, interner.Intern(std::string{"Pune"}));
+	EXPECT_EQ(2U, interner.Size());
+}
+
+TEST(StringInternerTests, TestFindAndGet)
+{
+	StringInterner interner{};
+	InternId id{interner.Intern("Thiruvananthapuram")};
+
+	EXPECT_EQ(id, interner.Find("Thiruvananthapuram"));
+	EXPECT_EQ("Thiruvananthapuram", interner.Get(id));
+	EXPECT_EQ(kInvalidInternId, interner.Find("Mumbai"));
+}
+
+TEST(StringInternerTests, TestCopyKeepsLookupsValid)
+{
+	StringInterner copy{};
+	{
+		StringInterner interner{};
+		interner.Intern("Pune");
+		interner.Intern("Delhi");
+		copy = interner;
+	}
+
+	EXPECT_EQ(1U, copy.Find("Delhi"));
+	EXPECT_EQ("Pune", copy.Get(0U));
+}
+
+} // namespace flight_management
@@ -0,0 +1,99 @@
+#include "gtest/gtest.h"
+
+#include <string>
+#include <type_traits>
+
+#include "flight_trip_database.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+template <typename Database>
+void AddTrips(Database &database)
+{
+	database.AddTrip("AI-101", "Pune", "Delhi", "Air India", 5000U);
+	database.AddTrip("6E-202", "Pune", "Delhi", "IndiGo", 4200U);
+	database.AddTrip("SG-303", "Delhi", "Pune", "SpiceJet", 3900U);
+	database.AddTrip("AI-404", "Pune", "Mumbai", "Air India", 3100U);
+}
+
+} // namespace
+
+TEST(TripIndexSchemaTests, TestSchemaMembership)
+{
+	static_assert(FullTripSchema::kHas<OriginPostings>);
+	static_assert(FullTripSchema::kHas<OperatorFares>);
+	static_assert(FullTripSchema::kHas<OriginFares>);
+	static_assert(FullTripSchema::kHas<RouteGraphIndex>);
+	static_assert(!MinimalTripSchema::kHas<RouteGraphIndex>);
+	static_assert(MinimalTripSchema::kHas<RouteFares>);
+	static_assert(!MinimalTripSchema::kHas<OriginPostings>);
+	static_assert(!MinimalTripSchema::kHas<OperatorPostings>);
+	static_assert(sizeof(MinimalTripSchema::IndexSet) < sizeof(FullTripSchema::IndexSet));
+}
+
+TEST(TripIndexSchemaTests, TestIndexesReadTheirOwnKey)
+{
+	TripColumns columns{};
+	columns.Assign(0U, 3U, 7U, 11U, 1000U);
+
+	EXPECT_EQ(OriginPostings::KeyOf::Of(columns, 0U), 3U);
+	EXPECT_EQ(DestinationPostings::KeyOf::Of(columns, 0U), 7U);
+	EXPECT_EQ(OperatorPostings::KeyOf::Of(columns, 0U), 11U);
+	EXPECT_EQ(OperatorFares::KeyOf::Of(columns, 0U), 11U);
+	EXPECT_EQ(OriginFares::KeyOf::Of(columns, 0U), 3U);
+	EXPECT_EQ(RouteFares::KeyOf::Of(columns, 0U), MakeRouteKey(3U, 7U));
+}
+
+TEST(TripIndexSchemaTests, TestMinimalSchemaAnswersRouteQueries)
+{
+	MinimalFlightTripDatabase database{};
+	AddTrips(database);
+
+	EXPECT_EQ(database.FindMinFareBetweenCities("Pune", "Delhi"), 4200U);
+	EXPECT_EQ(database.FindCheapestFlightBetweenCities("Pune", "Delhi")->GetFlightNumber(), "6E-202");
+
+	EXPECT_TRUE(database.UpdateFareByTrip("AI-101", 4000U));
+	EXPECT_EQ(database.FindMinFareBetweenCities("Pune", "Delhi"), 4000U);
+
+	EXPECT_TRUE(database.RemoveTrip("AI-101"));
+	EXPECT_EQ(database.FindMinFareBetweenCities("Pune", "Delhi"), 4200U);
+	EXPECT_EQ(database.FindMinFareBetweenCities("Delhi", "Mumbai"), UINT_MAX);
+
+	EXPECT_EQ(database.GetTripCount(), 3U);
+	EXPECT_EQ(database.GetIndexStatistics().live_entries, 0U);
+	EXPECT_TRUE(database.CheckAggregateConsistency());
+}
+
+TEST(TripIndexSchemaTests, TestSchemasAgreeOnSharedQueries)
+{
+	FlightTripDatabase full{};
+	MinimalFlightTripDatabase minimal{};
+	AddTrips(full);
+	AddTrips(minimal);
+
+	std::vector<TripRecordView> const records{{"UK-505", "Mumbai", "Pune", "Vistara", 2800U},
+											  {"UK-606", "Mumbai", "Pune", "Vistara", 2600U}};
+	EXPECT_EQ(full.BulkLoad(records), 2U);
+	EXPECT_EQ(minimal.BulkLoad(records), 2U);
+
+	EXPECT_EQ(full.UpdateFaresByOperators({{"Air India", FarePercentage{10}}}), 2U);
+	EXPECT_EQ(minimal.UpdateFaresByOperators({{"Air India", FarePercentage{10}}}), 2U);
+
+	for (auto const &route : {std::make_pair("Pune", "Delhi"), std::make_pair("Pune", "Mumbai"),
+							  std::make_pair("Mumbai", "Pune"), std::make_pair("Delhi", "Pune")})
+	{
+		EXPECT_EQ(full.FindMinFareBetweenCities(route.first, route.second),
+				  minimal.FindMinFareBetweenCities(route.first, route.second));
+	}
+
+	EXPECT_EQ(full.GetTotalFare(), minimal.GetTotalFare());
+	EXPECT_EQ(full.FindAverageCostOfAllTrips(), minimal.FindAverageCostOfAllTrips());
+	EXPECT_TRUE(full.CheckAggregateConsistency());
+	EXPECT_TRUE(minimal.CheckAggregateConsistency());
+}
+
+} // namespace flight_management
@@ -0,0 +1,149 @@
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "work_stealing_thread_pool.h"
+
+namespace flight_management
+{
+
+TEST(WorkStealingThreadPoolTests, TestEveryIndexRunsOnce)
+{
+	WorkStealingThreadPool pool{4U};
+	std::vector<std::atomic<int>> visits(10007U);
+
+	pool.ParallelFor(visits.size(), 64U, [&visits](std::size_t begin, std::size_t end) {
+		for (std::size_t index = begin; index < end; ++index)
+		{
+			visits[index].fetch_add(1, std::memory_order_relaxed);
+		}
+	});
+
+	for (auto const &visit : visits)
+	{
+		EXPECT_EQ(1, visit.load());
+	}
+}
+
+TEST(WorkStealingThreadPoolTests, TestWithoutWorkersRunsOnCaller)
+{
+	WorkStealingThreadPool pool{0U};
+	std::vector<std::thread::id> callers{};
+
+	pool.ParallelFor(10U, 3U, [&callers](std::size_t, std::size_t) { callers.push_back(std::this_thread::get_id()); });
+	pool.ParallelFor(0U, 3U, [&callers](std::size_t, std::size_t) { callers.push_back(std::this_thread::get_id()); });
+
+	ASSERT_EQ(4U, callers.size());
+	for (auto const &caller : callers)
+	{
+		EXPECT_EQ(std::this_thread::get_id(), caller);
+	}
+	EXPECT_EQ(0U, pool.GetThreadCount());
+}
+
+TEST(WorkStealingThreadPoolTests, TestConcurrentCallersShareWorkers)
+{
+	WorkStealingThreadPool pool{2U};
+	std::atomic<std::size_t> total{0U};
+
+	std::vector<std::thread> callers{};
+	for (std::size_t caller = 0U; caller < 4U; ++caller)
+	{
+		callers.emplace_back([&pool, &total] {
+			for (std::size_t round = 0U; round < 50U; ++round)
+			{
+				pool.ParallelFor(100U, 7U, [&total](std::size_t begin, std::size_t end) {
+					total.fetch_add(end - begin, std::memory_order_relaxed);
+				});
+			}
+		});
+	}
+
+	for (auto &caller : callers)
+	{
+		caller.join();
+	}
+
+	EXPECT_EQ(4U * 50U * 100U, total.load());
+}
+
+TEST(WorkStealingThreadPoolTests, TestManyShortCallsFinishCleanly)
+{
+	WorkStealingThreadPool pool{3U};
+
+	// Tiny bodies finish while the caller is still draining, the window in which a
+	// worker's completion notify could outlive the caller's frame.
+	for (std::size_t chunks : {2U, 3U, 4U, 7U, 16U})
+	{
+		for (std::size_t round = 0U; round < 2000U; ++round)
+		{
+			std::atomic<std::size_t> total{0U};
+
+			pool.ParallelFor(chunks, 1U, [&total](std::size_t begin, std::size_t end) {
+				total.fetch_add(end - begin, std::memory_order_relaxed);
+			});
+
+			ASSERT_EQ(chunks, total.load()) << "round " << round;
+		}
+	}
+}
+
+TEST(WorkStealingThreadPoolTests, TestPostedTasksRunInOrderOnWorkers)
+{
+	WorkStealingThreadPool pool{1U};
+	std::atomic<bool> release{false};
+	std::mutex mutex{};
+	std::vector<int> order{};
+	std::vector<std::thread::id> runners{};
+
+	// Holds the only worker, so the posted tasks stay queued.
+	pool.Post([&release] {
+		while (!release.load(std::memory_order_acquire))
+		{
+			std::this_thread::yield();
+		}
+	});
+
+	for (int task = 0; task < 10; ++task)
+	{
+		pool.Post([&mutex, &order, &runners, task] {
+			std::lock_guard<std::mutex> lock{mutex};
+			order.push_back(task);
+			runners.push_back(std::this_thread::get_id());
+		});
+	}
+
+	// The caller runs every chunk itself but leaves the posted tasks to the worker.
+	std::atomic<std::size_t> chunks{0U};
+	pool.ParallelFor(8U, 1U, [&chunks](std::size_t, std::size_t) { chunks.fetch_add(1U, std::memory_order_relaxed); });
+	EXPECT_EQ(8U, chunks.load());
+	{
+		std::lock_guard<std::mutex> lock{mutex};
+		EXPECT_TRUE(order.empty());
+	}
+
+	release.store(true, std::memory_order_release);
+
+	while (true)
+	{
+		{
+			std::lock_guard<std::mutex> lock{mutex};
+			if (order.size() == 10U)
+			{
+				break;
+			}
+		}
+		std::this_thread::yield();
+	}
+
+	for (int task = 0; task < 10; ++task)
+	{
+		EXPECT_EQ(task, order[static_cast<std::size_t>(task)]);
+		EXPECT_NE(std::this_thread::get_id(), runners[static_cast<std::size_t>(task)]);
+	}
+}
+
+} // namespace flight_management
@@ -0,0 +1,367 @@
+#include "gtest/gtest.h"
+
+#include <csignal>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "durable_flight_trip_database.h"
+#include "write_ahead_log.h"
+
+namespace flight_management
+{
+
+namespace
+{
+
+std::vector<TripMutation> MakeMutations(std::size_t count)
+{
+	static const char *const kCities[]{"Delhi", "Pune", "Chennai", "Mumbai", "Kolkata"};
+	static const char *const kOperators[]{"Air India", "Indigo", "Spice"};
+
+	std::vector<TripMutation> mutations{};
+	std::uint32_t state{2463534242U};
+
+	for (std::size_t index = 0U; index < count; ++index)
+	{
+		state ^= state << 13U;
+		state ^= state >> 17U;
+		state ^= state << 5U;
+
+		std::string flight_number{"FL-" + std::to_string(state % 40U)};
+		std::uint32_t const fare{1000U + (state >> 8U) % 9000U};
+
+		switch ((state >> 4U) % 4U)
+		{
+		case 0U:
+			mutations.push_back(TripMutation::RemoveTrip(std::move(flight_number)));
+			break;
+		case 1U:
+			mutations.push_back(TripMutation::UpdateFare(std::move(flight_number), fare));
+			break;
+		default:
+			mutations.push_back(TripMutation::AddTrip(std::move(flight_number), kCities[state % 5U],
+													  kCities[(state >> 3U) % 5U], kOperators[state % 3U], fare));
+			break;
+		}
+	}
+
+	return mutations;
+}
+
+bool Apply(DurableFlightTripDatabase &database, const TripMutation &mutation)
+{
+	switch (mutation.kind)
+	{
+	case MutationKind::kAddTrip:
+		return database.AddTrip(mutation.flight_number, mutation.origin_city, mutation.destination_city,
+								mutation.flight_operator, mutation.fare);
+	case MutationKind::kRemoveTrip:
+		return database.RemoveTrip(mutation.flight_number);
+	case MutationKind::kUpdateFare:
+		return database.UpdateFareByTrip(mutation.flight_number, mutation.fare);
+	}
+
+	return false;
+}
+
+void ExpectSameTrips(const FlightTripDatabase &expected, const FlightTripDatabase &actual)
+{
+	EXPECT_EQ(expected.GetTripCount(), actual.GetTripCount());
+	EXPECT_EQ(expected.GetTotalFare(), actual.GetTotalFare());
+	EXPECT_TRUE(actual.CheckAggregateConsistency());
+
+	for (std::size_t index = 0U; index < 40U; ++index)
+	{
+		std::string const flight_number{"FL-" + std::to_string(index)};
+		EXPECT_TRUE(expected.FindFlightsByNumber(flight_number) == actual.FindFlightsByNumber(flight_number))
+			<< flight_number;
+	}
+}
+
+} // namespace
+
+class WriteAheadLogTests : public ::testing::Test
+{
+public:
+	void SetUp() override
+	{
+		log_path_ = ::testing::TempDir() + "write_ahead_log_test.wal";
+		snapshot_path_ = ::testing::TempDir() + "write_ahead_log_test.snapshot";
+		TearDown();
+	}
+
+	void TearDown() override
+	{
+		std::remove(log_path_.c_str());
+		std::remove(snapshot_path_.c_str());
+	}
+
+protected:
+	std::size_t CountRecords() const
+	{
+		return WriteAheadLog::Replay(log_path_, [](const TripMutation &) {}).records;
+	}
+
+	std::string log_path_{};
+	std::string snapshot_path_{};
+};
+
+TEST_F(WriteAheadLogTests, TestReplayReturnsAppendedMutations)
+{
+	auto const mutations{MakeMutations(100U)};
+	{
+		auto const log{WriteAheadLog::Open(log_path_, WalOptions{Durability::kNone})};
+		ASSERT_NE(nullptr, log);
+		for (auto const &mutation : mutations)
+		{
+			EXPECT_TRUE(log->Append(mutation));
+		}
+	}
+
+	std::size_t index{0U};
+	auto const result{WriteAheadLog::Replay(log_path_, [&](const TripMutation &mutation) {
+		EXPECT_EQ(mutations[index].kind, mutation.kind);
+		EXPECT_EQ(mutations[index].flight_number, mutation.flight_number);
+		EXPECT_EQ(mutations[index].origin_city, mutation.origin_city);
+		EXPECT_EQ(mutations[index].destination_city, mutation.destination_city);
+		EXPECT_EQ(mutations[index].flight_operator, mutation.flight_operator);
+		EXPECT_EQ(mutations[index].fare, mutation.fare);
+		++index;
+	})};
+
+	EXPECT_EQ(mutations.size(), result.records);
+	EXPECT_EQ(mutations.size(), result.last_sequence);
+	EXPECT_FALSE(result.torn_tail);
+}
+
+TEST_F(WriteAheadLogTests, TestLongFieldsSurviveReplay)
+{
+	std::string const flight_operator(70000U, 'A');
+	{
+		auto const log{WriteAheadLog::Open(log_path_, WalOptions{Durability::kEveryWrite})};
+		ASSERT_NE(nullptr, log);
+		EXPECT_TRUE(log->Append(TripMutation::AddTrip("AI-855", "Delhi", "Pune", flight_operator, 4500U)));
+		EXPECT_TRUE(log->Append(TripMutation::UpdateFare("AI-855", 5000U)));
+	}
+
+	std::vector<TripMutation> replayed{};
+	auto const result{WriteAheadLog::Replay(log_path_, [&](const TripMutation &mutation) {
+		replayed.push_back(mutation);
+	})};
+
+	EXPECT_EQ(2U, result.records);
+	EXPECT_FALSE(result.torn_tail);
+	ASSERT_EQ(2U, replayed.size());
+	EXPECT_EQ(flight_operator, replayed[0U].flight_operator);
+	EXPECT_EQ(5000U, replayed[1U].fare);
+}
+
+TEST_F(WriteAheadLogTests, TestGroupCommitBatchesWrites)
+{
+	auto const mutations{MakeMutations(6U)};
+	auto const log{WriteAheadLog::Open(log_path_, WalOptions{Durability::kGroupCommit, 4U})};
+	ASSERT_NE(nullptr, log);
+
+	for (std::size_t index = 0U; index < 3U; ++index)
+	{
+		log->Append(mutations[index]);
+	}
+	EXPECT_EQ(0U, CountRecords());
+
+	log->Append(mutations[3U]);
+	EXPECT_EQ(4U, CountRecords());
+
+	log->Append(mutations[4U]);
+	log->Append(mutations[5U]);
+	EXPECT_EQ(4U, CountRecords());
+
+	EXPECT_TRUE(log->Commit());
+	EXPECT_EQ(6U, CountRecords());
+}
+
+TEST_F(WriteAheadLogTests, TestTornTailIsTruncatedOnReopen)
+{
+	auto const mutations{MakeMutations(10U)};
+	{
+		auto const log{WriteAheadLog::Open(log_path_, WalOptions{Durability::kEveryWrite})};
+		for (auto const &mutation : mutations)
+		{
+			log->Append(mutation);
+		}
+	}
+
+	auto const complete{WriteAheadLog::Replay(log_path_, [](const TripMutation &) {})};
+	ASSERT_EQ(10U, complete.records);
+
+	// Cut the last record at every possible byte: replay must keep the first nine.
+	for (std::uint64_t size = complete.valid_bytes - 1U; size > complete.valid_bytes - 12U; --size)
+	{
+		ASSERT_EQ(0, ::truncate(log_path_.c_str(), static_cast<off_t>(size)));
+
+		auto const result{WriteAheadLog::Replay(log_path_, [](const TripMutation &) {})};
+		EXPECT_EQ(9U, result.records);
+		EXPECT_TRUE(result.torn_tail);
+	}
+
+	auto const torn{WriteAheadLog::Replay(log_path_, [](const TripMutation &) {})};
+	{
+		auto const log{WriteAheadLog::Open(log_path_, WalOptions{Durability::kEveryWrite}, torn)};
+		log->Append(mutations.back());
+	}
+
+	auto const repaired{WriteAheadLog::Replay(log_path_, [](const TripMutation &) {})};
+	EXPECT_EQ(10U, repaired.records);
+	EXPECT_FALSE(repaired.torn_tail);
+}
+
+TEST_F(WriteAheadLogTests, TestCorruptRecordEndsReplay)
+{
+	auto const mutations{MakeMutations(10U)};
+	std::uint64_t fifth_record_end{0U};
+	{
+		auto const log{WriteAheadLog::Open(log_path_, WalOptions{Durability::kEveryWrite})};
+		for (std::size_t index = 0U; index < mutations.size(); ++index)
+		{
+			log->Append(mutations[index]);
+			if (index == 4U)
+			{
+				fifth_record_end = WriteAheadLog::Replay(log_path_, [](const TripMutation &) {}).valid_bytes;
+			}
+		}
+	}
+
+	std::FILE *const file{std::fopen(log_path_.c_str(), "r+b")};
+	ASSERT_NE(nullptr, file);
+	std::fseek(file, static_cast<long>(fifth_record_end + 12U), SEEK_SET);
+	std::fputc('#', file);
+	std::fclose(file);
+
+	EXPECT_EQ(5U, CountRecords());
+}
+
+TEST_F(WriteAheadLogTests, TestRecoveryFromSnapshotAndLogTail)
+{
+	auto const mutations{MakeMutations(300U)};
+	FlightTripDatabase expected{};
+	{
+		auto const database{DurableFlightTripDatabase::Open(snapshot_path_, log_path_)};
+		ASSERT_NE(nullptr, database);
+
+		for (std::size_t index = 0U; index < mutations.size(); ++index)
+		{
+			EXPECT_EQ(expected.ApplyMutation(mutations[index]), Apply(*database, mutations[index]));
+			if (index == 150U)
+			{
+				EXPECT_TRUE(database->Checkpoint());
+			}
+		}
+	}
+
+	auto const recovered{DurableFlightTripDatabase::Open(snapshot_path_, log_path_)};
+	ASSERT_NE(nullptr, recovered);
+	EXPECT_GT(recovered->GetRecoveredMutations(), 0U);
+	ExpectSameTrips(expected, recovered->GetDatabase());
+}
+
+TEST_F(WriteAheadLogTests, TestFailedAppendLeavesDatabaseUntouched)
+{
+	pid_t const child{::fork()};
+	ASSERT_NE(-1, child);
+
+	if (child == 0)
+	{
+		// Past the file size limit, writes fail with EFBIG instead of raising SIGXFSZ.
+		std::signal(SIGXFSZ, SIG_IGN);
+		rlimit const limit{2048U, 2048U};
+		auto const database{::setrlimit(RLIMIT_FSIZE, &limit) == 0
+								? DurableFlightTripDatabase::Open(snapshot_path_, log_path_,
+																  WalOptions{Durability::kEveryWrite})
+								: nullptr};
+
+		int added{0};
+		while (database && added < 200 &&
+			   database->AddTrip("FL-" + std::to_string(added), "Delhi", "Pune", "Air India", 4500U))
+		{
+			++added;
+		}
+
+		// The failed add must not be visible, and the log stays failed.
+		bool const consistent{database && added > 0 && added < 200 &&
+							  !database->GetDatabase().IsTripInDatabase("FL-" + std::to_string(added)) &&
+							  !database->UpdateFareByTrip("FL-0", 5000U) &&
+							  database->GetDatabase().FindFlightsByNumber("FL-0")->GetAirFare() == 4500U &&
+							  !database->Commit()};
+		::_exit(consistent ? added : 255);
+	}
+
+	int status{0};
+	ASSERT_EQ(child, ::waitpid(child, &status, 0));
+	ASSERT_TRUE(WIFEXITED(status));
+	int const added{WEXITSTATUS(status)};
+	ASSERT_NE(255, added);
+
+	auto const recovered{DurableFlightTripDatabase::Open(snapshot_path_, log_path_)};
+	ASSERT_NE(nullptr, recovered);
+	EXPECT_EQ(static_cast<std::size_t>(added), recovered->GetDatabase().GetTripCount());
+	EXPECT_EQ(static_cast<std::size_t>(added), CountRecords());
+
+	// Mutations that would change nothing are not logged.
+	EXPECT_FALSE(recovered->AddTrip("FL-0", "Delhi", "Pune", "Air India", 4500U));
+	EXPECT_FALSE(recovered->RemoveTrip("XX-000"));
+	EXPECT_FALSE(recovered->UpdateFareByTrip("XX-000", 100U));
+	EXPECT_TRUE(recovered->Commit());
+	EXPECT_EQ(static_cast<std::size_t>(added), CountRecords());
+}
+
+TEST_F(WriteAheadLogTests, TestRecoveryAfterKillAtArbitraryPoints)
+{
+	auto const mutations{MakeMutations(400U)};
+
+	for (std::size_t kill_after : {0U, 1U, 17U, 120U, 200U, 201U, 333U, 399U})
+	{
+		TearDown();
+
+		pid_t const child{::fork()};
+		ASSERT_NE(-1, child);
+
+		if (child == 0)
+		{
+			auto const database{DurableFlightTripDatabase::Open(snapshot_path_, log_path_,
+																WalOptions{Durability::kEveryWrite})};
+			for (std::size_t index = 0U; database && index < mutations.size(); ++index)
+			{
+				Apply(*database, mutations[index]);
+				if (index == 200U)
+				{
+					database->Checkpoint();
+				}
+				if (index == kill_after)
+				{
+					std::raise(SIGKILL);
+				}
+			}
+			::_exit(1);
+		}
+
+		int status{0};
+		ASSERT_EQ(child, ::waitpid(child, &status, 0));
+		ASSERT_TRUE(WIFSIGNALED(status)) << kill_after;
+
+		FlightTripDatabase expected{};
+		for (std::size_t index = 0U; index <= kill_after; ++index)
+		{
+			expected.ApplyMutation(mutations[index]);
+		}
+
+		auto const recovered{DurableFlightTripDatabase::Open(snapshot_path_, log_path_)};
+		ASSERT_NE(nullptr, recovered);
+		ExpectSameTrips(expected, recovered->GetDatabase());
+	}
+}
+
+} // namespace flight_management
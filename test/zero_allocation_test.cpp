@@ -0,0 +1,211 @@
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "concurrent_flight_trip_database.h"
+#include "flight_trip_database.h"
+#include "mapped_flight_trip_database.h"
+#include "sharded_flight_trip_database.h"
+
+namespace
+{
+
+thread_local std::size_t allocation_count{0U};
+
+void *CountedAllocate(std::size_t size, std::size_t alignment)
+{
+	++allocation_count;
+
+	// aligned_alloc wants a size that is a multiple of the alignment.
+	std::size_t const rounded{(std::max<std::size_t>(size, 1U) + alignment - 1U) / alignment * alignment};
+	if (void *const memory{std::aligned_alloc(alignment, rounded)})
+	{
+		return memory;
+	}
+
+	throw std::bad_alloc{};
+}
+
+void CountedDeallocate(void *memory) noexcept
+{
+	std::free(memory);
+}
+
+} // namespace
+
+// The pmr resources allocate through the aligned overloads, so those are counted too.
+void *operator new(std::size_t size)
+{
+	return CountedAllocate(size, alignof(std::max_align_t));
+}
+
+void *operator new[](std::size_t size)
+{
+	return CountedAllocate(size, alignof(std::max_align_t));
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+	return CountedAllocate(size, std::max(alignof(std::max_align_t), static_cast<std::size_t>(alignment)));
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment)
+{
+	return CountedAllocate(size, std::max(alignof(std::max_align_t), static_cast<std::size_t>(alignment)));
+}
+
+void operator delete(void *memory) noexcept
+{
+	CountedDeallocate(memory);
+}
+
+void operator delete[](void *memory) noexcept
+{
+	CountedDeallocate(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+	CountedDeallocate(memory);
+}
+
+void operator delete[](void *memory, std::size_t) noexcept
+{
+	CountedDeallocate(memory);
+}
+
+void operator delete(void *memory, std::align_val_t) noexcept
+{
+	CountedDeallocate(memory);
+}
+
+void operator delete[](void *memory, std::align_val_t) noexcept
+{
+	CountedDeallocate(memory);
+}
+
+void operator delete(void *memory, std::size_t, std::align_val_t) noexcept
+{
+	CountedDeallocate(memory);
+}
+
+void operator delete[](void *memory, std::size_t, std::align_val_t) noexcept
+{
+	CountedDeallocate(memory);
+}
+
+namespace flight_management
+{
+
+namespace
+{
+
+// Every key is longer than the small-string buffer, so a temporary std::string would allocate.
+constexpr char kRequestBuffer[]{"GET AI-EXPRESS-00855/Thiruvananthapuram/Visakhapatnam/Air India Express Limited"};
+
+const std::string_view kFlightNumber{kRequestBuffer + 4, 15};
+const std::string_view kOrigin{kRequestBuffer + 20, 18};
+const std::string_view kDestination{kRequestBuffer + 39, 14};
+const std::string_view kOperator{kRequestBuffer + 54, 25};
+
+template <typename Query>
+std::size_t CountAllocations(Query &&query)
+{
+	std::size_t const before{allocation_count};
+	query();
+	return allocation_count - before;
+}
+
+template <typename Database>
+void AddTrips(Database &database)
+{
+	database.AddTrip(std::string{kFlightNumber}, std::string{kOrigin}, std::string{kDestination},
+					 std::string{kOperator}, 4500);
+	database.AddTrip("AI-EXPRESS-00856", std::string{kOrigin}, std::string{kDestination}, std::string{kOperator},
+					 3900);
+}
+
+} // namespace
+
+TEST(ZeroAllocationTests, TestCounterSeesPolymorphicAllocations)
+{
+	EXPECT_LT(0U, CountAllocations([] {
+				  std::pmr::vector<std::uint32_t> const values(64U);
+				  EXPECT_EQ(64U, values.size());
+			  }));
+	EXPECT_LT(0U, CountAllocations([] {
+				  FlightTripDatabase database{};
+				  AddTrips(database);
+			  }));
+}
+
+TEST(ZeroAllocationTests, TestFlightTripDatabaseReadPaths)
+{
+	FlightTripDatabase database{};
+	AddTrips(database);
+
+	EXPECT_EQ(0U, CountAllocations([&] { EXPECT_TRUE(database.IsTripInDatabase(kFlightNumber)); }));
+	EXPECT_EQ(0U, CountAllocations([&] { EXPECT_EQ(4500U, database.FindMaxFareByOperator(kOperator)); }));
+	EXPECT_EQ(0U, CountAllocations([&] { EXPECT_EQ(3900U, database.FindMinFareBetweenCities(kOrigin, kDestination)); }));
+	EXPECT_EQ(0U, CountAllocations([&] { EXPECT_EQ(4200U, database.FindAverageCostOfAllTrips()); }));
+	EXPECT_EQ(0U, CountAllocations([&] {
+				  EXPECT_EQ(kOperator, database.ViewFlightByNumber(kFlightNumber)->GetOperator());
+			  }));
+	EXPECT_EQ(0U, CountAllocations([&] {
+				  std::size_t flights{0U};
+				  for (TripView const trip : database.ViewFlightsByOriginCity(kOrigin))
+				  {
+					  flights += (trip.GetDestinationCity() == kDestination) ? 1U : 0U;
+				  }
+				  EXPECT_EQ(2U, flights);
+			  }));
+
+	// The copying API still owns its strings.
+	EXPECT_LT(0U, CountAllocations([&] { EXPECT_TRUE(database.FindFlightsByNumber(kFlightNumber).has_value()); }));
+}
+
+TEST(ZeroAllocationTests, TestMappedFlightTripDatabaseReadPaths)
+{
+	std::string const path{::testing::TempDir() + "zero_allocation_test.snapshot"};
+	{
+		FlightTripDatabase database{};
+		AddTrips(database);
+		ASSERT_TRUE(database.SaveSnapshot(path));
+	}
+
+	auto const snapshot{MappedFlightTripDatabase::Open(path)};
+	ASSERT_NE(nullptr, snapshot);
+
+	EXPECT_EQ(0U, CountAllocations([&] { EXPECT_TRUE(snapshot->IsTripInDatabase(kFlightNumber)); }));
+	EXPECT_EQ(0U, CountAllocations([&] { EXPECT_EQ(4500U, snapshot->FindMaxFareByOperator(kOperator)); }));
+	EXPECT_EQ(0U, CountAllocations([&] { EXPECT_EQ(3900U, snapshot->FindMinFareBetweenCities(kOrigin, kDestination)); }));
+
+	std::remove(path.c_str());
+}
+
+TEST(ZeroAllocationTests, TestConcurrentAndShardedReadPaths)
+{
+	ConcurrentFlightTripDatabase concurrent{};
+	AddTrips(concurrent);
+
+	EXPECT_EQ(0U, CountAllocations([&] { EXPECT_TRUE(concurrent.IsTripInDatabase(kFlightNumber)); }));
+	EXPECT_EQ(0U, CountAllocations([&] { EXPECT_EQ(4500U, concurrent.FindMaxFareByOperator(kOperator)); }));
+	EXPECT_EQ(0U, CountAllocations([&] {
+				  EXPECT_EQ(3900U, concurrent.FindMinFareBetweenCities(kOrigin, kDestination));
+			  }));
+
+	ShardedFlightTripDatabase sharded{4U};
+	AddTrips(sharded);
+
+	EXPECT_EQ(0U, CountAllocations([&] { EXPECT_TRUE(sharded.IsTripInDatabase(kFlightNumber)); }));
+}
+
+} // namespace flight_management